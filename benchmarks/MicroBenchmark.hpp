@@ -0,0 +1,111 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<chrono>
+#include<cstdint>
+#include<fstream>
+#include<sstream>
+#include<iomanip>
+#include<iostream>
+#include<algorithm>
+#include<functional>
+
+// Keep A Value Alive so The Compiler Can't Optimize Away The Work That Produced it
+template<typename T> inline void doNotOptimize(const T &value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Micro Benchmark Result - Nanoseconds Per Operation Across Repeated Batches
+struct MicroBenchmarkResultStruct {
+    std::string name;
+    std::uint64_t iterationsPerBatch{0};
+    unsigned int batchCount{0};
+    double medianNs{0.0}, minNs{0.0}, maxNs{0.0};
+};
+
+// Micro Benchmark Runner - Times An Operation in Batches Long Enough For The Clock to Be Accurate and Reports The Median Batch
+// Slow Operations (Model Imports) Get Single Iteration Batches and Fewer Repetitions so The Suite Stays Quick
+class MicroBenchmarkRunner {
+    public:
+        // Constructor - Minimum Batch Time, Batches Per Benchmark and A Name Filter (Substring, Empty Runs Everything)
+        MicroBenchmarkRunner(const double &minBatchTimeMs, const unsigned int &batchCount, const std::string &filter) : minBatchTimeMs(minBatchTimeMs), batchCount(batchCount), filter(filter) {
+            std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(16) << "Median" << std::setw(16) << "Min" << std::setw(14) << "Iterations" << "\n";
+        }
+
+        // Check if A Benchmark Passes The Filter (Expensive Setup Can Be Skipped When it Doesn't)
+        bool isSelected(const std::string &name) {return this->filter.empty() || name.find(this->filter) != std::string::npos;}
+
+        // Run A Benchmark
+        void run(const std::string &name, const std::function<void(void)> &operation) {
+            if(!this->isSelected(name)) return;
+
+            // Warm Up (Caches, Lazy Driver Work) Then Size Batches From A Single Timed Call
+            operation();
+            const double singleCallNs{this->timeBatch(operation, 1)};
+            const double minBatchTimeNs{this->minBatchTimeMs * 1000000.0};
+            const std::uint64_t iterations{singleCallNs >= minBatchTimeNs ? 1 : std::max<std::uint64_t>(1, (std::uint64_t)(minBatchTimeNs / std::max(singleCallNs, 1.0)))};
+            const unsigned int batches{singleCallNs >= slowOperationNs ? std::min(this->batchCount, 3u) : this->batchCount};
+
+            // Time Every Batch
+            std::vector<double> batchNs;
+            for(unsigned int i = 0; i < batches; i++) batchNs.push_back(this->timeBatch(operation, iterations) / iterations);
+            std::sort(batchNs.begin(), batchNs.end());
+            MicroBenchmarkResultStruct result;
+            result.name = name;
+            result.iterationsPerBatch = iterations;
+            result.batchCount = batches;
+            result.medianNs = batchNs[batchNs.size() / 2];
+            result.minNs = batchNs.front();
+            result.maxNs = batchNs.back();
+            this->results.push_back(result);
+
+            // Print Result
+            std::cout << std::left << std::setw(48) << name << std::right << std::setw(16) << formatTime(result.medianNs) << std::setw(16) << formatTime(result.minNs) << std::setw(14) << iterations * batches << std::endl;
+        }
+
+        // Write Every Result as JSON
+        bool writeJSON(const std::string &filePath) {
+            std::ofstream resultsFile(filePath);
+            if(!resultsFile) {
+                std::cerr << "Failed to Write Benchmark Results: " << filePath << "\n";
+                return false;
+            }
+            resultsFile.precision(3);
+            resultsFile << std::fixed << "{\"benchmarks\": [\n";
+            for(unsigned int i = 0; i < this->results.size(); i++) {
+                const MicroBenchmarkResultStruct &result = this->results[i];
+                resultsFile << "  {\"name\": \"" << result.name << "\", \"medianNs\": " << result.medianNs << ", \"minNs\": " << result.minNs << ", \"maxNs\": " << result.maxNs
+                            << ", \"iterationsPerBatch\": " << result.iterationsPerBatch << ", \"batches\": " << result.batchCount << "}" << (i + 1 < this->results.size() ? ",\n" : "\n");
+            }
+            resultsFile << "]}\n";
+            return true;
+        }
+    private:
+        // Operations Slower Than This Only Get A Few Batches
+        static constexpr double slowOperationNs{100000000.0};
+
+        // Runner Settings and Results
+        double minBatchTimeMs;
+        unsigned int batchCount;
+        std::string filter;
+        std::vector<MicroBenchmarkResultStruct> results;
+
+        // Time A Batch of Iterations in Nanoseconds
+        double timeBatch(const std::function<void(void)> &operation, const std::uint64_t &iterations) {
+            const std::chrono::steady_clock::time_point startTime{std::chrono::steady_clock::now()};
+            for(std::uint64_t i = 0; i < iterations; i++) operation();
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+        }
+
+        // Format A Time With A Readable Unit
+        static std::string formatTime(const double &ns) {
+            std::ostringstream formatted;
+            formatted << std::fixed << std::setprecision(2);
+            if(ns >= 1000000.0) formatted << ns / 1000000.0 << " ms";
+            else if(ns >= 1000.0) formatted << ns / 1000.0 << " us";
+            else formatted << ns << " ns";
+            return formatted.str();
+        }
+};
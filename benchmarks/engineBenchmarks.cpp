@@ -0,0 +1,273 @@
+// Engine Micro Benchmarks - Times The Engine's Hot Paths in Isolation so Optimizations Can Be Measured
+// Usage: engineBenchmarks [--filter <Substring>] [--json <File>] [--no-gl] [--min-batch-ms <Ms>] [--batches <Count>]
+// GL Cases Run on A Headless EGL Context (Mesa llvmpipe Works, Asset Paths Are Relative to The Build Directory Like The Engine's)
+
+// Standard Headers
+#include<cmath>
+#include<atomic>
+#include<random>
+#include<string>
+#include<vector>
+#include<cstdlib>
+#include<fstream>
+#include<iostream>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+#include<glm/gtc/matrix_transform.hpp>
+
+// Assimp (Open Asset Importer)
+#include<assimp/Importer.hpp>
+#include<assimp/scene.h>
+#include<assimp/postprocess.h>
+
+// stb_image (Implemented by The Engine's Texture Module)
+#include<stb_image.h>
+
+// Custom Engine Headers
+#include"../src/Engine/Model/Model.hpp"
+#include"../src/Engine/Shader/Shader.hpp"
+#include"../src/Engine/Texture/Texture.hpp"
+#include"../src/Engine/Camera/Camera.hpp"
+#include"../src/Engine/Culling/Culling.hpp"
+#include"../src/Engine/Platform/HeadlessContext.hpp"
+#include"../src/Engine/Jobs/JobSystem.hpp"
+#include"../src/Engine/Memory/FrameArena.hpp"
+
+// Micro Benchmark Runner
+#include"MicroBenchmark.hpp"
+
+// Benchmark Assets (Same Files And Import Flags as The Engine)
+const std::string backpackModelFilePath{"../assets/models/survivalBackpack/backpack.obj"}, cubeModelFilePath{"../assets/models/cube.obj"};
+const std::string jpegTextureFilePath{"../assets/textures/skybox/right.jpg"};
+const std::string shadowMapVertexShaderFilePath{"../src/shaders/shadowMapShaders/vertexShader.glsl"}, shadowMapFragmentShaderFilePath{"../src/shaders/shadowMapShaders/fragmentShader.glsl"};
+const unsigned int backpackImportFlags{aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph};
+const unsigned int cubeImportFlags{aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph};
+
+// Culling and Matrix Case Sizes
+const unsigned int cullingBoxCount{10000}, matrixObjectCount{1000}, uniformLightCount{32};
+
+// Check if A File Exists (Cases Whose Assets Are Missing Are Skipped)
+static bool fileExists(const std::string &filePath) {
+    if(std::ifstream(filePath)) return true;
+    std::cout << "Skipping Cases Using Missing Asset: " << filePath << "\n";
+    return false;
+}
+
+// CPU Only Cases
+static void runCPUBenchmarks(MicroBenchmarkRunner &runner) {
+    // Model Import (Assimp Only)
+    for(const auto &[name, filePath, flags] : {std::tuple{"Backpack", backpackModelFilePath, backpackImportFlags}, std::tuple{"Cube", cubeModelFilePath, cubeImportFlags}}) {
+        if(!runner.isSelected(std::string("Assimp Import (") + name + ")") && !runner.isSelected(std::string("Model::convertMesh (") + name + ")")) continue;
+        if(!fileExists(filePath)) continue;
+        runner.run(std::string("Assimp Import (") + name + ")", [&]() {
+            Assimp::Importer importer;
+            doNotOptimize(importer.ReadFile(filePath, flags));
+        });
+
+        // importModel's Vertex and Index Conversion of Every Mesh
+        Assimp::Importer importer;
+        const aiScene* scene = importer.ReadFile(filePath, flags);
+        if(scene == nullptr) continue;
+        runner.run(std::string("Model::convertMesh (") + name + ")", [&]() {
+            for(unsigned int i = 0; i < scene->mNumMeshes; i++) {
+                std::vector<VertexStruct> vertices;
+                std::vector<unsigned int> indices;
+                Model::convertMesh(scene->mMeshes[i], vertices, indices);
+                doNotOptimize(vertices.data());
+                doNotOptimize(indices.data());
+            }
+        });
+    }
+
+    // stb_image Decode
+    const std::string decodeBenchmarkName{"stb_image Decode (2048x2048 JPEG)"};
+    if(runner.isSelected(decodeBenchmarkName) && fileExists(jpegTextureFilePath)) {
+        runner.run(decodeBenchmarkName, [&]() {
+            int width, height, channelCount;
+            unsigned char* image = stbi_load(jpegTextureFilePath.c_str(), &width, &height, &channelCount, 0);
+            doNotOptimize(image);
+            stbi_image_free(image);
+        });
+    }
+
+    // Matrix Building
+    Camera camera(glm::vec3(0.0f, 1.0f, 5.0f), 2.5f, 0.4f, 70.0f, 0.1f, 120.0f);
+    camera.setPose(glm::vec3(0.0f, 1.0f, 5.0f), -100.0f, -10.0f);
+    runner.run("Matrix: Projection * View (Camera)", [&]() {
+        const glm::mat4 projectionMatrix{glm::perspective(glm::radians(camera.getCamFOV()), 16.0f / 9.0f, 0.1f, 100.0f)};
+        doNotOptimize(projectionMatrix * camera.getViewMatrix());
+    });
+    runner.run("Matrix: Inverse Projection View", [&]() {
+        doNotOptimize(glm::inverse(glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 100.0f) * camera.getViewMatrix()));
+    });
+    std::vector<glm::mat4> modelMatrices(matrixObjectCount);
+    for(unsigned int i = 0; i < matrixObjectCount; i++) modelMatrices[i] = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3((float)i, 0.0f, 0.0f)), (float)i, glm::vec3(0.0f, 1.0f, 0.0f));
+    runner.run("Matrix: PVM + Normal Matrix x" + std::to_string(matrixObjectCount), [&]() {
+        const glm::mat4 projectionViewMatrix{glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 100.0f) * camera.getViewMatrix()};
+        for(const glm::mat4 &modelMatrix : modelMatrices) {
+            doNotOptimize(projectionViewMatrix * modelMatrix);
+            doNotOptimize(glm::transpose(glm::inverse(glm::mat3(modelMatrix))));
+        }
+    });
+
+    // Culling Kernels Over Random Boxes Around The Camera
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f), size(0.1f, 4.0f);
+    std::vector<BoundingBox> boxes(cullingBoxCount);
+    for(BoundingBox &box : boxes) {
+        box.min = glm::vec3(position(random), position(random), position(random));
+        box.max = box.min + glm::vec3(size(random), size(random), size(random));
+    }
+    const glm::mat4 projectionViewMatrix{glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 100.0f) * camera.getViewMatrix()};
+    const Frustum frustum{Culling::extractFrustum(projectionViewMatrix)};
+    runner.run("Culling: extractFrustum", [&]() {
+        doNotOptimize(Culling::extractFrustum(projectionViewMatrix));
+    });
+    runner.run("Culling: boxIntersectsFrustum x" + std::to_string(cullingBoxCount), [&]() {
+        unsigned int visibleCount{0};
+        for(const BoundingBox &box : boxes) visibleCount += Culling::boxIntersectsFrustum(box, frustum);
+        doNotOptimize(visibleCount);
+    });
+    runner.run("Culling: transformBoundingBox x" + std::to_string(cullingBoxCount), [&]() {
+        for(unsigned int i = 0; i < boxes.size(); i++) doNotOptimize(Culling::transformBoundingBox(boxes[i], modelMatrices[i % modelMatrices.size()]));
+    });
+    runner.run("Culling: sphereIntersectsBox x" + std::to_string(cullingBoxCount), [&]() {
+        unsigned int hitCount{0};
+        for(const BoundingBox &box : boxes) hitCount += Culling::sphereIntersectsBox(glm::vec3(0.0f), 20.0f, box);
+        doNotOptimize(hitCount);
+    });
+
+    // Job System Overhead and Scaling (Compare With The Single Threaded Culling Case Above)
+    runner.run("Jobs: run + wait (Empty Job)", [&]() {
+        JobCounterStruct counter;
+        JobSystem::run([](void) {}, &counter);
+        JobSystem::wait(counter);
+    });
+    runner.run("Jobs: parallelFor boxIntersectsFrustum x" + std::to_string(cullingBoxCount), [&]() {
+        std::atomic<unsigned int> visibleCount{0};
+        JobSystem::parallelFor(boxes.size(), 512, [&](const std::size_t firstBox, const std::size_t lastBox) {
+            unsigned int rangeVisibleCount{0};
+            for(std::size_t i = firstBox; i < lastBox; i++) rangeVisibleCount += Culling::boxIntersectsFrustum(boxes[i], frustum);
+            visibleCount += rangeVisibleCount;
+        });
+        doNotOptimize(visibleCount.load());
+    });
+}
+
+// Cases Needing An OpenGL Context
+static void runGLBenchmarks(MicroBenchmarkRunner &runner) {
+    // Model Loading (Import, Mesh Conversion, Buffer and Texture Uploads)
+    for(const auto &[name, filePath, flags] : {std::tuple{"Backpack", backpackModelFilePath, backpackImportFlags}, std::tuple{"Cube", cubeModelFilePath, cubeImportFlags}}) {
+        const std::string benchmarkName{std::string("Model Load (") + name + ", GL)"};
+        if(!runner.isSelected(benchmarkName) || !fileExists(filePath)) continue;
+        runner.run(benchmarkName, [&]() {
+            Model model(filePath, flags);
+            glFinish();
+            model.destroy();
+        });
+    }
+
+    // Texture Creation (Decode, Upload and Mipmaps)
+    const std::string textureBenchmarkName{"Texture::create2DTexture (2048x2048 JPEG)"};
+    if(runner.isSelected(textureBenchmarkName) && fileExists(jpegTextureFilePath)) {
+        runner.run(textureBenchmarkName, [&]() {
+            Texture texture;
+            texture.create2DTexture(jpegTextureFilePath);
+            glFinish();
+            texture.destroy();
+        });
+    }
+
+    // Mipmap Generation
+    for(const unsigned int &size : {1024u, 2048u}) {
+        GLuint texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        std::vector<unsigned char> pixels(size * size * 4);
+        for(std::size_t i = 0; i < pixels.size(); i++) pixels[i] = (unsigned char)(i * 2654435761u >> 24);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        runner.run("glGenerateMipmap " + std::to_string(size) + "x" + std::to_string(size) + " RGBA8", [&]() {
+            glGenerateMipmap(GL_TEXTURE_2D);
+            glFinish();
+        });
+        glDeleteTextures(1, &texture);
+    }
+
+    // Uniform Setters - Name Lookups Every Call (How The Engine Sets Uniforms) vs A Cached Location
+    if(!fileExists(shadowMapVertexShaderFilePath)) return;
+    Shader shader(shadowMapVertexShaderFilePath, shadowMapFragmentShaderFilePath);
+    shader.use();
+    const glm::mat4 matrix{glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 100.0f)};
+    runner.run("Shader::setMat4 (Name Lookup)", [&]() {
+        shader.setMat4("lightPVM", matrix);
+    });
+    const GLint location{glGetUniformLocation(shader.getShaderProgram(), "lightPVM")};
+    runner.run("glUniformMatrix4fv (Cached Location)", [&]() {
+        glUniformMatrix4fv(location, 1, GL_FALSE, &matrix[0][0]);
+    });
+
+    // Array Element Names Built With std::to_string Every Frame (Light and Cascade Uniforms)
+    runner.run("Shader::setVec3 x" + std::to_string(uniformLightCount) + " (std::to_string Names)", [&]() {
+        for(unsigned int i = 0; i < uniformLightCount; i++) shader.setVec3(("pointLights[" + std::to_string(i) + "].position").c_str(), glm::vec3((float)i));
+    });
+
+    // The Same Names Formatted Into The Frame Arena (No Heap Allocations)
+    runner.run("Shader::setVec3 x" + std::to_string(uniformLightCount) + " (FrameArena::format Names)", [&]() {
+        FrameArena::beginFrame();
+        for(unsigned int i = 0; i < uniformLightCount; i++) shader.setVec3(FrameArena::format("pointLights[%u].position", i), glm::vec3((float)i));
+    });
+    glFinish();
+    shader.destroy();
+}
+
+// Main
+int main(int argc, char* argv[]) {
+    // Command Line Arguments
+    std::string filter, jsonFilePath;
+    bool glEnabled{true};
+    double minBatchTimeMs{20.0};
+    unsigned int batchCount{10};
+    for(int i = 1; i < argc; i++) {
+        const std::string argument{argv[i]};
+        if(argument == "--filter" && i + 1 < argc) filter = argv[++i];
+        else if(argument == "--json" && i + 1 < argc) jsonFilePath = argv[++i];
+        else if(argument == "--no-gl") glEnabled = false;
+        else if(argument == "--min-batch-ms" && i + 1 < argc) minBatchTimeMs = std::strtod(argv[++i], nullptr);
+        else if(argument == "--batches" && i + 1 < argc) batchCount = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--filter <Substring>] [--json <File>] [--no-gl] [--min-batch-ms <Ms>] [--batches <Count>]\n";
+            return EXIT_FAILURE;
+        }
+    }
+    MicroBenchmarkRunner runner(minBatchTimeMs, batchCount, filter);
+
+    // Job System Workers (Loaders Use Them Too, Like in The Engine)
+    JobSystem::initialize(0);
+    std::cout << "Job System Workers: " << JobSystem::getWorkerCount() << "\n";
+    FrameArena::initializeThread(1024 * 1024);
+
+    // CPU Cases
+    runCPUBenchmarks(runner);
+
+    // GL Cases on A Headless Context
+    if(glEnabled) {
+        HeadlessContext headlessContext(64, 64);
+        if(headlessContext.create() && gladLoadGLLoader((GLADloadproc)HeadlessContext::getProcAddress)) {
+            std::cout << "GL Cases on " << glGetString(GL_RENDERER) << "\n";
+            runGLBenchmarks(runner);
+        } else {
+            std::cerr << "Skipping GL Cases (No Headless Context)\n";
+        }
+        headlessContext.destroy();
+    }
+    FrameArena::shutdownThread();
+    JobSystem::shutdown();
+
+    // Write Results
+    if(!jsonFilePath.empty() && !runner.writeJSON(jsonFilePath)) return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<cstdint>
+#include<cstddef>
+
+// Archive File Layout (Little Endian, Bump assetArchiveVersion Whenever it Changes)
+// AssetArchiveHeaderStruct, Then The Table of Contents (entryCount AssetArchiveEntryStructs Sorted by Name Hash so Lookups Are A Binary Search),
+// Then Every Entry Name Back to Back, Then Every Entry's Data Starting on An assetArchiveAlignment Boundary
+// Stored Entries Are Used Straight From The Mapped File, Compressed Ones Are LZ4 Blocks (See FastCompression) Decompressed on Read
+const std::uint32_t assetArchiveMagic{0x4B415041}, assetArchiveVersion{1};
+const std::uint64_t assetArchiveAlignment{64};
+
+// How An Entry's Data is Stored
+enum AssetArchiveCompression : std::uint32_t {
+    ASSET_ARCHIVE_STORED,
+    ASSET_ARCHIVE_FAST_COMPRESSED,
+};
+
+// Archive Header (Padded to One Alignment Block so The Table Starts Aligned)
+struct AssetArchiveHeaderStruct {
+    std::uint32_t magic{assetArchiveMagic}, version{assetArchiveVersion}, entryCount{0}, reserved{0};
+    std::uint64_t tableOffset{0}, namesOffset{0}, namesBytes{0}, dataOffset{0};
+    std::uint8_t padding[16]{};
+};
+
+// Table of Contents Entry (Offsets Are From The Start of The File)
+struct AssetArchiveEntryStruct {
+    std::uint64_t nameHash{0}, offset{0}, storedBytes{0}, bytes{0};
+    std::uint32_t nameOffset{0}, nameLength{0};
+    AssetArchiveCompression compression{ASSET_ARCHIVE_STORED};
+    std::uint32_t reserved{0};
+};
+
+// File to Pack Into An Archive Under name
+struct AssetArchiveInputStruct {
+    std::string name, filePath;
+};
+
+// Asset Archive Class - One Read Only Memory Mapped File Holding Many Assets (One Open and No Seeks Instead of One Per Loose File)
+// Entries Are Found Through The Table of Contents Without Copying it, Pages Are Only Read in as Entries Are Touched
+class AssetArchive {
+    public:
+        // Constructor - Closed Archive
+        AssetArchive(void) {}
+        ~AssetArchive(void) {
+            this->close();
+        }
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        // Map An Archive File / Unmap it (Pointers Into Entries Stay Valid Until Then)
+        bool open(const std::string &archiveFilePath);
+        void close(void);
+
+        // Find An Entry by Name (nullptr if There's None)
+        const AssetArchiveEntryStruct* findEntry(const std::string &name) const;
+
+        // An Entry's Data as Stored in The Archive / Decompressed Into destination (entry.bytes Bytes)
+        const unsigned char* getStoredData(const AssetArchiveEntryStruct &entry) const;
+        bool extract(const AssetArchiveEntryStruct &entry, unsigned char *destination) const;
+
+        // Every Entry in Table Order
+        std::uint32_t getEntryCount(void) const;
+        const AssetArchiveEntryStruct& getEntry(const std::uint32_t &index) const;
+        std::string getEntryName(const AssetArchiveEntryStruct &entry) const;
+
+        // Pack Files Into An Archive in Input Order (Compressing Them in Parallel on The Job System, Entries Compression Doesn't Shrink by minCompressionSavings Are Stored)
+        static bool write(const std::string &archiveFilePath, const std::vector<AssetArchiveInputStruct> &inputs, const bool &compressionEnabled = true, const float &minCompressionSavings = 0.125f);
+
+        // Name Hash Used by The Table of Contents (FNV-1a)
+        static std::uint64_t hashName(const std::string &name);
+    private:
+        // Mapped File
+        const unsigned char *mapping{nullptr};
+        std::size_t mappingBytes{0};
+
+        // Table of Contents and Entry Names (Used Straight From The Mapping, The Table is Aligned For Its 64 Bit Fields)
+        const AssetArchiveEntryStruct *table{nullptr};
+        std::uint32_t entryCount{0};
+        const char *names{nullptr};
+        std::uint64_t namesBytes{0};
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+// Assimp (Open Asset Importer)
+#include<assimp/IOSystem.hpp>
+#include<assimp/IOStream.hpp>
+
+// Custom Engine Headers
+#include"VirtualFileSystem.hpp"
+
+// Assimp File Stream - A Whole File Read Through The Virtual File System
+class AssimpFileStream : public Assimp::IOStream {
+    public:
+        // Constructor - Take Over A Read File
+        AssimpFileStream(FileDataStruct &&fileData) : fileData(std::move(fileData)) {}
+
+        // Assimp Stream Interface (Read Only)
+        size_t Read(void *buffer, size_t size, size_t count) override;
+        size_t Write(const void *buffer, size_t size, size_t count) override;
+        aiReturn Seek(size_t offset, aiOrigin origin) override;
+        size_t Tell(void) const override;
+        size_t FileSize(void) const override;
+        void Flush(void) override;
+    private:
+        // File Contents and Read Position
+        FileDataStruct fileData;
+        size_t position{0};
+};
+
+// Assimp File System - Lets Assimp Open Model Files and Whatever They Reference (OBJ Material Libraries, glTF Buffers) Through The Virtual File System
+// Set on An Importer With Assimp::Importer::SetIOHandler(new AssimpFileSystem()), The Importer Deletes it
+class AssimpFileSystem : public Assimp::IOSystem {
+    public:
+        // Assimp File System Interface (Writing Isn't Supported)
+        bool Exists(const char *filePath) const override;
+        char getOsSeparator(void) const override;
+        Assimp::IOStream* Open(const char *filePath, const char *mode = "rb") override;
+        void Close(Assimp::IOStream *file) override;
+};
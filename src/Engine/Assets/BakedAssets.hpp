@@ -0,0 +1,61 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<cstdint>
+
+// Custom Engine Headers
+#include"../Model/Model.hpp"
+#include"../Texture/Texture.hpp"
+
+// Baked File Layouts (Little Endian, Bump bakedAssetVersion Whenever One Changes so Stale Files Are Rebaked Instead of Misread)
+// Baked Model (.bmodel) - BakedModelHeaderStruct, Then Per Texture Its Type and Baked Texture Path (Relative to The Model File) as Length Prefixed Strings,
+// Then Per Mesh A BakedMeshHeaderStruct Followed by Its Texture Indices, Quantized Positions (3 x uint16 Within The Mesh's Bounds),
+// Octahedral Normals (2 x snorm16), Half Float Texture Coordinates (2 x half) and Indices (uint16 When Every Vertex Fits, Otherwise uint32)
+// Baked Texture (.btex) - BakedTextureHeaderStruct Then Every Mip Level's Compressed Blocks From The Largest (See BlockCompression)
+const std::uint32_t bakedModelMagic{0x4C444D42}, bakedTextureMagic{0x58455442}, bakedAssetVersion{1};
+const std::string bakedModelExtension{".bmodel"}, bakedTextureExtension{".btex"};
+
+// Baked Model Header
+struct BakedModelHeaderStruct {
+    std::uint32_t magic{bakedModelMagic}, version{bakedAssetVersion}, meshCount{0}, textureCount{0};
+    float boundingBoxMin[3]{}, boundingBoxMax[3]{};
+};
+
+// Baked Mesh Header
+struct BakedMeshHeaderStruct {
+    std::uint32_t vertexCount{0}, indexCount{0}, indexSize{4}, textureIndexCount{0};
+    float positionMin[3]{}, positionExtent[3]{};
+};
+
+// Baked Texture Header
+struct BakedTextureHeaderStruct {
+    std::uint32_t magic{bakedTextureMagic}, version{bakedAssetVersion}, width{0}, height{0}, channelCount{0}, compressedFormat{0}, mipLevelCount{0}, reserved{0};
+};
+
+// Baked Assets Class - Reads and Writes The Files The assetBaker Tool Converts Source Assets Into
+// Loading A Baked Asset Skips Importing, Decoding and Mipmap Generation - Vertices Are Only Dequantized and Textures Upload Their Compressed Mip Levels as They Are
+class BakedAssets {
+    public:
+        // Write / Read A Baked Model (textures[i].path Names Each Baked Texture Relative to The Model File, Read Models Leave Their Textures Undecoded)
+        static bool writeModel(const std::string &filePath, const ModelDataStruct &modelData);
+        static bool readModel(const std::string &filePath, ModelDataStruct &modelData);
+
+        // Write / Read A Baked Texture (Read Images Are Freed With Texture::freeImage Like Decoded Ones, Those in A Mounted Archive Point Into it Rather Than Being Copied)
+        static bool writeTexture(const std::string &filePath, const TextureImageStruct &image);
+        static bool readTexture(const std::string &filePath, TextureImageStruct &image);
+
+        // Renumber A Mesh's Vertices in The Order Its Indices First Use Them (Vertex Fetches Then Walk Forwards Through Memory), Dropping Unused Ones
+        static void optimizeVertexFetch(ModelMeshDataStruct &mesh);
+
+        // Check What Kind of File A Path Names (By Extension)
+        static bool isBakedModel(const std::string &filePath);
+        static bool isBakedTexture(const std::string &filePath);
+        static bool isImageFile(const std::string &filePath);
+
+        // Name A Source File is Baked Under ("backpack.obj" is Baked as "backpack.obj.bmodel", "right.jpg" as "right.jpg.btex")
+        static std::string getBakedFilePath(const std::string &sourceFilePath);
+
+        // Path to Load An Asset From - Its Baked File in bakedDirectory if it Was Baked (in A Mounted Asset Archive or on Disk), Otherwise The Source File in sourceDirectory
+        static std::string resolvePath(const std::string &sourceDirectory, const std::string &bakedDirectory, const std::string &relativePath);
+};
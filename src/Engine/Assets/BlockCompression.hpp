@@ -0,0 +1,29 @@
+#pragma once
+
+// Standard Headers
+#include<cstddef>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Custom Engine Headers
+#include"../Texture/Texture.hpp"
+
+// Block Compression Class - Generates A Texture's Mip Chain and Compresses Every Level Into Core OpenGL Block Formats
+// 1 Channel Images Become RGTC1 (BC4), 2 Channel Images RGTC2 (BC5) and Color Images BPTC (BC7, Always Mode 6 - One Subset With RGBA Endpoints)
+// Every Format Stores 4x4 Texel Blocks so Levels Not A Multiple of 4 Are Padded by Repeating Their Edge Texels
+class BlockCompression {
+    public:
+        // Compress An Uncompressed Image and Its Generated Mip Chain (compressedImage Owns Its Blocks, Free Them With Texture::freeImage)
+        static bool compress(const TextureImageStruct &image, TextureImageStruct &compressedImage);
+
+        // Compressed Format Used For An Image With channelCount Channels
+        static GLenum getCompressedFormat(const int &channelCount);
+
+        // Bytes of One Mip Level / Every Mip Level of A Compressed Image
+        static std::size_t getMipLevelBytes(const GLenum &compressedFormat, const unsigned int &width, const unsigned int &height, const unsigned int &mipLevel);
+        static std::size_t getImageBytes(const GLenum &compressedFormat, const unsigned int &width, const unsigned int &height, const unsigned int &mipLevelCount);
+
+        // Mip Levels in A Full Chain Down to 1x1
+        static unsigned int getMipLevelCount(const unsigned int &width, const unsigned int &height);
+};
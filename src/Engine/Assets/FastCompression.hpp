@@ -0,0 +1,18 @@
+#pragma once
+
+// Standard Headers
+#include<cstddef>
+
+// Fast Compression Class - LZ4 Block Format (Byte Aligned Literal Runs and Back References Within 64KB, No Entropy Coding)
+// Decompression is A Tight Copy Loop Running at Several GB/s, Compression A Single Greedy Pass With A Hash Table of The Last Position Each 4 Byte Sequence Was Seen
+class FastCompression {
+    public:
+        // Worst Case Compressed Size of sourceBytes Bytes (Incompressible Data Grows Slightly)
+        static std::size_t getMaxCompressedBytes(const std::size_t &sourceBytes);
+
+        // Compress A Buffer, Returns The Compressed Size or 0 if it Doesn't Fit in destinationCapacity
+        static std::size_t compress(const unsigned char *source, const std::size_t &sourceBytes, unsigned char *destination, const std::size_t &destinationCapacity);
+
+        // Decompress A Buffer Into Exactly destinationBytes Bytes (Fails on Corrupt or Truncated Data Instead of Reading or Writing Out of Bounds)
+        static bool decompress(const unsigned char *source, const std::size_t &sourceBytes, unsigned char *destination, const std::size_t &destinationBytes);
+};
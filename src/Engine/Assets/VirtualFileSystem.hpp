@@ -0,0 +1,50 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<cstddef>
+#include<cstdint>
+
+// A Read File's Contents - data Points Into storage, or Straight Into A Mapped Archive For Stored Entries (Valid Until it is Unmounted)
+// Move it Rather Than Copy it, A Copy's data Would Still Point Into The Original's storage
+struct FileDataStruct {
+    const unsigned char *data{nullptr};
+    std::size_t size{0};
+    std::vector<unsigned char> storage;
+
+    // Check if data Belongs to A Mapped Archive Rather Than storage
+    bool isMapped(void) const {
+        return this->data != nullptr && this->storage.empty();
+    }
+};
+
+// Virtual File System Stats
+struct VirtualFileSystemStatsStruct {
+    std::uint64_t archiveReads{0}, mappedReads{0}, looseReads{0}, failedReads{0};
+    std::uint64_t archiveBytes{0}, decompressedBytes{0}, looseBytes{0};
+    std::size_t mountedArchiveCount{0};
+};
+
+// Virtual File System Class - Every Asset and Shader Read Goes Through Here
+// Paths Under A Mounted Archive's Mount Path ("../" Holds "../assets/..." as "assets/...") Are Looked Up in The Archive First, The Last Mounted Archive Winning
+// Paths No Archive Holds Are Read From Loose Files, so Archives Can Be Mounted Over A Development Tree and Edited Files Only Need Repacking to Ship
+class VirtualFileSystem {
+    public:
+        // Mount An Archive Under mountPath / Unmount Every Archive (Mount Before Loading Starts and Unmount Once Every Mapped File is Released, Lookups Don't Lock)
+        static bool mountArchive(const std::string &archiveFilePath, const std::string &mountPath);
+        static void unmountAll(void);
+
+        // Read A Whole File - Safe on Any Thread
+        static bool readFile(const std::string &filePath, FileDataStruct &fileData);
+
+        // Check if A File Exists in A Mounted Archive or on Disk
+        static bool exists(const std::string &filePath);
+
+        // Lexically Normalized Path ("../assets/models/a/../b.png" Becomes "../assets/models/b.png")
+        static std::string normalizePath(const std::string &filePath);
+
+        // Stats
+        static VirtualFileSystemStatsStruct getStats(void);
+        static std::string getStatsReport(void);
+};
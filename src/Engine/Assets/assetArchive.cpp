@@ -0,0 +1,238 @@
+#include"AssetArchive.hpp"
+
+// Standard Headers
+#include<cstring>
+#include<fstream>
+#include<iostream>
+#include<algorithm>
+#include<filesystem>
+
+// POSIX Memory Mapping
+#include<fcntl.h>
+#include<unistd.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+
+// Custom Engine Headers
+#include"FastCompression.hpp"
+#include"../Jobs/JobSystem.hpp"
+#include"../Profiler/CPUProfiler.hpp"
+
+// Round An Offset Up to The Archive Alignment
+static std::uint64_t alignOffset(const std::uint64_t &offset) {
+    return (offset + assetArchiveAlignment - 1) / assetArchiveAlignment * assetArchiveAlignment;
+}
+
+// Map An Archive File
+bool AssetArchive::open(const std::string &archiveFilePath) {
+    CPU_PROFILE_SCOPE("AssetArchive::open");
+    this->close();
+
+    // Map The Whole File Read Only (The File Descriptor Isn't Needed Once Mapped)
+    const int file{::open(archiveFilePath.c_str(), O_RDONLY | O_CLOEXEC)};
+    if(file < 0) return false;
+    struct stat fileStatus;
+    void *mapping{MAP_FAILED};
+    if(fstat(file, &fileStatus) == 0 && fileStatus.st_size >= (off_t)sizeof(AssetArchiveHeaderStruct)) {
+        mapping = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    }
+    ::close(file);
+    if(mapping == MAP_FAILED) {
+        std::cerr << "Failed to Map Asset Archive: " << archiveFilePath << "\n";
+        return false;
+    }
+    this->mapping = (const unsigned char*)mapping;
+    this->mappingBytes = fileStatus.st_size;
+
+    // Check The Header and That The Table, Names and Every Entry Lie Within The File (Sizes Are Checked First so Corrupt Offsets Can't Overflow The Sums)
+    // Lookups Binary Search The Table so it Must Also Be Sorted by Name Hash
+    const AssetArchiveHeaderStruct &header = *(const AssetArchiveHeaderStruct*)this->mapping;
+    const std::uint64_t tableBytes{(std::uint64_t)header.entryCount * sizeof(AssetArchiveEntryStruct)};
+    bool valid{header.magic == assetArchiveMagic && header.version == assetArchiveVersion && header.tableOffset % alignof(AssetArchiveEntryStruct) == 0};
+    valid = valid && tableBytes <= this->mappingBytes && header.tableOffset <= this->mappingBytes - tableBytes;
+    valid = valid && header.namesBytes <= this->mappingBytes && header.namesOffset <= this->mappingBytes - header.namesBytes;
+    if(valid) {
+        this->table = (const AssetArchiveEntryStruct*)(this->mapping + header.tableOffset);
+        this->entryCount = header.entryCount;
+        this->names = (const char*)(this->mapping + header.namesOffset);
+        this->namesBytes = header.namesBytes;
+        for(std::uint32_t i = 0; valid && i < this->entryCount; i++) {
+            const AssetArchiveEntryStruct &entry = this->table[i];
+            valid = entry.storedBytes <= this->mappingBytes && entry.offset <= this->mappingBytes - entry.storedBytes;
+            valid = valid && entry.nameLength <= this->namesBytes && entry.nameOffset <= this->namesBytes - entry.nameLength;
+            valid = valid && (i == 0 || this->table[i - 1].nameHash <= entry.nameHash);
+            valid = valid && (entry.compression == ASSET_ARCHIVE_FAST_COMPRESSED || (entry.compression == ASSET_ARCHIVE_STORED && entry.storedBytes == entry.bytes));
+        }
+    }
+    if(!valid) {
+        std::cerr << "Invalid Asset Archive (Corrupt or Packed by Another Version): " << archiveFilePath << "\n";
+        this->close();
+        return false;
+    }
+
+    // The Table is Touched by Every Lookup, Start Reading it in Now
+    madvise((void*)(this->mapping + header.tableOffset / 4096 * 4096), header.namesOffset + header.namesBytes - header.tableOffset / 4096 * 4096, MADV_WILLNEED);
+    return true;
+}
+
+// Unmap The Archive
+void AssetArchive::close(void) {
+    if(this->mapping != nullptr) munmap((void*)this->mapping, this->mappingBytes);
+    this->mapping = nullptr;
+    this->mappingBytes = 0;
+    this->table = nullptr;
+    this->entryCount = 0;
+    this->names = nullptr;
+    this->namesBytes = 0;
+}
+
+// Find An Entry by Name
+const AssetArchiveEntryStruct* AssetArchive::findEntry(const std::string &name) const {
+    const std::uint64_t nameHash{hashName(name)};
+    const AssetArchiveEntryStruct *entry{std::lower_bound(this->table, this->table + this->entryCount, nameHash, [](const AssetArchiveEntryStruct &entry, const std::uint64_t &hash) {
+        return entry.nameHash < hash;
+    })};
+    for(; entry != this->table + this->entryCount && entry->nameHash == nameHash; entry++) {
+        if(entry->nameLength == name.size() && std::memcmp(this->names + entry->nameOffset, name.data(), name.size()) == 0) return entry;
+    }
+    return nullptr;
+}
+
+// An Entry's Data as Stored
+const unsigned char* AssetArchive::getStoredData(const AssetArchiveEntryStruct &entry) const {
+    return this->mapping + entry.offset;
+}
+
+// Decompress An Entry
+bool AssetArchive::extract(const AssetArchiveEntryStruct &entry, unsigned char *destination) const {
+    if(entry.compression == ASSET_ARCHIVE_STORED) {
+        std::memcpy(destination, this->getStoredData(entry), entry.bytes);
+        return true;
+    }
+    CPU_PROFILE_SCOPE("AssetArchive::extract");
+    return FastCompression::decompress(this->getStoredData(entry), entry.storedBytes, destination, entry.bytes);
+}
+
+// Every Entry
+std::uint32_t AssetArchive::getEntryCount(void) const {
+    return this->entryCount;
+}
+const AssetArchiveEntryStruct& AssetArchive::getEntry(const std::uint32_t &index) const {
+    return this->table[index];
+}
+std::string AssetArchive::getEntryName(const AssetArchiveEntryStruct &entry) const {
+    return std::string(this->names + entry.nameOffset, entry.nameLength);
+}
+
+// Pack Files Into An Archive
+bool AssetArchive::write(const std::string &archiveFilePath, const std::vector<AssetArchiveInputStruct> &inputs, const bool &compressionEnabled, const float &minCompressionSavings) {
+    CPU_PROFILE_SCOPE("AssetArchive::write");
+
+    // Read and Compress Every Input in Parallel (Keeping The Compressed Data Only When it Saves Enough to Be Worth Decompressing)
+    struct PackedEntryStruct {
+        AssetArchiveEntryStruct entry;
+        std::vector<unsigned char> data;
+        bool readFailed{false};
+    };
+    std::vector<PackedEntryStruct> packedEntries(inputs.size());
+    JobSystem::parallelFor(inputs.size(), 1, [&](const std::size_t firstInput, const std::size_t lastInput) {
+        for(std::size_t i = firstInput; i < lastInput; i++) {
+            PackedEntryStruct &packedEntry = packedEntries[i];
+            std::ifstream inputFile(inputs[i].filePath, std::ios::binary | std::ios::ate);
+            if(inputFile) {
+                packedEntry.data.resize((std::size_t)inputFile.tellg());
+                inputFile.seekg(0, std::ios::beg);
+                inputFile.read((char*)packedEntry.data.data(), packedEntry.data.size());
+            }
+            packedEntry.readFailed = !inputFile;
+            packedEntry.entry.nameHash = hashName(inputs[i].name);
+            packedEntry.entry.bytes = packedEntry.entry.storedBytes = packedEntry.data.size();
+            if(!compressionEnabled || packedEntry.readFailed || packedEntry.data.empty()) continue;
+            std::vector<unsigned char> compressed(FastCompression::getMaxCompressedBytes(packedEntry.data.size()));
+            const std::size_t compressedBytes{FastCompression::compress(packedEntry.data.data(), packedEntry.data.size(), compressed.data(), compressed.size())};
+            if(compressedBytes > 0 && compressedBytes <= packedEntry.data.size() * (1.0f - minCompressionSavings)) {
+                compressed.resize(compressedBytes);
+                packedEntry.data.swap(compressed);
+                packedEntry.entry.storedBytes = compressedBytes;
+                packedEntry.entry.compression = ASSET_ARCHIVE_FAST_COMPRESSED;
+            }
+        }
+    }, "Asset Archive Compress");
+    for(std::size_t i = 0; i < inputs.size(); i++) {
+        if(packedEntries[i].readFailed) {
+            std::cerr << "Failed to Read Asset Archive Input: " << inputs[i].filePath << "\n";
+            return false;
+        }
+    }
+
+    // Sort The Table by Name Hash (Then Name, so Collisions Stay Findable and Duplicates Are Caught)
+    std::vector<std::size_t> order(inputs.size());
+    for(std::size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](const std::size_t &first, const std::size_t &second) {
+        if(packedEntries[first].entry.nameHash != packedEntries[second].entry.nameHash) return packedEntries[first].entry.nameHash < packedEntries[second].entry.nameHash;
+        return inputs[first].name < inputs[second].name;
+    });
+    for(std::size_t i = 1; i < order.size(); i++) {
+        if(inputs[order[i - 1]].name == inputs[order[i]].name) {
+            std::cerr << "Duplicate Asset Archive Entry: " << inputs[order[i]].name << "\n";
+            return false;
+        }
+    }
+
+    // Lay Out The Table, Names and Aligned Entry Data (Data Stays in Input Order so Files Packed Together Are Read Together)
+    AssetArchiveHeaderStruct header;
+    header.entryCount = (std::uint32_t)inputs.size();
+    header.tableOffset = alignOffset(sizeof(AssetArchiveHeaderStruct));
+    header.namesOffset = header.tableOffset + inputs.size() * sizeof(AssetArchiveEntryStruct);
+    std::string names;
+    for(const std::size_t &input : order) {
+        packedEntries[input].entry.nameOffset = (std::uint32_t)names.size();
+        packedEntries[input].entry.nameLength = (std::uint32_t)inputs[input].name.size();
+        names += inputs[input].name;
+    }
+    header.namesBytes = names.size();
+    header.dataOffset = alignOffset(header.namesOffset + header.namesBytes);
+    std::uint64_t dataEnd{header.dataOffset};
+    for(PackedEntryStruct &packedEntry : packedEntries) {
+        packedEntry.entry.offset = dataEnd;
+        dataEnd = alignOffset(dataEnd + packedEntry.entry.storedBytes);
+    }
+
+    // Write Beside The Destination Then Rename Over it so A Running Game Never Maps A Half Written Archive
+    const std::string temporaryFilePath{archiveFilePath + ".tmp"};
+    {
+        std::ofstream archiveFile(temporaryFilePath, std::ios::binary | std::ios::trunc);
+        const auto padTo = [&](const std::uint64_t &offset) {
+            const std::vector<char> padding(offset - (std::uint64_t)archiveFile.tellp(), 0);
+            archiveFile.write(padding.data(), padding.size());
+        };
+        archiveFile.write((const char*)&header, sizeof(header));
+        padTo(header.tableOffset);
+        for(const std::size_t &input : order) archiveFile.write((const char*)&packedEntries[input].entry, sizeof(AssetArchiveEntryStruct));
+        archiveFile.write(names.data(), names.size());
+        for(const PackedEntryStruct &packedEntry : packedEntries) {
+            padTo(packedEntry.entry.offset);
+            archiveFile.write((const char*)packedEntry.data.data(), packedEntry.data.size());
+        }
+        padTo(dataEnd);
+        if(!archiveFile) {
+            std::cerr << "Failed to Write Asset Archive: " << archiveFilePath << "\n";
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporaryFilePath, archiveFilePath, error);
+    if(error) {
+        std::filesystem::remove(temporaryFilePath, error);
+        std::cerr << "Failed to Write Asset Archive: " << archiveFilePath << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Name Hash Used by The Table of Contents
+std::uint64_t AssetArchive::hashName(const std::string &name) {
+    std::uint64_t hash{14695981039346656037ull};
+    for(const char &character : name) hash = (hash ^ (unsigned char)character) * 1099511628211ull;
+    return hash;
+}
@@ -0,0 +1,64 @@
+#include"AssimpFileSystem.hpp"
+
+// Standard Headers
+#include<cstring>
+#include<cstddef>
+#include<algorithm>
+
+// Read Up to count Elements of size Bytes
+size_t AssimpFileStream::Read(void *buffer, size_t size, size_t count) {
+    if(size == 0) return 0;
+    const size_t readCount{std::min(count, (this->fileData.size - this->position) / size)};
+    std::memcpy(buffer, this->fileData.data + this->position, readCount * size);
+    this->position += readCount * size;
+    return readCount;
+}
+
+// Writing Isn't Supported
+size_t AssimpFileStream::Write(const void*, size_t, size_t) {
+    return 0;
+}
+
+// Move The Read Position (End Relative Offsets Are Negative, Passed Wrapped Around Like fseek's)
+aiReturn AssimpFileStream::Seek(size_t offset, aiOrigin origin) {
+    size_t newPosition{offset};
+    if(origin == aiOrigin_CUR) newPosition = this->position + offset;
+    else if(origin == aiOrigin_END) newPosition = this->fileData.size + (std::ptrdiff_t)offset;
+    if(newPosition > this->fileData.size) return aiReturn_FAILURE;
+    this->position = newPosition;
+    return aiReturn_SUCCESS;
+}
+
+// Read Position and File Size
+size_t AssimpFileStream::Tell(void) const {
+    return this->position;
+}
+size_t AssimpFileStream::FileSize(void) const {
+    return this->fileData.size;
+}
+
+// Nothing to Flush
+void AssimpFileStream::Flush(void) {}
+
+// Check if A File Exists
+bool AssimpFileSystem::Exists(const char *filePath) const {
+    return VirtualFileSystem::exists(filePath);
+}
+
+// Directory Separator (Virtual File System Paths Always Use Forward Slashes)
+char AssimpFileSystem::getOsSeparator(void) const {
+    return '/';
+}
+
+// Open A File For Reading
+Assimp::IOStream* AssimpFileSystem::Open(const char *filePath, const char *mode) {
+    if(std::strchr(mode, 'w') != nullptr || std::strchr(mode, 'a') != nullptr) return nullptr;
+    FileDataStruct fileData;
+    if(!VirtualFileSystem::readFile(filePath, fileData)) return nullptr;
+    return new AssimpFileStream(std::move(fileData));
+}
+
+// Close A File
+void AssimpFileSystem::Close(Assimp::IOStream *file) {
+    delete file;
+}
@@ -0,0 +1,319 @@
+#include"BakedAssets.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<cctype>
+#include<cstdlib>
+#include<cstring>
+#include<fstream>
+#include<iostream>
+#include<algorithm>
+#include<filesystem>
+
+// OpenGL Mathematics (GLM)
+#include<glm/packing.hpp>
+
+// Custom Engine Headers
+#include"BlockCompression.hpp"
+#include"VirtualFileSystem.hpp"
+#include"../Profiler/CPUProfiler.hpp"
+
+// Baked File Being Read (Parsed Straight From Its Data, Wherever The Virtual File System Found it)
+struct BakedFileReaderStruct {
+    const unsigned char *data{nullptr};
+    std::size_t size{0}, position{0};
+};
+
+// Write / Read Raw Values and Arrays (And Check count Values Are Left Before Sizing Anything by A Count Read From The File)
+template<typename T>
+static void writeValues(std::ofstream &file, const T *values, const std::size_t &count) {
+    file.write((const char*)values, count * sizeof(T));
+}
+template<typename T>
+static bool hasRemaining(const BakedFileReaderStruct &file, const std::uint64_t &count) {
+    return count <= (file.size - file.position) / sizeof(T);
+}
+template<typename T>
+static bool readValues(BakedFileReaderStruct &file, T *values, const std::size_t &count) {
+    const std::size_t bytes{count * sizeof(T)};
+    if(file.size - file.position < bytes) return false;
+    std::memcpy((void*)values, file.data + file.position, bytes);
+    file.position += bytes;
+    return true;
+}
+
+// Write / Read A Length Prefixed String
+static void writeString(std::ofstream &file, const std::string &text) {
+    const std::uint32_t length{(std::uint32_t)text.size()};
+    writeValues(file, &length, 1);
+    writeValues(file, text.data(), text.size());
+}
+static bool readString(BakedFileReaderStruct &file, std::string &text) {
+    std::uint32_t length{0};
+    if(!readValues(file, &length, 1) || !hasRemaining<char>(file, length)) return false;
+    text.resize(length);
+    return readValues(file, text.data(), length);
+}
+
+// Finish Writing A File - Baked Files Are Written Beside Their Destination Then Renamed Over it so A Failed Bake Never Leaves A Half Written File Behind
+static bool finishFile(std::ofstream &file, const std::string &temporaryFilePath, const std::string &filePath) {
+    file.close();
+    std::error_code error;
+    if(file.fail() || (std::filesystem::rename(temporaryFilePath, filePath, error), error)) {
+        std::filesystem::remove(temporaryFilePath, error);
+        std::cerr << "Failed to Write Baked File: " << filePath << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Octahedral Normal Encoding - The Unit Sphere Folded Onto A Square (Zero Vectors Decode as +Z)
+static glm::vec2 encodeOctahedral(const glm::vec3 &normal) {
+    const float length{std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z)};
+    if(length == 0.0f) return glm::vec2(0.0f);
+    const glm::vec3 octahedral{normal / length};
+    if(octahedral.z >= 0.0f) return glm::vec2(octahedral);
+    return (1.0f - glm::abs(glm::vec2(octahedral.y, octahedral.x))) * glm::vec2(octahedral.x >= 0.0f ? 1.0f : -1.0f, octahedral.y >= 0.0f ? 1.0f : -1.0f);
+}
+static glm::vec3 decodeOctahedral(const glm::vec2 &encoded) {
+    glm::vec3 normal{encoded, 1.0f - std::abs(encoded.x) - std::abs(encoded.y)};
+    if(normal.z < 0.0f) normal = glm::vec3((1.0f - glm::abs(glm::vec2(encoded.y, encoded.x))) * glm::vec2(encoded.x >= 0.0f ? 1.0f : -1.0f, encoded.y >= 0.0f ? 1.0f : -1.0f), normal.z);
+    return glm::normalize(normal);
+}
+
+// Write A Baked Model
+bool BakedAssets::writeModel(const std::string &filePath, const ModelDataStruct &modelData) {
+    const std::string temporaryFilePath{filePath + ".tmp"};
+    std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+    if(!file) {
+        std::cerr << "Failed to Write Baked File: " << filePath << "\n";
+        return false;
+    }
+
+    // Header and Textures
+    BakedModelHeaderStruct header;
+    header.meshCount = modelData.meshes.size();
+    header.textureCount = modelData.textures.size();
+    for(unsigned int axis = 0; axis < 3; axis++) {
+        header.boundingBoxMin[axis] = modelData.boundingBox.min[axis];
+        header.boundingBoxMax[axis] = modelData.boundingBox.max[axis];
+    }
+    writeValues(file, &header, 1);
+    for(const ModelTextureDataStruct &texture : modelData.textures) {
+        writeString(file, texture.type);
+        writeString(file, texture.path);
+    }
+
+    // Meshes
+    for(const ModelMeshDataStruct &mesh : modelData.meshes) {
+        // Positions Are Quantized Within The Mesh's Bounds
+        glm::vec3 positionMin{0.0f}, positionMax{0.0f};
+        if(!mesh.vertices.empty()) positionMin = positionMax = mesh.vertices[0].vertexPos;
+        for(const VertexStruct &vertex : mesh.vertices) {
+            positionMin = glm::min(positionMin, vertex.vertexPos);
+            positionMax = glm::max(positionMax, vertex.vertexPos);
+        }
+        BakedMeshHeaderStruct meshHeader;
+        meshHeader.vertexCount = mesh.vertices.size();
+        meshHeader.indexCount = mesh.indices.size();
+        meshHeader.indexSize = mesh.vertices.size() <= 65536 ? 2 : 4;
+        meshHeader.textureIndexCount = mesh.textureIndices.size();
+        for(unsigned int axis = 0; axis < 3; axis++) {
+            meshHeader.positionMin[axis] = positionMin[axis];
+            meshHeader.positionExtent[axis] = positionMax[axis] - positionMin[axis];
+        }
+        writeValues(file, &meshHeader, 1);
+        writeValues(file, mesh.textureIndices.data(), mesh.textureIndices.size());
+
+        // Quantize Vertex Streams
+        std::vector<std::uint16_t> positions(mesh.vertices.size() * 3);
+        std::vector<std::uint32_t> normals(mesh.vertices.size()), texCoords(mesh.vertices.size());
+        for(std::size_t i = 0; i < mesh.vertices.size(); i++) {
+            const VertexStruct &vertex = mesh.vertices[i];
+            for(unsigned int axis = 0; axis < 3; axis++) {
+                const float extent{meshHeader.positionExtent[axis]};
+                positions[i * 3 + axis] = extent > 0.0f ? (std::uint16_t)std::lround((vertex.vertexPos[axis] - positionMin[axis]) / extent * 65535.0f) : 0;
+            }
+            normals[i] = glm::packSnorm2x16(encodeOctahedral(vertex.normalVec));
+            texCoords[i] = glm::packHalf2x16(vertex.texCords);
+        }
+        writeValues(file, positions.data(), positions.size());
+        writeValues(file, normals.data(), normals.size());
+        writeValues(file, texCoords.data(), texCoords.size());
+
+        // Indices
+        if(meshHeader.indexSize == 2) {
+            const std::vector<std::uint16_t> shortIndices(mesh.indices.begin(), mesh.indices.end());
+            writeValues(file, shortIndices.data(), shortIndices.size());
+        } else {
+            writeValues(file, mesh.indices.data(), mesh.indices.size());
+        }
+    }
+    return finishFile(file, temporaryFilePath, filePath);
+}
+
+// Read A Baked Model
+bool BakedAssets::readModel(const std::string &filePath, ModelDataStruct &modelData) {
+    CPU_PROFILE_SCOPE("BakedAssets::readModel");
+    FileDataStruct fileData;
+    const bool fileRead{VirtualFileSystem::readFile(filePath, fileData)};
+    BakedFileReaderStruct file{fileData.data, fileData.size};
+    BakedModelHeaderStruct header;
+    if(!fileRead || !readValues(file, &header, 1) || header.magic != bakedModelMagic || header.version != bakedAssetVersion) {
+        std::cerr << "Failed to Read Baked Model (Missing or Baked by Another Version): " << filePath << "\n";
+        return false;
+    }
+    modelData.boundingBox = BoundingBox{glm::vec3(header.boundingBoxMin[0], header.boundingBoxMin[1], header.boundingBoxMin[2]), glm::vec3(header.boundingBoxMax[0], header.boundingBoxMax[1], header.boundingBoxMax[2])};
+
+    // Textures (Counts Are Checked Against What's Left of The File so A Corrupt One Can't Make A Huge Allocation - Each Texture Has at Least Two String Lengths)
+    if(!hasRemaining<std::uint32_t[2]>(file, header.textureCount)) {
+        std::cerr << "Baked Model is Truncated: " << filePath << "\n";
+        return false;
+    }
+    modelData.textures.resize(header.textureCount);
+    for(ModelTextureDataStruct &texture : modelData.textures) {
+        if(!readString(file, texture.type) || !readString(file, texture.path)) {
+            std::cerr << "Baked Model is Truncated: " << filePath << "\n";
+            return false;
+        }
+    }
+
+    // Meshes - Dequantize Vertex Streams Into The Vertex Layout Meshes Upload
+    if(!hasRemaining<BakedMeshHeaderStruct>(file, header.meshCount)) {
+        std::cerr << "Baked Model is Truncated: " << filePath << "\n";
+        return false;
+    }
+    modelData.meshes.resize(header.meshCount);
+    std::vector<std::uint16_t> positions, shortIndices;
+    std::vector<std::uint32_t> normals, texCoords;
+    for(ModelMeshDataStruct &mesh : modelData.meshes) {
+        BakedMeshHeaderStruct meshHeader;
+        bool complete{readValues(file, &meshHeader, 1) && (meshHeader.indexSize == 2 || meshHeader.indexSize == 4)};
+        const std::uint64_t vertexBytes{sizeof(std::uint16_t) * 3 + sizeof(std::uint32_t) * 2};
+        complete = complete && hasRemaining<char>(file, (std::uint64_t)meshHeader.textureIndexCount * sizeof(unsigned int) + meshHeader.vertexCount * vertexBytes + (std::uint64_t)meshHeader.indexCount * meshHeader.indexSize);
+        if(complete) {
+            mesh.textureIndices.resize(meshHeader.textureIndexCount);
+            positions.resize((std::size_t)meshHeader.vertexCount * 3);
+            normals.resize(meshHeader.vertexCount);
+            texCoords.resize(meshHeader.vertexCount);
+            mesh.indices.resize(meshHeader.indexCount);
+            complete = readValues(file, mesh.textureIndices.data(), mesh.textureIndices.size()) && readValues(file, positions.data(), positions.size()) && readValues(file, normals.data(), normals.size()) && readValues(file, texCoords.data(), texCoords.size());
+        }
+        if(complete && meshHeader.indexSize == 2) {
+            shortIndices.resize(meshHeader.indexCount);
+            complete = readValues(file, shortIndices.data(), shortIndices.size());
+            std::copy(shortIndices.begin(), shortIndices.end(), mesh.indices.begin());
+        } else if(complete) {
+            complete = readValues(file, mesh.indices.data(), mesh.indices.size());
+        }
+        if(!complete) {
+            std::cerr << "Baked Model is Truncated: " << filePath << "\n";
+            return false;
+        }
+
+        // Indices Past The Mesh's Vertices or The Model's Textures Would Be Used Out of Range Later
+        const bool indicesValid{std::all_of(mesh.indices.begin(), mesh.indices.end(), [&meshHeader](const unsigned int &index) {return index < meshHeader.vertexCount;})};
+        const bool textureIndicesValid{std::all_of(mesh.textureIndices.begin(), mesh.textureIndices.end(), [&header](const unsigned int &textureIndex) {return textureIndex < header.textureCount;})};
+        if(!indicesValid || !textureIndicesValid) {
+            std::cerr << "Baked Model Has Out of Range Indices: " << filePath << "\n";
+            return false;
+        }
+        mesh.vertices.resize(meshHeader.vertexCount);
+        for(std::size_t i = 0; i < mesh.vertices.size(); i++) {
+            VertexStruct &vertex = mesh.vertices[i];
+            for(unsigned int axis = 0; axis < 3; axis++) vertex.vertexPos[axis] = meshHeader.positionMin[axis] + positions[i * 3 + axis] / 65535.0f * meshHeader.positionExtent[axis];
+            vertex.normalVec = decodeOctahedral(glm::unpackSnorm2x16(normals[i]));
+            vertex.texCords = glm::unpackHalf2x16(texCoords[i]);
+        }
+    }
+    return true;
+}
+
+// Write A Baked Texture
+bool BakedAssets::writeTexture(const std::string &filePath, const TextureImageStruct &image) {
+    if(image.compressedFormat == 0) return false;
+    const std::string temporaryFilePath{filePath + ".tmp"};
+    std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+    if(!file) {
+        std::cerr << "Failed to Write Baked File: " << filePath << "\n";
+        return false;
+    }
+    BakedTextureHeaderStruct header;
+    header.width = image.width;
+    header.height = image.height;
+    header.channelCount = image.channelCount;
+    header.compressedFormat = image.compressedFormat;
+    header.mipLevelCount = image.mipLevelCount;
+    writeValues(file, &header, 1);
+    writeValues(file, image.pixels, BlockCompression::getImageBytes(image.compressedFormat, image.width, image.height, image.mipLevelCount));
+    return finishFile(file, temporaryFilePath, filePath);
+}
+
+// Read A Baked Texture
+bool BakedAssets::readTexture(const std::string &filePath, TextureImageStruct &image) {
+    CPU_PROFILE_SCOPE("BakedAssets::readTexture");
+    FileDataStruct fileData;
+    const bool fileRead{VirtualFileSystem::readFile(filePath, fileData)};
+    BakedFileReaderStruct file{fileData.data, fileData.size};
+    BakedTextureHeaderStruct header;
+    if(!fileRead || !readValues(file, &header, 1) || header.magic != bakedTextureMagic || header.version != bakedAssetVersion) return false;
+    if(header.width == 0 || header.height == 0 || header.mipLevelCount == 0 || header.mipLevelCount > BlockCompression::getMipLevelCount(header.width, header.height)) return false;
+    const std::size_t imageBytes{BlockCompression::getImageBytes(header.compressedFormat, header.width, header.height, header.mipLevelCount)};
+
+    // Textures Stored Uncompressed in A Mounted Archive Upload Straight From The Mapping
+    if(fileData.isMapped()) {
+        if(file.size - file.position < imageBytes) return false;
+        image = TextureImageStruct{(unsigned char*)file.data + file.position, (int)header.width, (int)header.height, (int)header.channelCount, (GLenum)header.compressedFormat, header.mipLevelCount, false};
+        return true;
+    }
+    if(file.size - file.position < imageBytes) return false;
+    unsigned char *blocks{(unsigned char*)std::malloc(imageBytes)};
+    if(blocks == nullptr || !readValues(file, blocks, imageBytes)) {
+        std::free(blocks);
+        return false;
+    }
+    image = TextureImageStruct{blocks, (int)header.width, (int)header.height, (int)header.channelCount, (GLenum)header.compressedFormat, header.mipLevelCount};
+    return true;
+}
+
+// Renumber A Mesh's Vertices in The Order Its Indices First Use Them
+void BakedAssets::optimizeVertexFetch(ModelMeshDataStruct &mesh) {
+    std::vector<unsigned int> remap(mesh.vertices.size(), ~0u);
+    std::vector<VertexStruct> vertices;
+    vertices.reserve(mesh.vertices.size());
+    for(unsigned int &index : mesh.indices) {
+        if(remap[index] == ~0u) {
+            remap[index] = vertices.size();
+            vertices.push_back(mesh.vertices[index]);
+        }
+        index = remap[index];
+    }
+    mesh.vertices.swap(vertices);
+}
+
+// Check What Kind of File A Path Names
+static bool hasExtension(const std::string &filePath, const std::string &extension) {
+    return filePath.size() >= extension.size() && filePath.compare(filePath.size() - extension.size(), extension.size(), extension) == 0;
+}
+bool BakedAssets::isBakedModel(const std::string &filePath) {
+    return hasExtension(filePath, bakedModelExtension);
+}
+bool BakedAssets::isBakedTexture(const std::string &filePath) {
+    return hasExtension(filePath, bakedTextureExtension);
+}
+bool BakedAssets::isImageFile(const std::string &filePath) {
+    std::string extension{std::filesystem::path(filePath).extension().string()};
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](const unsigned char character) {return std::tolower(character);});
+    return extension == ".jpg" || extension == ".jpeg" || extension == ".png" || extension == ".tga" || extension == ".bmp";
+}
+
+// Name A Source File is Baked Under
+std::string BakedAssets::getBakedFilePath(const std::string &sourceFilePath) {
+    return sourceFilePath + (isImageFile(sourceFilePath) ? bakedTextureExtension : bakedModelExtension);
+}
+
+// Path to Load An Asset From
+std::string BakedAssets::resolvePath(const std::string &sourceDirectory, const std::string &bakedDirectory, const std::string &relativePath) {
+    const std::string bakedFilePath{bakedDirectory + getBakedFilePath(relativePath)};
+    return VirtualFileSystem::exists(bakedFilePath) ? bakedFilePath : sourceDirectory + relativePath;
+}
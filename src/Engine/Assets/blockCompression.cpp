@@ -0,0 +1,236 @@
+#include"BlockCompression.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<vector>
+#include<cstdint>
+#include<cstdlib>
+#include<cstring>
+#include<algorithm>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"../Jobs/JobSystem.hpp"
+
+// BC7 Interpolation Weights For 4 Bit Indices (Symmetric - Weight 15 - i is 64 Minus Weight i)
+static const unsigned int bc7Weights[16]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Writes Fields Into A Block From Its Lowest Bit Up
+struct BlockWriterStruct {
+    unsigned char *block;
+    unsigned int bit{0};
+    void write(const unsigned int &value, const unsigned int &bitCount) {
+        for(unsigned int i = 0; i < bitCount; i++, this->bit++) {
+            if((value >> i) & 1) this->block[this->bit >> 3] |= (unsigned char)(1 << (this->bit & 7));
+        }
+    }
+};
+
+// Compress A 4x4 Block of RGBA Texels Into A BC7 Mode 6 Block
+static void compressBlockBC7(const unsigned char texels[16][4], unsigned char block[16]) {
+    // Endpoints Span The Block's Colors Along Their Principal Axis (Power Iteration on The Covariance Matrix)
+    glm::vec4 colors[16], mean{0.0f}, minColor{255.0f}, maxColor{0.0f};
+    for(unsigned int i = 0; i < 16; i++) {
+        colors[i] = glm::vec4(texels[i][0], texels[i][1], texels[i][2], texels[i][3]);
+        mean += colors[i];
+        minColor = glm::min(minColor, colors[i]);
+        maxColor = glm::max(maxColor, colors[i]);
+    }
+    mean /= 16.0f;
+    glm::mat4 covariance{0.0f};
+    for(const glm::vec4 &color : colors) covariance += glm::outerProduct(color - mean, color - mean);
+    glm::vec4 axis{maxColor - minColor};
+    for(unsigned int iteration = 0; iteration < 8 && glm::dot(axis, axis) > 0.0f; iteration++) axis = glm::normalize(covariance * axis);
+    float minProjection{0.0f}, maxProjection{0.0f};
+    for(const glm::vec4 &color : colors) {
+        minProjection = std::min(minProjection, glm::dot(color - mean, axis));
+        maxProjection = std::max(maxProjection, glm::dot(color - mean, axis));
+    }
+    const glm::vec4 endpoints[2]{glm::clamp(mean + axis * minProjection, 0.0f, 255.0f), glm::clamp(mean + axis * maxProjection, 0.0f, 255.0f)};
+
+    // Quantize Endpoints to 7 Bits Per Channel Plus A Shared Low Bit (P-Bit), Keeping Whichever P-Bit Lands Closer
+    unsigned int quantized[2][4], pBits[2];
+    for(unsigned int endpoint = 0; endpoint < 2; endpoint++) {
+        float bestError{-1.0f};
+        for(unsigned int pBit = 0; pBit < 2; pBit++) {
+            unsigned int candidate[4];
+            float error{0.0f};
+            for(unsigned int channel = 0; channel < 4; channel++) {
+                candidate[channel] = (unsigned int)std::clamp((int)std::lround((endpoints[endpoint][channel] - pBit) / 2.0f), 0, 127);
+                const float difference{(float)((candidate[channel] << 1) | pBit) - endpoints[endpoint][channel]};
+                error += difference * difference;
+            }
+            if(bestError >= 0.0f && error >= bestError) continue;
+            bestError = error;
+            std::memcpy(quantized[endpoint], candidate, sizeof(candidate));
+            pBits[endpoint] = pBit;
+        }
+    }
+
+    // Pick Each Texel's Closest Interpolated Color
+    unsigned int palette[16][4], indices[16];
+    for(unsigned int i = 0; i < 16; i++) {
+        for(unsigned int channel = 0; channel < 4; channel++) {
+            const unsigned int endpoint0{(quantized[0][channel] << 1) | pBits[0]}, endpoint1{(quantized[1][channel] << 1) | pBits[1]};
+            palette[i][channel] = ((64 - bc7Weights[i]) * endpoint0 + bc7Weights[i] * endpoint1 + 32) >> 6;
+        }
+    }
+    for(unsigned int i = 0; i < 16; i++) {
+        unsigned int bestError{~0u};
+        for(unsigned int index = 0; index < 16; index++) {
+            unsigned int error{0};
+            for(unsigned int channel = 0; channel < 4; channel++) {
+                const int difference{(int)palette[index][channel] - (int)texels[i][channel]};
+                error += difference * difference;
+            }
+            if(error >= bestError) continue;
+            bestError = error;
+            indices[i] = index;
+        }
+    }
+
+    // The First Texel's Index is Stored Without Its Top Bit - Swap The Endpoints (Mirroring Every Index) if it's Set
+    if(indices[0] & 8) {
+        std::swap(quantized[0], quantized[1]);
+        std::swap(pBits[0], pBits[1]);
+        for(unsigned int &index : indices) index = 15 - index;
+    }
+
+    // Pack Mode 6 (Mode Bit, Endpoints Channel by Channel, P-Bits, Indices)
+    std::memset(block, 0, 16);
+    BlockWriterStruct writer{block};
+    writer.write(1 << 6, 7);
+    for(unsigned int channel = 0; channel < 4; channel++) {
+        writer.write(quantized[0][channel], 7);
+        writer.write(quantized[1][channel], 7);
+    }
+    writer.write(pBits[0], 1);
+    writer.write(pBits[1], 1);
+    writer.write(indices[0], 3);
+    for(unsigned int i = 1; i < 16; i++) writer.write(indices[i], 4);
+}
+
+// Compress A 4x4 Block of Single Channel Texels Into A BC4 Block (8 Interpolated Values Between The Block's Extremes)
+static void compressBlockBC4(const unsigned char values[16], unsigned char block[8]) {
+    const unsigned char maxValue{*std::max_element(values, values + 16)}, minValue{*std::min_element(values, values + 16)};
+    unsigned int palette[8]{maxValue, minValue};
+    for(unsigned int i = 2; i < 8; i++) palette[i] = ((8 - i) * maxValue + (i - 1) * minValue) / 7;
+    std::uint64_t indexBits{0};
+    for(unsigned int i = 0; i < 16 && maxValue != minValue; i++) {
+        unsigned int bestIndex{0}, bestError{~0u};
+        for(unsigned int index = 0; index < 8; index++) {
+            const unsigned int error{(unsigned int)std::abs((int)palette[index] - (int)values[i])};
+            if(error >= bestError) continue;
+            bestError = error;
+            bestIndex = index;
+        }
+        indexBits |= (std::uint64_t)bestIndex << (i * 3);
+    }
+    block[0] = maxValue;
+    block[1] = minValue;
+    for(unsigned int i = 0; i < 6; i++) block[2 + i] = (unsigned char)(indexBits >> (i * 8));
+}
+
+// Half The Size of A Mip Level With A 2x2 Box Filter (Odd Edges Repeat Their Last Texel)
+static void downsample(const std::vector<unsigned char> &level, const unsigned int &width, const unsigned int &height, const unsigned int &channelCount, std::vector<unsigned char> &nextLevel) {
+    const unsigned int nextWidth{std::max(width / 2, 1u)}, nextHeight{std::max(height / 2, 1u)};
+    nextLevel.resize((std::size_t)nextWidth * nextHeight * channelCount);
+    for(unsigned int y = 0; y < nextHeight; y++) {
+        const std::size_t row0{(std::size_t)std::min(y * 2, height - 1) * width}, row1{(std::size_t)std::min(y * 2 + 1, height - 1) * width};
+        for(unsigned int x = 0; x < nextWidth; x++) {
+            const std::size_t column0{std::min(x * 2, width - 1)}, column1{std::min(x * 2 + 1, width - 1)};
+            for(unsigned int channel = 0; channel < channelCount; channel++) {
+                const unsigned int sum{(unsigned int)level[(row0 + column0) * channelCount + channel] + level[(row0 + column1) * channelCount + channel] + level[(row1 + column0) * channelCount + channel] + level[(row1 + column1) * channelCount + channel]};
+                nextLevel[((std::size_t)y * nextWidth + x) * channelCount + channel] = (unsigned char)((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+// Compress One Mip Level (Block Rows Are Compressed in Parallel)
+static void compressMipLevel(const std::vector<unsigned char> &level, const unsigned int &width, const unsigned int &height, const unsigned int &channelCount, const GLenum &compressedFormat, unsigned char *blocks) {
+    const unsigned int blockCountX{(width + 3) / 4}, blockCountY{(height + 3) / 4};
+    const std::size_t blockBytes{compressedFormat == GL_COMPRESSED_RED_RGTC1 ? 8u : 16u};
+    JobSystem::parallelFor(blockCountY, 4, [&](const std::size_t firstBlockRow, const std::size_t lastBlockRow) {
+        for(std::size_t blockY = firstBlockRow; blockY < lastBlockRow; blockY++) {
+            for(unsigned int blockX = 0; blockX < blockCountX; blockX++) {
+                // Gather The Block's Texels as RGBA (Missing Channels Are 0, Missing Alpha is Opaque)
+                unsigned char texels[16][4];
+                for(unsigned int i = 0; i < 16; i++) {
+                    const std::size_t x{std::min(blockX * 4 + i % 4, width - 1)}, y{std::min<std::size_t>(blockY * 4 + i / 4, height - 1)};
+                    const unsigned char *texel{&level[(y * width + x) * channelCount]};
+                    for(unsigned int channel = 0; channel < 4; channel++) texels[i][channel] = channel < channelCount ? texel[channel] : (channel == 3 ? 255 : 0);
+                }
+
+                // Compress it
+                unsigned char *block{blocks + (blockY * blockCountX + blockX) * blockBytes};
+                if(compressedFormat == GL_COMPRESSED_RGBA_BPTC_UNORM) {
+                    compressBlockBC7(texels, block);
+                } else {
+                    for(unsigned int channel = 0; channel < blockBytes / 8; channel++) {
+                        unsigned char values[16];
+                        for(unsigned int i = 0; i < 16; i++) values[i] = texels[i][channel];
+                        compressBlockBC4(values, block + channel * 8);
+                    }
+                }
+            }
+        }
+    }, "Block Compression");
+}
+
+// Compress An Uncompressed Image and Its Generated Mip Chain
+bool BlockCompression::compress(const TextureImageStruct &image, TextureImageStruct &compressedImage) {
+    if(image.pixels == nullptr || image.compressedFormat != 0 || image.width <= 0 || image.height <= 0 || image.channelCount < 1 || image.channelCount > 4) return false;
+    const unsigned int width{(unsigned int)image.width}, height{(unsigned int)image.height}, channelCount{(unsigned int)image.channelCount};
+    const GLenum compressedFormat{getCompressedFormat(image.channelCount)};
+    const unsigned int mipLevelCount{getMipLevelCount(width, height)};
+    unsigned char *blocks{(unsigned char*)std::malloc(getImageBytes(compressedFormat, width, height, mipLevelCount))};
+    if(blocks == nullptr) return false;
+
+    // Compress Each Level Then Filter it Down to The Next
+    std::vector<unsigned char> level(image.pixels, image.pixels + (std::size_t)width * height * channelCount), nextLevel;
+    std::size_t offset{0};
+    for(unsigned int mipLevel = 0; mipLevel < mipLevelCount; mipLevel++) {
+        const unsigned int levelWidth{std::max(width >> mipLevel, 1u)}, levelHeight{std::max(height >> mipLevel, 1u)};
+        compressMipLevel(level, levelWidth, levelHeight, channelCount, compressedFormat, blocks + offset);
+        offset += getMipLevelBytes(compressedFormat, width, height, mipLevel);
+        if(mipLevel + 1 < mipLevelCount) {
+            downsample(level, levelWidth, levelHeight, channelCount, nextLevel);
+            level.swap(nextLevel);
+        }
+    }
+    compressedImage = TextureImageStruct{blocks, image.width, image.height, image.channelCount, compressedFormat, mipLevelCount};
+    return true;
+}
+
+// Compressed Format Used For An Image With channelCount Channels
+GLenum BlockCompression::getCompressedFormat(const int &channelCount) {
+    switch(channelCount) {
+        case 1:
+            return GL_COMPRESSED_RED_RGTC1;
+        case 2:
+            return GL_COMPRESSED_RG_RGTC2;
+        default:
+            return GL_COMPRESSED_RGBA_BPTC_UNORM;
+    }
+}
+
+// Bytes of One Mip Level
+std::size_t BlockCompression::getMipLevelBytes(const GLenum &compressedFormat, const unsigned int &width, const unsigned int &height, const unsigned int &mipLevel) {
+    const std::size_t levelWidth{std::max(width >> mipLevel, 1u)}, levelHeight{std::max(height >> mipLevel, 1u)};
+    return (levelWidth + 3) / 4 * ((levelHeight + 3) / 4) * (compressedFormat == GL_COMPRESSED_RED_RGTC1 ? 8 : 16);
+}
+
+// Bytes of Every Mip Level
+std::size_t BlockCompression::getImageBytes(const GLenum &compressedFormat, const unsigned int &width, const unsigned int &height, const unsigned int &mipLevelCount) {
+    std::size_t bytes{0};
+    for(unsigned int mipLevel = 0; mipLevel < mipLevelCount; mipLevel++) bytes += getMipLevelBytes(compressedFormat, width, height, mipLevel);
+    return bytes;
+}
+
+// Mip Levels in A Full Chain Down to 1x1
+unsigned int BlockCompression::getMipLevelCount(const unsigned int &width, const unsigned int &height) {
+    return (unsigned int)std::floor(std::log2(std::max(std::max(width, height), 1u))) + 1;
+}
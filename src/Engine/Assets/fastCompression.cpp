@@ -0,0 +1,134 @@
+#include"FastCompression.hpp"
+
+// Standard Headers
+#include<vector>
+#include<cstdint>
+#include<cstring>
+#include<algorithm>
+
+// LZ4 Block Limits - Matches Are At Least 4 Bytes, The Last 5 Bytes Are Always Literals and No Match Starts Within The Last 12 Bytes
+const std::size_t minMatchBytes{4}, lastLiteralBytes{5}, matchFindLimitBytes{12}, maxMatchOffset{65535};
+const unsigned int hashTableBits{16};
+
+// Read 4 Bytes (Unaligned)
+static std::uint32_t read32(const unsigned char *bytes) {
+    std::uint32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+// Hash Table Slot of A 4 Byte Sequence
+static std::uint32_t hashSequence(const std::uint32_t &sequence) {
+    return (sequence * 2654435761u) >> (32 - hashTableBits);
+}
+
+// Write A Length's Extra Bytes (Lengths Past The Token's 15 Continue in 255 Steps)
+static unsigned char* writeLength(unsigned char *output, std::size_t length) {
+    for(; length >= 255; length -= 255) *output++ = 255;
+    *output++ = (unsigned char)length;
+    return output;
+}
+
+// Worst Case Compressed Size
+std::size_t FastCompression::getMaxCompressedBytes(const std::size_t &sourceBytes) {
+    return sourceBytes + sourceBytes / 255 + 16;
+}
+
+// Compress A Buffer
+std::size_t FastCompression::compress(const unsigned char *source, const std::size_t &sourceBytes, unsigned char *destination, const std::size_t &destinationCapacity) {
+    unsigned char *output{destination}, *const outputEnd{destination + destinationCapacity};
+
+    // Emit One Sequence - Literals Then A Match (matchBytes 0 Ends The Block With Literals Only)
+    const auto emitSequence = [&](const unsigned char *literals, const std::size_t &literalBytes, const std::size_t &offset, const std::size_t &matchBytes) {
+        if((std::size_t)(outputEnd - output) < 1 + literalBytes / 255 + 1 + literalBytes + 2 + matchBytes / 255 + 1) return false;
+        unsigned char &token = *output++;
+        token = (unsigned char)(std::min<std::size_t>(literalBytes, 15) << 4);
+        if(literalBytes >= 15) output = writeLength(output, literalBytes - 15);
+        std::memcpy(output, literals, literalBytes);
+        output += literalBytes;
+        if(matchBytes == 0) return true;
+        *output++ = (unsigned char)(offset & 0xFF);
+        *output++ = (unsigned char)(offset >> 8);
+        token |= (unsigned char)std::min<std::size_t>(matchBytes - minMatchBytes, 15);
+        if(matchBytes - minMatchBytes >= 15) output = writeLength(output, matchBytes - minMatchBytes - 15);
+        return true;
+    };
+
+    // Greedy Match Search (Candidates Are Checked Byte For Byte so Hash Collisions Are Harmless)
+    std::size_t anchor{0};
+    if(sourceBytes > matchFindLimitBytes) {
+        std::vector<std::uint32_t> hashTable((std::size_t)1 << hashTableBits, 0);
+        const std::size_t matchFindEnd{sourceBytes - matchFindLimitBytes}, matchEnd{sourceBytes - lastLiteralBytes};
+        std::size_t position{1};
+        while(position < matchFindEnd) {
+            const std::uint32_t sequence{read32(source + position)};
+            std::uint32_t &slot = hashTable[hashSequence(sequence)];
+            std::size_t candidate{slot};
+            slot = (std::uint32_t)position;
+            if(position - candidate > maxMatchOffset || read32(source + candidate) != sequence) {
+                position++;
+                continue;
+            }
+
+            // Extend The Match Forwards Then Backwards Over Pending Literals
+            std::size_t end{position + minMatchBytes};
+            while(end < matchEnd && source[end] == source[candidate + end - position]) end++;
+            while(position > anchor && candidate > 0 && source[position - 1] == source[candidate - 1]) {
+                position--;
+                candidate--;
+            }
+            if(!emitSequence(source + anchor, position - anchor, position - candidate, end - position)) return 0;
+            position = anchor = end;
+        }
+    }
+
+    // Trailing Literals
+    if(!emitSequence(source + anchor, sourceBytes - anchor, 0, 0)) return 0;
+    return output - destination;
+}
+
+// Decompress A Buffer
+bool FastCompression::decompress(const unsigned char *source, const std::size_t &sourceBytes, unsigned char *destination, const std::size_t &destinationBytes) {
+    const unsigned char *input{source}, *const inputEnd{source + sourceBytes};
+    unsigned char *output{destination}, *const outputEnd{destination + destinationBytes};
+
+    // Read A Length's Extra Bytes
+    const auto readLength = [&](std::size_t &length) {
+        unsigned char extra{255};
+        while(extra == 255) {
+            if(input >= inputEnd) return false;
+            extra = *input++;
+            length += extra;
+        }
+        return true;
+    };
+
+    while(input < inputEnd) {
+        // Literals
+        const unsigned char token{*input++};
+        std::size_t literalBytes{(std::size_t)token >> 4};
+        if(literalBytes == 15 && !readLength(literalBytes)) return false;
+        if((std::size_t)(inputEnd - input) < literalBytes || (std::size_t)(outputEnd - output) < literalBytes) return false;
+        std::memcpy(output, input, literalBytes);
+        input += literalBytes;
+        output += literalBytes;
+        if(input == inputEnd) break;
+
+        // Match (Copied A Byte at A Time When it Overlaps Its Own Output, Which is How Runs Are Encoded)
+        if(inputEnd - input < 2) return false;
+        const std::size_t offset{(std::size_t)input[0] | (std::size_t)input[1] << 8};
+        input += 2;
+        std::size_t matchBytes{(std::size_t)token & 15};
+        if(matchBytes == 15 && !readLength(matchBytes)) return false;
+        matchBytes += minMatchBytes;
+        if(offset == 0 || offset > (std::size_t)(output - destination) || (std::size_t)(outputEnd - output) < matchBytes) return false;
+        const unsigned char *match{output - offset};
+        if(offset >= matchBytes) {
+            std::memcpy(output, match, matchBytes);
+            output += matchBytes;
+        } else {
+            for(std::size_t i = 0; i < matchBytes; i++) *output++ = *match++;
+        }
+    }
+    return output == outputEnd;
+}
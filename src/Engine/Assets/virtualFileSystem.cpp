@@ -0,0 +1,149 @@
+#include"VirtualFileSystem.hpp"
+
+// Standard Headers
+#include<mutex>
+#include<atomic>
+#include<memory>
+#include<fstream>
+#include<sstream>
+#include<iomanip>
+#include<iostream>
+#include<filesystem>
+
+// Custom Engine Headers
+#include"AssetArchive.hpp"
+#include"../Profiler/CPUProfiler.hpp"
+
+// Mounted Archive (mountPath is Normalized With A Trailing Slash, or Empty to Hold Every Relative Path)
+struct MountedArchiveStruct {
+    std::string mountPath;
+    std::unique_ptr<AssetArchive> archive;
+};
+
+// Mounted Archives (Searched Last Mounted First)
+static std::mutex mountMutex;
+static std::vector<MountedArchiveStruct> mountedArchives;
+
+// Read Counters
+static std::atomic<std::uint64_t> archiveReads{0}, mappedReads{0}, looseReads{0}, failedReads{0};
+static std::atomic<std::uint64_t> archiveBytes{0}, decompressedBytes{0}, looseBytes{0};
+
+// Find A Normalized Path's Archive Entry
+static const AssetArchiveEntryStruct* findArchiveEntry(const std::string &filePath, const AssetArchive *&archive) {
+    for(auto mountedArchive = mountedArchives.rbegin(); mountedArchive != mountedArchives.rend(); mountedArchive++) {
+        if(filePath.compare(0, mountedArchive->mountPath.size(), mountedArchive->mountPath) != 0) continue;
+        const AssetArchiveEntryStruct *entry{mountedArchive->archive->findEntry(filePath.substr(mountedArchive->mountPath.size()))};
+        if(entry != nullptr) {
+            archive = mountedArchive->archive.get();
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+// Mount An Archive
+bool VirtualFileSystem::mountArchive(const std::string &archiveFilePath, const std::string &mountPath) {
+    std::unique_ptr<AssetArchive> archive{std::make_unique<AssetArchive>()};
+    if(!archive->open(archiveFilePath)) return false;
+    std::string normalizedMountPath{normalizePath(mountPath)};
+    if(normalizedMountPath == ".") normalizedMountPath.clear();
+    if(!normalizedMountPath.empty() && normalizedMountPath.back() != '/') normalizedMountPath += '/';
+    std::lock_guard<std::mutex> lock(mountMutex);
+    mountedArchives.push_back(MountedArchiveStruct{normalizedMountPath, std::move(archive)});
+    return true;
+}
+
+// Unmount Every Archive
+void VirtualFileSystem::unmountAll(void) {
+    std::lock_guard<std::mutex> lock(mountMutex);
+    mountedArchives.clear();
+}
+
+// Read A Whole File
+bool VirtualFileSystem::readFile(const std::string &filePath, FileDataStruct &fileData) {
+    CPU_PROFILE_SCOPE("VirtualFileSystem::readFile");
+    fileData = FileDataStruct{};
+    const std::string normalizedFilePath{normalizePath(filePath)};
+
+    // Archive Entries - Stored Ones Are Handed Out Without A Copy
+    const AssetArchive *archive{nullptr};
+    const AssetArchiveEntryStruct *entry{findArchiveEntry(normalizedFilePath, archive)};
+    if(entry != nullptr) {
+        archiveReads++;
+        archiveBytes += entry->storedBytes;
+        if(entry->compression == ASSET_ARCHIVE_STORED && entry->bytes > 0) {
+            mappedReads++;
+            fileData.data = archive->getStoredData(*entry);
+            fileData.size = entry->bytes;
+            return true;
+        }
+        fileData.storage.resize(entry->bytes);
+        if(!archive->extract(*entry, fileData.storage.data())) {
+            std::cerr << "Corrupt Asset Archive Entry: " << normalizedFilePath << "\n";
+            failedReads++;
+            fileData = FileDataStruct{};
+            return false;
+        }
+        decompressedBytes += entry->bytes;
+        fileData.data = fileData.storage.data();
+        fileData.size = fileData.storage.size();
+        return true;
+    }
+
+    // Loose Files
+    std::ifstream looseFile(normalizedFilePath, std::ios::binary | std::ios::ate);
+    if(!looseFile) {
+        failedReads++;
+        return false;
+    }
+    fileData.storage.resize((std::size_t)looseFile.tellg());
+    looseFile.seekg(0, std::ios::beg);
+    if(!looseFile.read((char*)fileData.storage.data(), fileData.storage.size())) {
+        failedReads++;
+        fileData = FileDataStruct{};
+        return false;
+    }
+    looseReads++;
+    looseBytes += fileData.storage.size();
+    fileData.data = fileData.storage.data();
+    fileData.size = fileData.storage.size();
+    return true;
+}
+
+// Check if A File Exists
+bool VirtualFileSystem::exists(const std::string &filePath) {
+    const std::string normalizedFilePath{normalizePath(filePath)};
+    const AssetArchive *archive{nullptr};
+    if(findArchiveEntry(normalizedFilePath, archive) != nullptr) return true;
+    std::error_code error;
+    return std::filesystem::is_regular_file(normalizedFilePath, error);
+}
+
+// Lexically Normalized Path
+std::string VirtualFileSystem::normalizePath(const std::string &filePath) {
+    return std::filesystem::path(filePath).lexically_normal().generic_string();
+}
+
+// Stats
+VirtualFileSystemStatsStruct VirtualFileSystem::getStats(void) {
+    VirtualFileSystemStatsStruct stats;
+    stats.archiveReads = archiveReads;
+    stats.mappedReads = mappedReads;
+    stats.looseReads = looseReads;
+    stats.failedReads = failedReads;
+    stats.archiveBytes = archiveBytes;
+    stats.decompressedBytes = decompressedBytes;
+    stats.looseBytes = looseBytes;
+    std::lock_guard<std::mutex> lock(mountMutex);
+    stats.mountedArchiveCount = mountedArchives.size();
+    return stats;
+}
+std::string VirtualFileSystem::getStatsReport(void) {
+    const VirtualFileSystemStatsStruct stats{getStats()};
+    const double bytesPerMB{1024.0 * 1024.0};
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << stats.mountedArchiveCount << " Archives Mounted | Archive Reads " << stats.archiveReads << " (" << stats.mappedReads << " Mapped, " << stats.archiveBytes / bytesPerMB << "MB Stored, " << stats.decompressedBytes / bytesPerMB << "MB Decompressed)";
+    report << " | Loose Reads " << stats.looseReads << " (" << stats.looseBytes / bytesPerMB << "MB) | " << stats.failedReads << " Failed";
+    return report.str();
+}
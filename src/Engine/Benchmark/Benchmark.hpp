@@ -0,0 +1,69 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<chrono>
+#include<cstdint>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Custom Engine Headers
+#include"../Renderer/DrawStats.hpp"
+
+// Summary Statistics of A Benchmark Measurement
+struct BenchmarkStatsStruct {
+    double average{0.0}, min{0.0}, max{0.0}, p50{0.0}, p95{0.0}, p99{0.0};
+};
+
+// Benchmark Class - Records Frame, CPU and GPU Times, Draw Counts and Memory Over A Fixed Number of Frames and Writes Them as JSON
+// Warm Up Frames (Shader Compilation, Shadow Cache Fills, Pool Allocations) Are Rendered but Not Measured
+class Benchmark {
+    public:
+        // Number of Frames Whose Timestamp Queries Can Be in Flight
+        static constexpr unsigned int queryFrameCount{4};
+
+        // Constructor - Create Timestamp Queries
+        Benchmark(const unsigned int &warmupFrameCount, const unsigned int &measuredFrameCount);
+
+        // Bracket A Frame - endFrame Takes The Frame's Draw Statistics
+        void beginFrame(void);
+        void endFrame(const DrawStatsStruct &drawStats);
+
+        // Record A Memory Measurement in Bytes (The Report Keeps The Peak of Every Name)
+        void recordMemory(const char *name, const std::uint64_t &bytes);
+
+        // Write The Report as JSON (Waits For The Last Frames' GPU Times First)
+        bool writeReport(const std::string &filePath, const std::string &sceneName, const unsigned int &width, const unsigned int &height);
+
+        // Summary Statistics of A Set of Samples (Percentiles Use The Nearest Rank)
+        static BenchmarkStatsStruct computeStats(std::vector<double> samples);
+
+        // Getters
+        bool isMeasuring(void) {return this->frameIndex >= this->warmupFrameCount;}
+        bool isFinished(void) {return this->frameIndex >= this->warmupFrameCount + this->measuredFrameCount;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Frame Counts
+        unsigned int warmupFrameCount, measuredFrameCount, frameIndex{0};
+
+        // Samples of Measured Frames
+        std::vector<double> frameTimesMs, cpuTimesMs, gpuTimesMs, drawCallCounts, triangleCounts;
+
+        // Peak Memory Measurements
+        std::vector<std::pair<std::string, std::uint64_t>> memoryPeaks;
+
+        // CPU Timing
+        std::chrono::steady_clock::time_point frameStartTime, lastFrameStartTime;
+        bool hasLastFrameStartTime{false};
+
+        // GPU Frame Start and End Timestamp Queries (And Whether Each Frame is Measured)
+        GLuint startQueries[queryFrameCount], endQueries[queryFrameCount];
+        bool queryPending[queryFrameCount]{}, queryMeasured[queryFrameCount]{};
+
+        // Read A Frame's GPU Time (Waits For The GPU)
+        void readQuery(const unsigned int &slot);
+};
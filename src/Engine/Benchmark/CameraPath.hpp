@@ -0,0 +1,40 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"../Camera/Camera.hpp"
+
+// Camera Path Keyframe - Where The Camera is at A Time (Yaw and Pitch in Degrees)
+struct CameraKeyframeStruct {
+    float time{0.0f};
+    glm::vec3 position{0.0f};
+    float yaw{-90.0f}, pitch{0.0f};
+};
+
+// Camera Path Class - A Catmull-Rom Spline Through Keyframes That Drives A Camera Without Any Input (Benchmarks and Scripted Renders)
+class CameraPath {
+    public:
+        // Constructor - Keyframes Must Be Sorted by Time
+        CameraPath(const std::vector<CameraKeyframeStruct> &keyframes);
+
+        // Load Keyframes From A Text File (One "time x y z yaw pitch" Line Per Keyframe, Lines Starting With # Are Comments)
+        bool loadFromFile(const std::string &filePath);
+
+        // Camera Pose at A Time (Clamped to The Path's Duration)
+        CameraKeyframeStruct sample(const float &time);
+
+        // Move A Camera to Its Pose at A Time
+        void apply(Camera &camera, const float &time);
+
+        // Getters
+        float getDuration(void) {return this->keyframes.empty() ? 0.0f : this->keyframes.back().time;}
+    private:
+        // Keyframes
+        std::vector<CameraKeyframeStruct> keyframes;
+};
@@ -0,0 +1,156 @@
+#include"Benchmark.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<fstream>
+#include<iostream>
+#include<algorithm>
+
+// Resource Usage
+#include<sys/resource.h>
+#include<unistd.h>
+
+// Custom Engine Headers
+#include"../Profiler/JSONEscape.hpp"
+
+// Current Resident Memory of The Process in Bytes (Linux Only, 0 Elsewhere)
+static std::uint64_t getResidentBytes(void) {
+    std::ifstream statmFile("/proc/self/statm");
+    std::uint64_t totalPages{0}, residentPages{0};
+    if(!(statmFile >> totalPages >> residentPages)) return 0;
+    return residentPages * (std::uint64_t)sysconf(_SC_PAGESIZE);
+}
+
+// Write A Stats Object
+static void writeStats(std::ofstream &reportFile, const std::string &name, const BenchmarkStatsStruct &stats) {
+    reportFile << "  \"" << name << "\": {\"average\": " << stats.average << ", \"min\": " << stats.min << ", \"max\": " << stats.max
+               << ", \"p50\": " << stats.p50 << ", \"p95\": " << stats.p95 << ", \"p99\": " << stats.p99 << "},\n";
+}
+
+// Constructor - Create Timestamp Queries and Size The Sample Lists Up Front (Measured Frames Don't Allocate)
+Benchmark::Benchmark(const unsigned int &warmupFrameCount, const unsigned int &measuredFrameCount) {
+    this->warmupFrameCount = warmupFrameCount;
+    this->measuredFrameCount = measuredFrameCount;
+    for(std::vector<double> *samples : {&this->frameTimesMs, &this->cpuTimesMs, &this->gpuTimesMs, &this->drawCallCounts, &this->triangleCounts}) samples->reserve(measuredFrameCount);
+    glGenQueries(queryFrameCount, this->startQueries);
+    glGenQueries(queryFrameCount, this->endQueries);
+}
+
+// Begin A Frame
+void Benchmark::beginFrame(void) {
+    // Read The Oldest Frame's GPU Time Before Reusing Its Queries
+    const unsigned int slot{this->frameIndex % queryFrameCount};
+    if(this->queryPending[slot]) this->readQuery(slot);
+
+    // Frame Time is Measured Between Frame Starts, CPU Time From Here to endFrame
+    this->frameStartTime = std::chrono::steady_clock::now();
+    if(this->isMeasuring() && this->hasLastFrameStartTime) this->frameTimesMs.push_back(std::chrono::duration<double, std::milli>(this->frameStartTime - this->lastFrameStartTime).count());
+    this->lastFrameStartTime = this->frameStartTime;
+    this->hasLastFrameStartTime = true;
+
+    // GPU Frame Start
+    glQueryCounter(this->startQueries[slot], GL_TIMESTAMP);
+    this->queryMeasured[slot] = this->isMeasuring() && !this->isFinished();
+}
+
+// End A Frame
+void Benchmark::endFrame(const DrawStatsStruct &drawStats) {
+    // GPU Frame End
+    const unsigned int slot{this->frameIndex % queryFrameCount};
+    glQueryCounter(this->endQueries[slot], GL_TIMESTAMP);
+    this->queryPending[slot] = true;
+
+    // CPU Time and Draw Statistics
+    if(this->isMeasuring() && !this->isFinished()) {
+        this->cpuTimesMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->frameStartTime).count());
+        this->drawCallCounts.push_back(drawStats.drawCallCount);
+        this->triangleCounts.push_back((double)drawStats.triangleCount);
+    }
+    this->frameIndex++;
+}
+
+// Record A Memory Measurement
+void Benchmark::recordMemory(const char *name, const std::uint64_t &bytes) {
+    for(std::pair<std::string, std::uint64_t> &memoryPeak : this->memoryPeaks) {
+        if(memoryPeak.first == name) {
+            memoryPeak.second = std::max(memoryPeak.second, bytes);
+            return;
+        }
+    }
+    this->memoryPeaks.push_back({name, bytes});
+}
+
+// Read A Frame's GPU Time
+void Benchmark::readQuery(const unsigned int &slot) {
+    GLuint64 startTime{0}, endTime{0};
+    glGetQueryObjectui64v(this->startQueries[slot], GL_QUERY_RESULT, &startTime);
+    glGetQueryObjectui64v(this->endQueries[slot], GL_QUERY_RESULT, &endTime);
+    if(this->queryMeasured[slot]) this->gpuTimesMs.push_back((double)(endTime > startTime ? endTime - startTime : 0) / 1000000.0);
+    this->queryPending[slot] = false;
+}
+
+// Summary Statistics of A Set of Samples
+BenchmarkStatsStruct Benchmark::computeStats(std::vector<double> samples) {
+    BenchmarkStatsStruct stats;
+    if(samples.empty()) return stats;
+    std::sort(samples.begin(), samples.end());
+    for(const double &sample : samples) stats.average += sample;
+    stats.average /= samples.size();
+    stats.min = samples.front();
+    stats.max = samples.back();
+    const auto percentile = [&](const double &p) {return samples[std::clamp<std::size_t>((std::size_t)std::ceil(p / 100.0 * samples.size()), 1, samples.size()) - 1];};
+    stats.p50 = percentile(50.0);
+    stats.p95 = percentile(95.0);
+    stats.p99 = percentile(99.0);
+    return stats;
+}
+
+// Write The Report as JSON
+bool Benchmark::writeReport(const std::string &filePath, const std::string &sceneName, const unsigned int &width, const unsigned int &height) {
+    // Wait For Every Frame Still on The GPU
+    for(unsigned int slot = 0; slot < queryFrameCount; slot++) {
+        if(this->queryPending[slot]) this->readQuery(slot);
+    }
+
+    // Open Report File
+    std::ofstream reportFile(filePath);
+    if(!reportFile) {
+        std::cerr << "Failed to Write Benchmark Report: " << filePath << "\n";
+        return false;
+    }
+
+    // Peak Process Memory
+    struct rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+
+    // Run Description Then Every Measurement
+    const char* renderer = (const char*)glGetString(GL_RENDERER);
+    const char* version = (const char*)glGetString(GL_VERSION);
+    reportFile.precision(4);
+    reportFile << std::fixed << "{\n";
+    reportFile << "  \"scene\": \"" << escapeJSON(sceneName) << "\",\n";
+    reportFile << "  \"renderer\": \"" << escapeJSON(renderer ? renderer : "") << "\",\n";
+    reportFile << "  \"version\": \"" << escapeJSON(version ? version : "") << "\",\n";
+    reportFile << "  \"width\": " << width << ",\n  \"height\": " << height << ",\n";
+    reportFile << "  \"warmupFrames\": " << this->warmupFrameCount << ",\n  \"measuredFrames\": " << this->cpuTimesMs.size() << ",\n";
+    writeStats(reportFile, "frameTimeMs", computeStats(this->frameTimesMs));
+    writeStats(reportFile, "cpuTimeMs", computeStats(this->cpuTimesMs));
+    writeStats(reportFile, "gpuTimeMs", computeStats(this->gpuTimesMs));
+    writeStats(reportFile, "drawCalls", computeStats(this->drawCallCounts));
+    writeStats(reportFile, "triangles", computeStats(this->triangleCounts));
+    reportFile << "  \"memoryBytes\": {\"resident\": " << getResidentBytes() << ", \"peakResident\": " << (std::uint64_t)usage.ru_maxrss * 1024;
+    for(const std::pair<std::string, std::uint64_t> &memoryPeak : this->memoryPeaks) reportFile << ", \"" << escapeJSON(memoryPeak.first) << "\": " << memoryPeak.second;
+    reportFile << "}\n}\n";
+
+    // Print A Summary
+    const BenchmarkStatsStruct frameStats{computeStats(this->frameTimesMs)}, gpuStats{computeStats(this->gpuTimesMs)};
+    std::cout << "Benchmark Written: " << filePath << " (" << this->cpuTimesMs.size() << " Frames, Frame Time p50 " << frameStats.p50 << "ms / p99 " << frameStats.p99
+              << "ms, GPU Time p50 " << gpuStats.p50 << "ms / p99 " << gpuStats.p99 << "ms)" << std::endl;
+    return true;
+}
+
+// Destroy
+void Benchmark::destroy(void) {
+    glDeleteQueries(queryFrameCount, this->startQueries);
+    glDeleteQueries(queryFrameCount, this->endQueries);
+}
@@ -0,0 +1,81 @@
+#include"CameraPath.hpp"
+
+// Standard Headers
+#include<fstream>
+#include<sstream>
+#include<iostream>
+#include<algorithm>
+
+// Catmull-Rom Interpolation Between p1 and p2
+template<typename T> static T catmullRom(const T &p0, const T &p1, const T &p2, const T &p3, const float &t) {
+    const float t2{t * t}, t3{t2 * t};
+    return 0.5f * ((2.0f * p1) + (p2 - p0) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 + (3.0f * p1 - p0 - 3.0f * p2 + p3) * t3);
+}
+
+// Constructor
+CameraPath::CameraPath(const std::vector<CameraKeyframeStruct> &keyframes) {
+    this->keyframes = keyframes;
+}
+
+// Load Keyframes From A Text File
+bool CameraPath::loadFromFile(const std::string &filePath) {
+    // Open Camera Path File
+    std::ifstream pathFile(filePath);
+    if(!pathFile) {
+        std::cerr << "Failed to Open Camera Path: " << filePath << "\n";
+        return false;
+    }
+
+    // Read One Keyframe Per Line
+    std::vector<CameraKeyframeStruct> loadedKeyframes;
+    std::string line;
+    while(std::getline(pathFile, line)) {
+        if(line.empty() || line[0] == '#') continue;
+        std::istringstream lineStream(line);
+        CameraKeyframeStruct keyframe;
+        if(!(lineStream >> keyframe.time >> keyframe.position.x >> keyframe.position.y >> keyframe.position.z >> keyframe.yaw >> keyframe.pitch)) {
+            std::cerr << "Invalid Camera Path Keyframe in " << filePath << ": " << line << "\n";
+            return false;
+        }
+        loadedKeyframes.push_back(keyframe);
+    }
+    if(loadedKeyframes.empty()) {
+        std::cerr << "Camera Path Has No Keyframes: " << filePath << "\n";
+        return false;
+    }
+
+    // Keep Keyframes Sorted by Time
+    std::stable_sort(loadedKeyframes.begin(), loadedKeyframes.end(), [](const CameraKeyframeStruct &a, const CameraKeyframeStruct &b) {return a.time < b.time;});
+    this->keyframes = loadedKeyframes;
+    return true;
+}
+
+// Camera Pose at A Time
+CameraKeyframeStruct CameraPath::sample(const float &time) {
+    if(this->keyframes.empty()) return CameraKeyframeStruct{};
+    if(time <= this->keyframes.front().time) return this->keyframes.front();
+    if(time >= this->keyframes.back().time) return this->keyframes.back();
+
+    // Find The Segment Containing The Time (The Segment's Outer Neighbours Are Clamped at The Path's Ends)
+    const unsigned int next = std::upper_bound(this->keyframes.begin(), this->keyframes.end(), time, [](const float &t, const CameraKeyframeStruct &keyframe) {return t < keyframe.time;}) - this->keyframes.begin();
+    const CameraKeyframeStruct &k0 = this->keyframes[next >= 2 ? next - 2 : 0];
+    const CameraKeyframeStruct &k1 = this->keyframes[next - 1];
+    const CameraKeyframeStruct &k2 = this->keyframes[next];
+    const CameraKeyframeStruct &k3 = this->keyframes[std::min<std::size_t>(next + 1, this->keyframes.size() - 1)];
+    const float segmentDuration{k2.time - k1.time};
+    const float t{segmentDuration > 0.0f ? (time - k1.time) / segmentDuration : 1.0f};
+
+    // Interpolate Position and Look Angles Along The Spline
+    CameraKeyframeStruct pose;
+    pose.time = time;
+    pose.position = catmullRom(k0.position, k1.position, k2.position, k3.position, t);
+    pose.yaw = catmullRom(k0.yaw, k1.yaw, k2.yaw, k3.yaw, t);
+    pose.pitch = catmullRom(k0.pitch, k1.pitch, k2.pitch, k3.pitch, t);
+    return pose;
+}
+
+// Move A Camera to Its Pose at A Time
+void CameraPath::apply(Camera &camera, const float &time) {
+    const CameraKeyframeStruct pose{this->sample(time)};
+    camera.setPose(pose.position, pose.yaw, pose.pitch);
+}
@@ -16,15 +16,23 @@ class Camera {
         // Process Keyboard Input - Camera Movement
         void processKeyboard(GLFWwindow* win, const float &deltaTime);
 
+        // Move The Camera by Held Movement Keys (Forward, Backward, Left, Right) Over A Time Step
+        void processMovement(const bool &forward, const bool &backward, const bool &left, const bool &right, const float &deltaTime);
+
         // Process Mouse Movement - Calculate Camera Look Direction
         void processMouseMovement(float mousePosX, float mousePosY);
 
         // Process Mouse Scroll
         void processMouseScroll(const double scrollPosY);
 
+        // Place The Camera Directly (Scripted Camera Paths) - Yaw and Pitch in Degrees Like Mouse Look
+        void setPose(const glm::vec3 &camPos, const float &camYaw, const float &camPitch);
+
         // Getters
         glm::vec3 getCamPos(void) {return this->camPos;}
         glm::vec3 getCamFront(void) {return this->camFront;}
+        float getCamYaw(void) {return this->camYaw;}
+        float getCamPitch(void) {return this->camPitch;}
         glm::mat4 getViewMatrix(void) {return glm::lookAt(this->camPos, this->camPos + this->camFront, this->camUp);}
         float &getCamFOV(void) {return this->camFOV;}
     private:
@@ -41,8 +49,11 @@ class Camera {
         bool firstMouse{true};
 
         // Camera Yaw and Pitch
-        float camYaw{-90.0f}, camPitch;
+        float camYaw{-90.0f}, camPitch{0.0f};
 
         // Camera Last X and Y Values
         float lastX, lastY;
+
+        // Calculate Camera Direction From Yaw and Pitch
+        void updateCamFront(void);
 };
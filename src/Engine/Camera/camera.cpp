@@ -17,15 +17,20 @@ Camera::Camera(const glm::vec3 &camPos, const float &moveSpeed, const float &mou
 
 // Process Keyboard Input - Camera Movement
 void Camera::processKeyboard(GLFWwindow* win, const float &deltaTime) {
+    this->processMovement(glfwGetKey(win, GLFW_KEY_W) == GLFW_PRESS, glfwGetKey(win, GLFW_KEY_S) == GLFW_PRESS, glfwGetKey(win, GLFW_KEY_A) == GLFW_PRESS, glfwGetKey(win, GLFW_KEY_D) == GLFW_PRESS, deltaTime);
+}
+
+// Move The Camera by Held Movement Keys Over A Time Step
+void Camera::processMovement(const bool &forward, const bool &backward, const bool &left, const bool &right, const float &deltaTime) {
     // Camera Movement Code
     const float camSpeed = this->moveSpeed * deltaTime;
-    if(glfwGetKey(win, GLFW_KEY_W) == GLFW_PRESS) {
+    if(forward) {
         this->camPos += camSpeed * this->camFront;
-    } if(glfwGetKey(win, GLFW_KEY_S) == GLFW_PRESS) {
+    } if(backward) {
         this->camPos -= camSpeed * this->camFront;
-    } if(glfwGetKey(win, GLFW_KEY_A) == GLFW_PRESS) {
+    } if(left) {
         this->camPos -= glm::normalize(glm::cross(this->camFront, this->camUp)) * camSpeed;
-    } if(glfwGetKey(win, GLFW_KEY_D) == GLFW_PRESS) {
+    } if(right) {
         this->camPos += glm::normalize(glm::cross(this->camFront, this->camUp)) * camSpeed;
     }
 }
@@ -58,6 +63,20 @@ void Camera::processMouseMovement(float mousePosX, float mousePosY) {
     this->camYaw += xOffset;
     this->camPitch += yOffset;
 
+    // Update Camera Direction
+    this->updateCamFront();
+}
+
+// Place The Camera Directly
+void Camera::setPose(const glm::vec3 &camPos, const float &camYaw, const float &camPitch) {
+    this->camPos = camPos;
+    this->camYaw = camYaw;
+    this->camPitch = camPitch;
+    this->updateCamFront();
+}
+
+// Calculate Camera Direction From Yaw and Pitch
+void Camera::updateCamFront(void) {
     // Constrain Camera Pitch Values so it Doesn't Flip Vertically
     if(this->camPitch < -89.0f) {
         this->camPitch = -89.0f;
@@ -0,0 +1,48 @@
+#pragma once
+
+// Standard Headers
+#include<algorithm>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Axis Aligned Bounding Box Struct
+struct BoundingBox {
+    glm::vec3 min{0.0f}, max{0.0f};
+};
+
+// Frustum Struct - Six Inward Facing Planes (Left, Right, Bottom, Top, Near, Far)
+struct Frustum {
+    glm::vec4 planes[6];
+};
+
+// Culling Functions
+namespace Culling {
+    // Frustum Plane Indices
+    enum FrustumPlane : unsigned int {
+        FRUSTUM_PLANE_LEFT = 0,
+        FRUSTUM_PLANE_RIGHT,
+        FRUSTUM_PLANE_BOTTOM,
+        FRUSTUM_PLANE_TOP,
+        FRUSTUM_PLANE_NEAR,
+        FRUSTUM_PLANE_FAR,
+    };
+
+    // Check if A Sphere Intersects An Axis Aligned Bounding Box
+    inline bool sphereIntersectsBox(const glm::vec3 &sphereCenter, const float &sphereRadius, const BoundingBox &box) {
+        // Squared Distance From Sphere Center to The Closest Point on The Box
+        const glm::vec3 closestPoint{glm::clamp(sphereCenter, box.min, box.max)};
+        const glm::vec3 offset{sphereCenter - closestPoint};
+        return glm::dot(offset, offset) <= sphereRadius * sphereRadius;
+    }
+
+    // Extract The Frustum Planes of A Projection (View) Matrix
+    Frustum extractFrustum(const glm::mat4 &projectionViewMatrix);
+
+    // Check if An Axis Aligned Bounding Box is (Partially) Inside A Frustum
+    // The Near Plane Can Be Ignored For Passes That Clamp Depth (e.g. Shadow Casters Behind The Light's Near Plane)
+    bool boxIntersectsFrustum(const BoundingBox &box, const Frustum &frustum, const bool &ignoreNearPlane = false);
+
+    // Transform An Axis Aligned Bounding Box And Return The Bounding Box of The Result
+    BoundingBox transformBoundingBox(const BoundingBox &box, const glm::mat4 &matrix);
+}
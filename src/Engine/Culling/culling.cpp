@@ -0,0 +1,45 @@
+#include"Culling.hpp"
+
+// Extract The Frustum Planes of A Projection (View) Matrix
+Frustum Culling::extractFrustum(const glm::mat4 &projectionViewMatrix) {
+    // Matrix Rows (GLM Matrices Are Column Major)
+    const glm::mat4 transposed{glm::transpose(projectionViewMatrix)};
+
+    // Gribb/Hartmann Plane Extraction
+    Frustum frustum;
+    frustum.planes[FRUSTUM_PLANE_LEFT] = transposed[3] + transposed[0];
+    frustum.planes[FRUSTUM_PLANE_RIGHT] = transposed[3] - transposed[0];
+    frustum.planes[FRUSTUM_PLANE_BOTTOM] = transposed[3] + transposed[1];
+    frustum.planes[FRUSTUM_PLANE_TOP] = transposed[3] - transposed[1];
+    frustum.planes[FRUSTUM_PLANE_NEAR] = transposed[3] + transposed[2];
+    frustum.planes[FRUSTUM_PLANE_FAR] = transposed[3] - transposed[2];
+
+    // Normalize Planes
+    for(glm::vec4 &plane : frustum.planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+    return frustum;
+}
+
+// Check if An Axis Aligned Bounding Box is (Partially) Inside A Frustum
+bool Culling::boxIntersectsFrustum(const BoundingBox &box, const Frustum &frustum, const bool &ignoreNearPlane) {
+    for(unsigned int i = 0; i < 6; i++) {
+        if(ignoreNearPlane && i == FRUSTUM_PLANE_NEAR) continue;
+
+        // Test The Box Corner Furthest Along The Plane Normal
+        const glm::vec4 &plane = frustum.planes[i];
+        const glm::vec3 positiveCorner{plane.x >= 0.0f ? box.max.x : box.min.x, plane.y >= 0.0f ? box.max.y : box.min.y, plane.z >= 0.0f ? box.max.z : box.min.z};
+        if(glm::dot(glm::vec3(plane), positiveCorner) + plane.w < 0.0f) return false;
+    }
+    return true;
+}
+
+// Transform An Axis Aligned Bounding Box And Return The Bounding Box of The Result
+BoundingBox Culling::transformBoundingBox(const BoundingBox &box, const glm::mat4 &matrix) {
+    // Arvo's Method - Transform The Center and Accumulate The Absolute Extents
+    const glm::vec3 center{(box.min + box.max) * 0.5f}, extents{(box.max - box.min) * 0.5f};
+    const glm::vec3 newCenter{matrix * glm::vec4(center, 1.0f)};
+    const glm::mat3 absMatrix{glm::abs(glm::mat3(matrix)[0]), glm::abs(glm::mat3(matrix)[1]), glm::abs(glm::mat3(matrix)[2])};
+    const glm::vec3 newExtents{absMatrix * extents};
+    return BoundingBox{newCenter - newExtents, newCenter + newExtents};
+}
@@ -2,18 +2,20 @@
 
 // Standard Headers
 #include<iostream>
+#include<vector>
 
 // GLAD OpenGL Loader
 #include<glad/glad.h>
 
 // Custom Engine Headers
 #include"../Texture/Texture.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
 
 // Framebuffer Class
 class Framebuffer {
     public:
-        // Constructor - Create A New Framebuffer Object
-        Framebuffer(const unsigned int &windowWidth, const unsigned int &windowHeight, const bool &msaaEnabled, const unsigned int &msaaSamples);
+        // Constructor - Create A New Framebuffer Object (owner Names Who The Memory of Its Attachments is Tracked Under)
+        Framebuffer(const unsigned int &windowWidth, const unsigned int &windowHeight, const bool &msaaEnabled, const unsigned int &msaaSamples, const char *owner = "Framebuffers");
 
         // Create Color Buffer Texture
         void createColorBufferTexture();
@@ -21,9 +23,37 @@ class Framebuffer {
         // Create A Renderbuffer Object (Depth and Stencil Buffer)
         void createRenderbuffer(const GLenum &renderbufferType);
 
-        // Create Shadow Map
+        // Create Shadow Map (Depth Only, Sampled With Hardware Depth Comparison)
         void createShadowMap();
 
+        // Create Shadow Map Array (One Depth Layer Per Shadow Map, e.g. Shadow Cascades)
+        void createShadowMapArray(const unsigned int &layerCount);
+
+        // Create Shadow Cubemap Array (Six Depth Faces Per Cubemap, Rendered Into Together With Layered Rendering)
+        void createShadowCubemapArray(const unsigned int &cubemapCount);
+
+        // Render Into One Layer of The Shadow Map Array
+        void attachShadowMapLayer(const unsigned int &layer) {
+            glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+            glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, this->depthBufferTexture, 0, layer);
+        }
+
+        // Bind Shadow Map (Array)
+        void bindShadowMap(void) {glBindTexture(GL_TEXTURE_2D, this->depthBufferTexture);}
+        void bindShadowMapArray(void) {glBindTexture(GL_TEXTURE_2D_ARRAY, this->depthBufferTexture);}
+        void bindShadowCubemapArray(void) {glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, this->depthBufferTexture);}
+
+        // Multiple Render Targets (MRT)
+        // Add A Color Attachment Texture (Attached to The Next Free Color Attachment Point)
+        void addColorAttachment(const GLenum &internalFormat, const GLenum &format, const GLenum &type);
+
+        // Create A Depth (Stencil) Buffer Texture That Can Be Sampled (e.g. to Reconstruct Positions)
+        void createDepthTexture(const GLenum &internalFormat);
+
+        // Bind A Color Attachment Texture / The Depth Buffer Texture
+        void bindColorAttachment(const unsigned int &attachmentIndex) {glBindTexture(GL_TEXTURE_2D, this->colorAttachments[attachmentIndex]);}
+        void bindDepthTexture(void) {glBindTexture(GL_TEXTURE_2D, this->depthBufferTexture);}
+
         // Bind Color Buffer Texture
         void bindColorBufferTexture(void) {
             this->msaaEnabled ? glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->colorBufferTexture) : glBindTexture(GL_TEXTURE_2D, this->colorBufferTexture);
@@ -31,6 +61,10 @@ class Framebuffer {
 
         // Getters
         GLuint getFramebufferObject(void) {return this->framebuffer;}
+        GLuint getDepthBufferTexture(void) {return this->depthBufferTexture;}
+        GLuint getColorBufferTexture(void) {return this->colorBufferTexture;}
+        unsigned int getWidth(void) {return this->windowWidth;}
+        unsigned int getHeight(void) {return this->windowHeight;}
 
         // Destroy
         void destroy(const bool &usingRenderbuffer);
@@ -42,15 +76,21 @@ class Framebuffer {
         bool msaaEnabled;
         unsigned int msaaSamples;
 
+        // Name Attachment Memory is Tracked Under
+        const char *owner;
+
         // Framebuffer Object
         GLuint framebuffer;
 
         // Color Buffer Texture
-        GLuint colorBufferTexture;
+        GLuint colorBufferTexture{};
+
+        // Color Attachment Textures (Multiple Render Targets)
+        std::vector<GLuint> colorAttachments;
 
         // Renderbuffer Object (Depth and Stencil Buffer)
-        GLuint renderbufferObject;
+        GLuint renderbufferObject{};
 
         // Depth Buffer Texture
-        GLuint depthBufferTexture;
+        GLuint depthBufferTexture{};
 };
@@ -1,7 +1,7 @@
 #include"Framebuffer.hpp"
 
 // Constructor - Create A New Framebuffer Object
-Framebuffer::Framebuffer(const unsigned int &windowWidth, const unsigned int &windowHeight, const bool &msaaEnabled, const unsigned int &msaaSamples) {
+Framebuffer::Framebuffer(const unsigned int &windowWidth, const unsigned int &windowHeight, const bool &msaaEnabled, const unsigned int &msaaSamples, const char *owner) {
     // Set Window Properties
     this->windowWidth = windowWidth;
     this->windowHeight = windowHeight;
@@ -9,6 +9,7 @@ Framebuffer::Framebuffer(const unsigned int &windowWidth, const unsigned int &wi
     // Set MSAA Properties
     this->msaaEnabled = msaaEnabled;
     this->msaaSamples = msaaSamples;
+    this->owner = owner;
 
     // Create A New Framebuffer Object
     glGenFramebuffers(1, &this->framebuffer);
@@ -34,6 +35,7 @@ void Framebuffer::createColorBufferTexture() {
             // Create an Empty Multisampled Color Buffer Texture
             glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->colorBufferTexture);
             glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, this->msaaSamples, GL_RGB, this->windowWidth, this->windowHeight, GL_TRUE);
+            GPUMemoryTracker::trackTexture(this->colorBufferTexture, GPU_MEMORY_RENDER_TARGET, GL_RGB, this->windowWidth, this->windowHeight, 1, 1, this->msaaSamples, this->owner);
 
             // Texture Parameters
             glTexParameteri(GL_TEXTURE_2D_MULTISAMPLE, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -51,6 +53,7 @@ void Framebuffer::createColorBufferTexture() {
             // Create an Empty Color Buffer Texture
             glBindTexture(GL_TEXTURE_2D, this->colorBufferTexture);
             glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, this->windowWidth, this->windowHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+            GPUMemoryTracker::trackTexture(this->colorBufferTexture, GPU_MEMORY_RENDER_TARGET, GL_RGB, this->windowWidth, this->windowHeight, 1, 1, 1, this->owner);
 
             // Texture Parameters
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -83,6 +86,7 @@ void Framebuffer::createRenderbuffer(const GLenum &renderbufferType) {
             glRenderbufferStorage(GL_RENDERBUFFER, renderbufferType, this->windowWidth, this->windowHeight);
             break;
     }
+    GPUMemoryTracker::trackRenderbuffer(this->renderbufferObject, renderbufferType, this->windowWidth, this->windowHeight, this->msaaEnabled ? this->msaaSamples : 1, this->owner);
 
     // Attach Renderbuffer Object to Framebuffer Object
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, this->renderbufferObject);
@@ -92,10 +96,162 @@ void Framebuffer::createRenderbuffer(const GLenum &renderbufferType) {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-// Create Depth Buffer Texture
+// Create Shadow Map (Depth Only, Sampled With Hardware Depth Comparison)
 void Framebuffer::createShadowMap() {
+    // Bind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+
     // Create A Depth Map Texture
     glGenTextures(1, &this->depthBufferTexture);
+    glBindTexture(GL_TEXTURE_2D, this->depthBufferTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, this->windowWidth, this->windowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    GPUMemoryTracker::trackTexture(this->depthBufferTexture, GPU_MEMORY_RENDER_TARGET, GL_DEPTH_COMPONENT32F, this->windowWidth, this->windowHeight, 1, 1, 1, this->owner);
+
+    // Texture Parameters - Linear Filtering Gives Hardware 2x2 PCF, Everything Outside The Map is Lit
+    const float borderColor[]{1.0f, 1.0f, 1.0f, 1.0f};
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+    // Attach Depth Map Texture to Framebuffer Object (No Color Buffer is Rendered to or Read From)
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, this->depthBufferTexture, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+
+    // Unbind Texture and Framebuffer Object
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Create Shadow Map Array (One Depth Layer Per Shadow Map, e.g. Shadow Cascades)
+void Framebuffer::createShadowMapArray(const unsigned int &layerCount) {
+    // Bind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+
+    // Create A Depth Map Array Texture
+    glGenTextures(1, &this->depthBufferTexture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, this->depthBufferTexture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, this->windowWidth, this->windowHeight, layerCount, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    GPUMemoryTracker::trackTexture(this->depthBufferTexture, GPU_MEMORY_RENDER_TARGET, GL_DEPTH_COMPONENT32F, this->windowWidth, this->windowHeight, layerCount, 1, 1, this->owner);
+
+    // Texture Parameters - Linear Filtering Gives Hardware 2x2 PCF, Everything Outside The Map is Lit
+    const float borderColor[]{1.0f, 1.0f, 1.0f, 1.0f};
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+    glTexParameterfv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, borderColor);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+    // Attach First Layer to Framebuffer Object (No Color Buffer is Rendered to or Read From)
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, this->depthBufferTexture, 0, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+
+    // Unbind Texture and Framebuffer Object
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Create Shadow Cubemap Array (Six Depth Faces Per Cubemap, Rendered Into Together With Layered Rendering)
+void Framebuffer::createShadowCubemapArray(const unsigned int &cubemapCount) {
+    // Bind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+
+    // Create A Depth Cubemap Array Texture (Layer = Cubemap * 6 + Face)
+    glGenTextures(1, &this->depthBufferTexture);
+    glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, this->depthBufferTexture);
+    glTexImage3D(GL_TEXTURE_CUBE_MAP_ARRAY, 0, GL_DEPTH_COMPONENT32F, this->windowWidth, this->windowHeight, cubemapCount * 6, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    GPUMemoryTracker::trackTexture(this->depthBufferTexture, GPU_MEMORY_RENDER_TARGET, GL_DEPTH_COMPONENT32F, this->windowWidth, this->windowHeight, cubemapCount * 6, 1, 1, this->owner);
+
+    // Texture Parameters - Linear Filtering Gives Hardware 2x2 PCF, Clamping Keeps Face Edges Seamless
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+    // Attach Every Layer to Framebuffer Object so gl_Layer Picks The Face (No Color Buffer is Rendered to or Read From)
+    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, this->depthBufferTexture, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+
+    // Unbind Texture and Framebuffer Object
+    glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Add A Color Attachment Texture (Attached to The Next Free Color Attachment Point)
+void Framebuffer::addColorAttachment(const GLenum &internalFormat, const GLenum &format, const GLenum &type) {
+    // Bind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+
+    // Create An Empty Color Attachment Texture
+    GLuint colorAttachment;
+    glGenTextures(1, &colorAttachment);
+    glBindTexture(GL_TEXTURE_2D, colorAttachment);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, this->windowWidth, this->windowHeight, 0, format, type, nullptr);
+    GPUMemoryTracker::trackTexture(colorAttachment, GPU_MEMORY_RENDER_TARGET, internalFormat, this->windowWidth, this->windowHeight, 1, 1, 1, this->owner);
+
+    // Texture Parameters (Attachments Are Read Per Pixel so No Filtering)
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // Attach Color Attachment Texture to Framebuffer Object
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + this->colorAttachments.size(), GL_TEXTURE_2D, colorAttachment, 0);
+    this->colorAttachments.push_back(colorAttachment);
+
+    // Render Into Every Color Attachment
+    std::vector<GLenum> drawBuffers;
+    for(unsigned int i = 0; i < this->colorAttachments.size(); i++) {
+        drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + i);
+    }
+    glDrawBuffers(drawBuffers.size(), drawBuffers.data());
+
+    // Unbind Texture and Framebuffer Object
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Create A Depth (Stencil) Buffer Texture That Can Be Sampled (e.g. to Reconstruct Positions)
+void Framebuffer::createDepthTexture(const GLenum &internalFormat) {
+    // Bind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+
+    // Figure Out Depth Texture Format and Attachment Point
+    const bool hasStencil{internalFormat == GL_DEPTH24_STENCIL8 || internalFormat == GL_DEPTH32F_STENCIL8};
+    const GLenum format{hasStencil ? (GLenum)GL_DEPTH_STENCIL : (GLenum)GL_DEPTH_COMPONENT};
+    GLenum type{GL_FLOAT};
+    if(internalFormat == GL_DEPTH24_STENCIL8) type = GL_UNSIGNED_INT_24_8;
+    if(internalFormat == GL_DEPTH32F_STENCIL8) type = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+
+    // Create An Empty Depth Buffer Texture
+    glGenTextures(1, &this->depthBufferTexture);
+    glBindTexture(GL_TEXTURE_2D, this->depthBufferTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, this->windowWidth, this->windowHeight, 0, format, type, nullptr);
+    GPUMemoryTracker::trackTexture(this->depthBufferTexture, GPU_MEMORY_RENDER_TARGET, internalFormat, this->windowWidth, this->windowHeight, 1, 1, 1, this->owner);
+
+    // Texture Parameters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // Attach Depth Buffer Texture to Framebuffer Object
+    glFramebufferTexture2D(GL_FRAMEBUFFER, hasStencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, this->depthBufferTexture, 0);
+
+    // Unbind Texture and Framebuffer Object
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
 // Destroy
@@ -103,13 +259,19 @@ void Framebuffer::destroy(const bool &usingRenderbuffer) {
     // Delete Framebuffer Object
     glDeleteFramebuffers(1, &this->framebuffer);
 
-    // Delete Color Buffer Texture
+    // Delete Color Buffer Texture and Color Attachment Textures
+    GPUMemoryTracker::untrack(GL_TEXTURE, this->colorBufferTexture);
+    GPUMemoryTracker::untrack(GL_TEXTURE, this->colorAttachments.size(), this->colorAttachments.data());
     glDeleteTextures(1, &this->colorBufferTexture);
+    glDeleteTextures(this->colorAttachments.size(), this->colorAttachments.data());
+    this->colorAttachments.clear();
 
     // Delete Renderbuffer Object (If Using it)
     if(usingRenderbuffer) {
+        GPUMemoryTracker::untrack(GL_RENDERBUFFER, this->renderbufferObject);
         glDeleteRenderbuffers(1, &this->renderbufferObject);
     } else {
+        GPUMemoryTracker::untrack(GL_TEXTURE, this->depthBufferTexture);
         glDeleteTextures(1, &this->depthBufferTexture);
     }
 }
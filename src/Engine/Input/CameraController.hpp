@@ -0,0 +1,44 @@
+#pragma once
+
+// GLFW
+#include<GLFW/glfw3.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"InputQueue.hpp"
+#include"../Camera/Camera.hpp"
+
+// Camera Controller Class - Simulates Camera Movement at A Fixed Time Step From Queued Input so it Behaves The Same at Any Frame Rate
+// The Rendered Camera's Position is Interpolated Between The Last Two Steps, Look Input Applies Immediately so Turning Never Waits For A Step
+class CameraController {
+    public:
+        // Constructor - Simulate A Copy of The Rendered Camera, At Most maxStepsPerFrame Steps Run Per Frame (Hitches Drop The Backlog Instead)
+        CameraController(Camera &camera, const float &stepTime, const unsigned int &maxStepsPerFrame);
+
+        // Consume Input Received Up to currentTime, Run The Simulation Steps That Fit and Place The Rendered Camera
+        void update(InputQueue &inputQueue, const double &currentTime);
+
+        // Getters
+        float getInterpolationAlpha(void) {return this->interpolationAlpha;}
+        unsigned int getStepCount(void) {return this->stepCount;}
+    private:
+        // Rendered and Simulated Cameras (And The Simulated Position Before The Last Step)
+        Camera &camera;
+        Camera simulationCamera;
+        glm::vec3 previousPosition;
+
+        // Fixed Time Step
+        float stepTime;
+        unsigned int maxStepsPerFrame, stepCount{0};
+        double simulationTime{0.0};
+        bool started{false};
+        float interpolationAlpha{0.0f};
+
+        // Held Keys
+        bool keysHeld[GLFW_KEY_LAST + 1]{};
+
+        // Apply An Input Event to The Simulated Camera
+        void applyEvent(const InputEventStruct &event);
+};
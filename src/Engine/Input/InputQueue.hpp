@@ -0,0 +1,57 @@
+#pragma once
+
+// Standard Headers
+#include<atomic>
+#include<cstddef>
+
+// Input Event Types
+enum InputEventType : unsigned int {
+    INPUT_EVENT_KEY = 0,
+    INPUT_EVENT_MOUSE_MOVE,
+    INPUT_EVENT_SCROLL,
+};
+
+// Input Event - Key Events Use key and action (GLFW Values), Mouse Moves and Scrolls Use x and y, time is When it Was Received in Seconds
+struct InputEventStruct {
+    InputEventType type{INPUT_EVENT_KEY};
+    int key{0}, action{0};
+    double x{0.0}, y{0.0};
+    double time{0.0};
+};
+
+// Input Queue Class - Lock Free Single Producer Single Consumer Ring of Input Events
+// The Thread Polling Window Events Pushes, The Thread Simulating The Game Pops - Neither Ever Blocks
+class InputQueue {
+    public:
+        // Number of Events The Queue Holds (Power of Two)
+        static constexpr std::size_t capacity{1024};
+
+        // Push An Event (Producer Only) - Returns False if The Queue is Full and The Event Was Dropped
+        bool push(const InputEventStruct &event) {
+            const std::size_t writeIndex{this->writeIndex.load(std::memory_order_relaxed)};
+            if(writeIndex - this->readIndex.load(std::memory_order_acquire) == capacity) return false;
+            this->events[writeIndex & (capacity - 1)] = event;
+            this->writeIndex.store(writeIndex + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Look at The Oldest Event Without Removing it (Consumer Only) - Returns False if The Queue is Empty
+        bool peek(InputEventStruct &event) {
+            const std::size_t readIndex{this->readIndex.load(std::memory_order_relaxed)};
+            if(readIndex == this->writeIndex.load(std::memory_order_acquire)) return false;
+            event = this->events[readIndex & (capacity - 1)];
+            return true;
+        }
+
+        // Remove The Oldest Event (Consumer Only) - Returns False if The Queue is Empty
+        bool pop(InputEventStruct &event) {
+            if(!this->peek(event)) return false;
+            this->readIndex.store(this->readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            return true;
+        }
+    private:
+        // Event Storage and Indices (On Separate Cache Lines so Producer and Consumer Don't Falsely Share)
+        InputEventStruct events[capacity];
+        alignas(64) std::atomic<std::size_t> writeIndex{0};
+        alignas(64) std::atomic<std::size_t> readIndex{0};
+};
@@ -0,0 +1,61 @@
+#include"CameraController.hpp"
+
+// Constructor
+CameraController::CameraController(Camera &camera, const float &stepTime, const unsigned int &maxStepsPerFrame) : camera(camera), simulationCamera(camera) {
+    this->previousPosition = camera.getCamPos();
+    this->stepTime = stepTime;
+    this->maxStepsPerFrame = maxStepsPerFrame;
+}
+
+// Consume Input, Run Simulation Steps and Place The Rendered Camera
+void CameraController::update(InputQueue &inputQueue, const double &currentTime) {
+    // The Simulation Starts at The First Update
+    if(!this->started) {
+        this->simulationTime = currentTime;
+        this->started = true;
+    }
+
+    // Run Every Whole Step Up to The Current Time, Each Only Seeing Input Received Before it Ended
+    InputEventStruct event;
+    this->stepCount = 0;
+    while(this->simulationTime + this->stepTime <= currentTime && this->stepCount < this->maxStepsPerFrame) {
+        const double stepEndTime{this->simulationTime + this->stepTime};
+        while(inputQueue.peek(event) && event.time <= stepEndTime) {
+            inputQueue.pop(event);
+            this->applyEvent(event);
+        }
+        this->previousPosition = this->simulationCamera.getCamPos();
+        this->simulationCamera.processMovement(this->keysHeld[GLFW_KEY_W], this->keysHeld[GLFW_KEY_S], this->keysHeld[GLFW_KEY_A], this->keysHeld[GLFW_KEY_D], this->stepTime);
+        this->simulationTime = stepEndTime;
+        this->stepCount++;
+    }
+
+    // Too Far Behind (A Hitch or A Breakpoint) - Drop The Backlog Rather Than Spiral Into Ever Longer Frames
+    if(this->simulationTime + this->stepTime <= currentTime) this->simulationTime = currentTime;
+
+    // Input Received Since The Last Step Applies Now (Look Input Shows This Frame, Held Keys Move The Camera From The Next Step)
+    while(inputQueue.peek(event) && event.time <= currentTime) {
+        inputQueue.pop(event);
+        this->applyEvent(event);
+    }
+
+    // Rendered Camera Sits Between The Last Two Steps With The Latest Look Direction and Zoom
+    this->interpolationAlpha = glm::clamp((float)((currentTime - this->simulationTime) / this->stepTime), 0.0f, 1.0f);
+    this->camera.setPose(glm::mix(this->previousPosition, this->simulationCamera.getCamPos(), this->interpolationAlpha), this->simulationCamera.getCamYaw(), this->simulationCamera.getCamPitch());
+    this->camera.getCamFOV() = this->simulationCamera.getCamFOV();
+}
+
+// Apply An Input Event to The Simulated Camera
+void CameraController::applyEvent(const InputEventStruct &event) {
+    switch(event.type) {
+        case INPUT_EVENT_KEY:
+            if(event.key >= 0 && event.key <= GLFW_KEY_LAST && event.action != GLFW_REPEAT) this->keysHeld[event.key] = event.action == GLFW_PRESS;
+            break;
+        case INPUT_EVENT_MOUSE_MOVE:
+            this->simulationCamera.processMouseMovement(event.x, event.y);
+            break;
+        case INPUT_EVENT_SCROLL:
+            this->simulationCamera.processMouseScroll(event.y);
+            break;
+    }
+}
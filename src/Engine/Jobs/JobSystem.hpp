@@ -0,0 +1,70 @@
+#pragma once
+
+// Standard Headers
+#include<mutex>
+#include<atomic>
+#include<string>
+#include<vector>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+
+// Job - A Function, The Counter it Decrements Once Finished, A Name For CPU Profiler Traces (Must Outlive The Capture) and Whether it's A Background Job
+struct JobCounterStruct;
+struct JobStruct {
+    std::function<void(void)> function;
+    JobCounterStruct *counter{nullptr};
+    const char *name{"Job"};
+    bool background{false};
+};
+
+// Job Counter - Counts A Group's Unfinished Jobs, JobSystem::wait() Runs Other Jobs Until it Reaches Zero
+// Jobs Started With JobSystem::runAfter() Are Held Here Until The Count Reaches Zero (Keep The Counter Alive Until Then)
+struct JobCounterStruct {
+    std::atomic<unsigned int> count{0};
+    std::mutex mutex;
+    std::vector<JobStruct> continuations;
+};
+
+// Job Worker Statistics Since The Previous JobSystem::getStats() Call
+struct JobWorkerStatsStruct {
+    std::string name;
+    std::uint64_t executedJobCount{0}, stolenJobCount{0};
+    float utilization{0.0f};
+};
+
+// Job System Class - Work Stealing Job Scheduler Shared by The Whole Engine
+// Every Worker Pushes and Pops Jobs at The Back of Its Own Deque (Newest First, Still Cache Warm) and Steals From The Front of Others' When it Runs Out
+// Jobs From Threads Outside The Pool Go Into A Shared Queue, and Those Threads Run Jobs While They Wait so Jobs Waiting on Nested Jobs Can't Deadlock
+// Background Jobs (Long Loads) Go Into Their Own Queue Only Idle Workers Read, and At Most getBackgroundWorkerLimit() Workers Run Them at Once so Frame Jobs Always Have A Worker
+// Jobs Queued by A Background Job Are Background Jobs Too, Which Only A Wait Inside A Background Job For Their Own Counter Runs
+// Before initialize() (Or With Zero Workers) Jobs Run Immediately on The Calling Thread
+class JobSystem {
+    public:
+        // Start The Worker Threads (0 = One Per Core Besides The Main and Render Threads)
+        static void initialize(const unsigned int &workerCount);
+
+        // Finish Every Queued Job and Stop The Worker Threads
+        static void shutdown(void);
+
+        // Queue A Job (Incrementing counter Until it Finishes)
+        static void run(const std::function<void(void)> &job, JobCounterStruct *counter = nullptr, const char *name = "Job");
+
+        // Queue A Low Priority Job (Incrementing counter Until it Finishes) - Run by Idle Workers Only, Never by wait()
+        static void runBackground(const std::function<void(void)> &job, JobCounterStruct *counter = nullptr, const char *name = "Background Job");
+
+        // Queue A Job Once Every Job Counted by dependency Has Finished
+        static void runAfter(JobCounterStruct &dependency, const std::function<void(void)> &job, JobCounterStruct *counter = nullptr, const char *name = "Job");
+
+        // Run Queued Jobs on The Calling Thread Until counter Reaches Zero (Background Jobs Only When Called From One, And Only Those counter Counts)
+        static void wait(JobCounterStruct &counter);
+
+        // Split [0, count) Into Ranges of batchSize and Call body(begin, end) For Each Range in Parallel (The Calling Thread Takes Part), Returns When All Are Done
+        static void parallelFor(const std::size_t &count, const std::size_t &batchSize, const std::function<void(std::size_t, std::size_t)> &body, const char *name = "Parallel For");
+
+        // Getters
+        static unsigned int getWorkerCount(void);
+        static unsigned int getBackgroundWorkerLimit(void);
+        static std::vector<JobWorkerStatsStruct> getStats(void);
+        static std::string getStatsReport(void);
+};
@@ -0,0 +1,394 @@
+#include"JobSystem.hpp"
+
+// Standard Headers
+#include<chrono>
+#include<memory>
+#include<thread>
+#include<sstream>
+#include<algorithm>
+#include<condition_variable>
+
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+
+// Job Queue - Ring Buffer Deque That Keeps Its Storage (std::deque Frees and Allocates A Block Every Few Jobs Passing Through)
+struct JobQueueStruct {
+    std::vector<JobStruct> slots;
+    std::size_t head{0}, count{0};
+
+    bool empty(void) const {return this->count == 0;}
+    void pushBack(const JobStruct &job) {
+        // Full - Double The Slots, Unwrapping The Queued Jobs to The Front
+        if(this->count == this->slots.size()) {
+            std::vector<JobStruct> grownSlots(std::max<std::size_t>(this->slots.size() * 2, 64));
+            for(std::size_t i = 0; i < this->count; i++) grownSlots[i] = std::move(this->slots[(this->head + i) % this->slots.size()]);
+            this->slots.swap(grownSlots);
+            this->head = 0;
+        }
+        this->slots[(this->head + this->count++) % this->slots.size()] = job;
+    }
+    JobStruct popBack(void) {
+        return std::move(this->slots[(this->head + --this->count) % this->slots.size()]);
+    }
+    JobStruct popFront(void) {
+        JobStruct job{std::move(this->slots[this->head])};
+        this->head = (this->head + 1) % this->slots.size();
+        this->count--;
+        return job;
+    }
+
+    // Take The Oldest Job Counted by counter, Closing The Gap Behind it
+    bool popFirstCounted(const JobCounterStruct *counter, JobStruct &job) {
+        for(std::size_t i = 0; i < this->count; i++) {
+            if(this->slots[(this->head + i) % this->slots.size()].counter != counter) continue;
+            job = std::move(this->slots[(this->head + i) % this->slots.size()]);
+            for(; i + 1 < this->count; i++) this->slots[(this->head + i) % this->slots.size()] = std::move(this->slots[(this->head + i + 1) % this->slots.size()]);
+            this->count--;
+            return true;
+        }
+        return false;
+    }
+};
+
+// Job Worker - A Thread and Its Deque (Only Locked by Its Owner and Thieves, One Job at A Time)
+struct JobWorkerStruct {
+    std::thread thread;
+    std::string name;
+    std::mutex mutex;
+    JobQueueStruct jobs;
+
+    // Statistics (busyNanoseconds is Time Spent Running Jobs)
+    std::atomic<std::uint64_t> executedJobCount{0}, stolenJobCount{0}, busyNanoseconds{0};
+    std::uint64_t lastExecutedJobCount{0}, lastStolenJobCount{0}, lastBusyNanoseconds{0};
+};
+
+// Workers and The Queue of Jobs From Threads Outside The Pool
+static std::vector<std::unique_ptr<JobWorkerStruct>> workers;
+static std::mutex sharedJobsMutex;
+static JobQueueStruct sharedJobs;
+
+// Background Jobs - Only Taken by Idle Workers, backgroundWorkerCount of Them at Once (Counted Like queuedJobCount)
+static std::mutex backgroundJobsMutex;
+static JobQueueStruct backgroundJobs;
+static std::atomic<std::size_t> queuedBackgroundJobCount{0};
+static std::atomic<unsigned int> backgroundWorkerCount{0};
+static unsigned int backgroundWorkerLimit{0};
+
+// Idle Workers Sleep Until A Job is Queued (queuedJobCount Goes Up Before A Job is Pushed and Down When One is Taken)
+static std::atomic<std::size_t> queuedJobCount{0};
+static std::atomic<bool> running{false};
+static std::mutex sleepMutex;
+static std::condition_variable sleepCondition;
+
+// Jobs Threads Outside The Pool Ran While Waiting
+static JobWorkerStruct waitingThreads;
+
+// Start of The Current Statistics Period
+static std::chrono::steady_clock::time_point statsStartTime{std::chrono::steady_clock::now()};
+
+// Calling Thread's Worker (nullptr Outside The Pool), How Many Jobs Are Running on it (Jobs Run Jobs While Waiting) and Whether The Innermost is A Background Job
+static thread_local JobWorkerStruct *currentWorker{nullptr};
+static thread_local unsigned int jobDepth{0};
+static thread_local bool runningBackgroundJob{false};
+
+// Nanoseconds Since steady_clock's Epoch
+static std::uint64_t nowNanoseconds(void) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Wake A Sleeping Worker
+static void wakeWorker(void) {
+    // Taking The Sleep Lock Means A Worker Can't Miss The Wake Up Between Checking For Jobs and Going to Sleep
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    sleepCondition.notify_one();
+}
+
+// Whether An Idle Worker Could Take A Background Job Now (Shutdown Lifts The Limit so Queued Ones Still Finish)
+static bool canTakeBackgroundJob(void) {
+    return queuedBackgroundJobCount.load() > 0 && (!running.load() || backgroundWorkerCount.load() < backgroundWorkerLimit);
+}
+
+// Push A Job Onto The Calling Worker's Deque (Or The Shared Queue, Or The Background Queue) and Wake A Sleeping Worker
+static void queueJob(const JobStruct &job) {
+    if(job.background) {
+        queuedBackgroundJobCount.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(backgroundJobsMutex);
+            backgroundJobs.pushBack(job);
+        }
+        wakeWorker();
+        return;
+    }
+    queuedJobCount.fetch_add(1, std::memory_order_release);
+    if(currentWorker != nullptr) {
+        std::lock_guard<std::mutex> lock(currentWorker->mutex);
+        currentWorker->jobs.pushBack(job);
+    } else {
+        std::lock_guard<std::mutex> lock(sharedJobsMutex);
+        sharedJobs.pushBack(job);
+    }
+    wakeWorker();
+}
+
+// Take A Job - The Calling Worker's Newest, Then The Oldest Shared Job, Then The Oldest Job of Another Worker
+static bool takeJob(JobStruct &job, bool &stolen) {
+    stolen = false;
+    if(queuedJobCount.load(std::memory_order_acquire) == 0) return false;
+    if(currentWorker != nullptr) {
+        std::lock_guard<std::mutex> lock(currentWorker->mutex);
+        if(!currentWorker->jobs.empty()) {
+            job = currentWorker->jobs.popBack();
+            queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(sharedJobsMutex);
+        if(!sharedJobs.empty()) {
+            job = sharedJobs.popFront();
+            queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal Starting From A Different Worker Each Time so Thieves Spread Out
+    static std::atomic<unsigned int> stealOffset{0};
+    const unsigned int firstVictim{stealOffset.fetch_add(1, std::memory_order_relaxed)};
+    for(unsigned int i = 0; i < workers.size(); i++) {
+        JobWorkerStruct &victim = *workers[(firstVictim + i) % workers.size()];
+        if(&victim == currentWorker) continue;
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if(!victim.jobs.empty()) {
+            job = victim.jobs.popFront();
+            queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            stolen = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Take The Oldest Background Job, Claiming One of The Background Worker Slots (Released With releaseBackgroundWorker())
+static bool takeBackgroundJob(JobStruct &job) {
+    if(queuedBackgroundJobCount.load(std::memory_order_acquire) == 0) return false;
+    unsigned int count{backgroundWorkerCount.load()};
+    do {
+        if(running.load() && count >= backgroundWorkerLimit) return false;
+    } while(!backgroundWorkerCount.compare_exchange_weak(count, count + 1));
+    std::lock_guard<std::mutex> lock(backgroundJobsMutex);
+    if(backgroundJobs.empty()) {
+        backgroundWorkerCount.fetch_sub(1);
+        return false;
+    }
+    job = backgroundJobs.popFront();
+    queuedBackgroundJobCount.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Take The Oldest Background Job Counted by counter (For A Background Job Waiting on Its Own Nested Jobs, it Already Holds A Slot)
+static bool takeCountedBackgroundJob(const JobCounterStruct &counter, JobStruct &job) {
+    if(queuedBackgroundJobCount.load(std::memory_order_acquire) == 0) return false;
+    std::lock_guard<std::mutex> lock(backgroundJobsMutex);
+    if(!backgroundJobs.popFirstCounted(&counter, job)) return false;
+    queuedBackgroundJobCount.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Give Back A Background Worker Slot, Waking A Worker For The Next Background Job
+static void releaseBackgroundWorker(void) {
+    backgroundWorkerCount.fetch_sub(1);
+    if(queuedBackgroundJobCount.load() > 0) wakeWorker();
+}
+
+// Queue A Job, or Run it Right Away Without Workers
+static void dispatchJob(JobStruct &job);
+
+// Run A Job Then Count it as Finished (Queueing Jobs That Were Waiting For Its Counter to Reach Zero)
+static void executeJob(JobStruct &job, JobWorkerStruct &worker, const bool &stolen) {
+    // Only The Outermost Job Counts Towards Busy Time (Nested Jobs Run Inside it)
+    const std::uint64_t startTime{nowNanoseconds()};
+    {
+        CPU_PROFILE_SCOPE(job.name);
+        const bool outerJobBackground{runningBackgroundJob};
+        runningBackgroundJob = job.background;
+        jobDepth++;
+        job.function();
+        jobDepth--;
+        runningBackgroundJob = outerJobBackground;
+    }
+    if(jobDepth == 0) worker.busyNanoseconds.fetch_add(nowNanoseconds() - startTime, std::memory_order_relaxed);
+    worker.executedJobCount.fetch_add(1, std::memory_order_relaxed);
+    if(stolen) worker.stolenJobCount.fetch_add(1, std::memory_order_relaxed);
+    if(job.counter == nullptr) return;
+
+    // The Counter is Decremented Under Its Lock so A Waiter Can't Free it Before The Continuations Are Taken
+    std::vector<JobStruct> continuations;
+    {
+        std::lock_guard<std::mutex> lock(job.counter->mutex);
+        if(job.counter->count.fetch_sub(1, std::memory_order_acq_rel) == 1) continuations.swap(job.counter->continuations);
+    }
+    for(JobStruct &continuation : continuations) dispatchJob(continuation);
+}
+
+// Queue A Job, or Run it Right Away Without Workers
+static void dispatchJob(JobStruct &job) {
+    if(!running.load(std::memory_order_relaxed) || workers.empty()) executeJob(job, currentWorker != nullptr ? *currentWorker : waitingThreads, false);
+    else queueJob(job);
+}
+
+// Worker Thread - Run Jobs, Then Background Jobs When There Are None, Sleeping While There Are Neither, Until Shutdown Leaves None
+static void workerLoop(JobWorkerStruct *worker) {
+    currentWorker = worker;
+    CPU_PROFILE_THREAD_NAME(worker->name);
+    while(true) {
+        JobStruct job;
+        bool stolen;
+        if(takeJob(job, stolen)) {
+            executeJob(job, *worker, stolen);
+            continue;
+        }
+        if(takeBackgroundJob(job)) {
+            executeJob(job, *worker, false);
+            releaseBackgroundWorker();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [](void) {return !running.load() || queuedJobCount.load() > 0 || canTakeBackgroundJob();});
+        if(!running.load() && queuedJobCount.load() == 0 && queuedBackgroundJobCount.load() == 0) break;
+    }
+    currentWorker = nullptr;
+}
+
+// Start The Worker Threads
+void JobSystem::initialize(const unsigned int &workerCount) {
+    if(running.load()) return;
+    const unsigned int hardwareThreadCount{std::thread::hardware_concurrency()};
+    const unsigned int threadCount{workerCount > 0 ? workerCount : std::max(hardwareThreadCount, 3u) - 2};
+    running.store(true);
+    waitingThreads.name = "Waiting Threads";
+    backgroundWorkerLimit = std::max(threadCount, 2u) - 1;
+    for(unsigned int i = 0; i < threadCount; i++) {
+        workers.push_back(std::make_unique<JobWorkerStruct>());
+        workers.back()->name = "Job Worker " + std::to_string(i + 1);
+    }
+
+    // Threads Start Once Every Worker Exists (They Steal From Each Other)
+    for(std::unique_ptr<JobWorkerStruct> &worker : workers) worker->thread = std::thread(workerLoop, worker.get());
+    statsStartTime = std::chrono::steady_clock::now();
+}
+
+// Finish Every Queued Job and Stop The Worker Threads
+void JobSystem::shutdown(void) {
+    if(!running.load()) return;
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        running.store(false);
+    }
+    sleepCondition.notify_all();
+    for(std::unique_ptr<JobWorkerStruct> &worker : workers) worker->thread.join();
+    workers.clear();
+}
+
+// Queue A Job (Background Too When Queued by A Background Job, so Its Nested Work Never Runs Inside A Frame's Wait)
+void JobSystem::run(const std::function<void(void)> &job, JobCounterStruct *counter, const char *name) {
+    if(counter != nullptr) counter->count.fetch_add(1, std::memory_order_relaxed);
+    JobStruct queuedJob{job, counter, name, runningBackgroundJob};
+    dispatchJob(queuedJob);
+}
+
+// Queue A Low Priority Job
+void JobSystem::runBackground(const std::function<void(void)> &job, JobCounterStruct *counter, const char *name) {
+    if(counter != nullptr) counter->count.fetch_add(1, std::memory_order_relaxed);
+    JobStruct queuedJob{job, counter, name, true};
+    dispatchJob(queuedJob);
+}
+
+// Queue A Job Once Every Job Counted by dependency Has Finished
+void JobSystem::runAfter(JobCounterStruct &dependency, const std::function<void(void)> &job, JobCounterStruct *counter, const char *name) {
+    {
+        std::lock_guard<std::mutex> lock(dependency.mutex);
+        if(dependency.count.load(std::memory_order_acquire) > 0) {
+            if(counter != nullptr) counter->count.fetch_add(1, std::memory_order_relaxed);
+            dependency.continuations.push_back({job, counter, name, runningBackgroundJob});
+            return;
+        }
+    }
+    JobSystem::run(job, counter, name);
+}
+
+// Run Queued Jobs on The Calling Thread Until counter Reaches Zero
+// Waits Inside A Background Job Also Run The Background Jobs counter Counts (Their Own Nested Jobs), Other Waits Never Run Background Jobs so A Frame Never Picks Up A Load
+void JobSystem::wait(JobCounterStruct &counter) {
+    JobWorkerStruct &worker = currentWorker != nullptr ? *currentWorker : waitingThreads;
+    while(counter.count.load(std::memory_order_acquire) > 0) {
+        JobStruct job;
+        bool stolen;
+        if(takeJob(job, stolen)) executeJob(job, worker, stolen);
+        else if(runningBackgroundJob && takeCountedBackgroundJob(counter, job)) executeJob(job, worker, false);
+        else std::this_thread::yield();
+    }
+
+    // The Last Job's Thread May Still Hold The Counter's Lock
+    std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+// Call body(begin, end) For Every Range of batchSize in [0, count) in Parallel
+void JobSystem::parallelFor(const std::size_t &count, const std::size_t &batchSize, const std::function<void(std::size_t, std::size_t)> &body, const char *name) {
+    if(count == 0) return;
+    const std::size_t rangeSize{std::max<std::size_t>(batchSize, 1)};
+
+    // Queue Every Range But The First, Which The Calling Thread Runs Itself Before Helping With The Rest
+    // Jobs Only Capture A Reference and Their Range Start so They Fit Inside std::function Without A Heap Allocation
+    JobCounterStruct counter;
+    auto runRange = [&body, rangeSize, count](const std::size_t begin) {body(begin, std::min(begin + rangeSize, count));};
+    for(std::size_t begin = rangeSize; begin < count; begin += rangeSize) {
+        JobSystem::run([&runRange, begin](void) {runRange(begin);}, &counter, name);
+    }
+    {
+        CPU_PROFILE_SCOPE(name);
+        body(0, std::min(rangeSize, count));
+    }
+    JobSystem::wait(counter);
+}
+
+// Number of Worker Threads
+unsigned int JobSystem::getWorkerCount(void) {
+    return workers.size();
+}
+
+// Most Workers Running Background Jobs at Once (One Less Than The Worker Count, Unless There's Only One)
+unsigned int JobSystem::getBackgroundWorkerLimit(void) {
+    return backgroundWorkerLimit;
+}
+
+// Statistics of Every Worker (And The Threads That Ran Jobs While Waiting) Since The Previous Call
+std::vector<JobWorkerStatsStruct> JobSystem::getStats(void) {
+    const std::chrono::steady_clock::time_point statsEndTime{std::chrono::steady_clock::now()};
+    const double periodNanoseconds{std::max(std::chrono::duration<double, std::nano>(statsEndTime - statsStartTime).count(), 1.0)};
+    statsStartTime = statsEndTime;
+
+    std::vector<JobWorkerStatsStruct> stats;
+    auto addWorkerStats = [&](JobWorkerStruct &worker) {
+        const std::uint64_t executedJobCount{worker.executedJobCount.load(std::memory_order_relaxed)}, stolenJobCount{worker.stolenJobCount.load(std::memory_order_relaxed)};
+        const std::uint64_t busyNanoseconds{worker.busyNanoseconds.load(std::memory_order_relaxed)};
+        stats.push_back({worker.name, executedJobCount - worker.lastExecutedJobCount, stolenJobCount - worker.lastStolenJobCount, (float)((double)(busyNanoseconds - worker.lastBusyNanoseconds) / periodNanoseconds)});
+        worker.lastExecutedJobCount = executedJobCount;
+        worker.lastStolenJobCount = stolenJobCount;
+        worker.lastBusyNanoseconds = busyNanoseconds;
+    };
+    for(std::unique_ptr<JobWorkerStruct> &worker : workers) addWorkerStats(*worker);
+    addWorkerStats(waitingThreads);
+    return stats;
+}
+
+// Statistics as Text (Utilization is The Share of The Period Spent Running Jobs)
+std::string JobSystem::getStatsReport(void) {
+    std::ostringstream report;
+    report.precision(1);
+    report << std::fixed;
+    const std::vector<JobWorkerStatsStruct> stats{JobSystem::getStats()};
+    for(unsigned int i = 0; i < stats.size(); i++) {
+        report << (i == 0 ? "" : ", ") << stats[i].name << " " << stats[i].utilization * 100.0f << "% (" << stats[i].executedJobCount << " Jobs, " << stats[i].stolenJobCount << " Stolen)";
+    }
+    return report.str();
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+// Standard Headers
+#include<iostream>
+#include<vector>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+#include<glm/gtc/matrix_transform.hpp>
+
+// Custom Engine Headers
+#include"../Shader/Shader.hpp"
+#include"../Culling/Culling.hpp"
+
+// Light Types
+enum LightType : unsigned int {
+    LIGHT_TYPE_POINT = 0,
+    LIGHT_TYPE_SPOT = 1,
+};
+
+// Light Struct
+struct LightStruct {
+    // Light Type
+    LightType type{LIGHT_TYPE_POINT};
+
+    // Position and Direction (Direction Points From The Fragment Towards The Light, Only Used by Spotlights)
+    glm::vec3 position{0.0f}, direction{0.0f, 0.0f, 1.0f};
+
+    // Inner and Outer Cut Off Cosines (Only Used by Spotlights)
+    float innerCutOff{1.0f}, outerCutOff{1.0f};
+
+    // Lighting Intensity Values
+    glm::vec3 ambientIntensity{0.0f}, diffusionIntensity{1.0f}, specularIntensity{1.0f};
+
+    // Lighting Attenuation Values
+    float attenuationConstant{1.0f}, attenuationLinear{0.09f}, attenuationQuadratic{0.032f};
+
+    // Shadows - First Shadow Atlas Tile of The Light (Set by ShadowAtlas::update, -1 = No Shadow)
+    bool castsShadows{false};
+    int shadowIndex{-1};
+};
+
+// Clustered Lighting Class - Assigns Lights to A View Frustum Froxel Grid so Fragments Only Loop Over Nearby Lights
+class ClusteredLighting {
+    public:
+        // Constructor - Create Light Storage Buffers
+        ClusteredLighting(const unsigned int &clusterCountX, const unsigned int &clusterCountY, const unsigned int &clusterCountZ, const unsigned int &maxLightsPerCluster);
+
+        // Assign Lights to Clusters on The CPU (Across The Job System's Workers) and Upload The Results
+        void update(const std::vector<LightStruct> &lights, const glm::mat4 &viewMatrix, const float &camFOV, const unsigned int &screenWidth, const unsigned int &screenHeight, const float &zNear, const float &zFar);
+
+        // Bind Light Storage Buffers and Send Cluster Grid Properties to A Shader
+        void setUniforms(Shader &shader);
+
+        // Calculate How Far A Light Reaches Before Its Attenuated Intensity Drops Below 1/256
+        static float calculateLightRange(const LightStruct &light);
+
+        // Getters
+        unsigned int getClusterCount(void) {return this->clusterCountX * this->clusterCountY * this->clusterCountZ;}
+        unsigned int getLightCount(void) {return this->lightCount;}
+        unsigned int getAssignedLightIndexCount(void) {return this->assignedLightIndexCount;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Cluster Grid Dimensions
+        unsigned int clusterCountX, clusterCountY, clusterCountZ;
+        unsigned int maxLightsPerCluster;
+
+        // Cluster Grid Properties The Cluster Bounds Were Built For
+        float clusterFOV{0.0f}, clusterAspectRatio{0.0f}, zNear{0.0f}, zFar{0.0f};
+        unsigned int screenWidth{0}, screenHeight{0};
+        glm::mat4 viewMatrix{1.0f};
+
+        // View Space Cluster Bounds
+        std::vector<BoundingBox> clusterBounds;
+
+        // Per Cluster Light Lists (Offset and Count Into The Light Index List)
+        std::vector<glm::uvec2> lightGrid;
+        std::vector<unsigned int> lightIndexList;
+        unsigned int lightCount{0}, assignedLightIndexCount{0};
+
+        // Shader Storage Buffer Objects - Lights, Light Grid and Light Index List
+        GLuint lightSSBO, lightGridSSBO, lightIndexSSBO;
+
+        // Build View Space Cluster Bounds For A Projection
+        void buildClusterBounds(const float &camFOV, const float &aspectRatio, const float &zNear, const float &zFar);
+};
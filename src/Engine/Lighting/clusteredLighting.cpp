@@ -0,0 +1,224 @@
+#include"ClusteredLighting.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+#include"../Jobs/JobSystem.hpp"
+#include"../Memory/FrameArena.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
+
+// GPU Light Struct (Matches The std430 Layout of The Light Buffer in lighting.glsl)
+struct GPULightStruct {
+    glm::vec4 positionRange;
+    glm::vec4 directionType;
+    glm::vec4 ambientIntensityInnerCutOff;
+    glm::vec4 diffusionIntensityOuterCutOff;
+    glm::vec4 specularIntensity;
+    glm::vec4 attenuation;
+};
+
+// Light Culling Data (View Space Bounding Sphere and The Depth Slices it Touches)
+struct LightCullStruct {
+    glm::vec3 viewPos;
+    float range;
+    unsigned int firstSlice, lastSlice;
+};
+
+// Constructor - Create Light Storage Buffers
+ClusteredLighting::ClusteredLighting(const unsigned int &clusterCountX, const unsigned int &clusterCountY, const unsigned int &clusterCountZ, const unsigned int &maxLightsPerCluster) {
+    // Set Cluster Grid Dimensions
+    this->clusterCountX = clusterCountX;
+    this->clusterCountY = clusterCountY;
+    this->clusterCountZ = clusterCountZ;
+    this->maxLightsPerCluster = maxLightsPerCluster;
+
+    // Create Shader Storage Buffer Objects
+    glGenBuffers(1, &this->lightSSBO);
+    glGenBuffers(1, &this->lightGridSSBO);
+    glGenBuffers(1, &this->lightIndexSSBO);
+}
+
+// Calculate How Far A Light Reaches Before Its Attenuated Intensity Drops Below 1/256
+float ClusteredLighting::calculateLightRange(const LightStruct &light) {
+    // Brightest Color Channel The Light Can Contribute
+    const glm::vec3 totalIntensity{light.ambientIntensity + light.diffusionIntensity + light.specularIntensity};
+    const float maxIntensity{std::max({totalIntensity.r, totalIntensity.g, totalIntensity.b})};
+
+    // Solve maxIntensity / (Constant + Linear * d + Quadratic * d^2) = 1/256 For d
+    const float c{light.attenuationConstant - 256.0f * maxIntensity}, b{light.attenuationLinear}, a{light.attenuationQuadratic};
+    if(c >= 0.0f) return 0.0f;
+    if(a > 0.0f) return (-b + std::sqrt(b * b - 4.0f * a * c)) / (2.0f * a);
+    if(b > 0.0f) return -c / b;
+
+    // Unattenuated Lights Reach Everything
+    return INFINITY;
+}
+
+// Build View Space Cluster Bounds For A Projection
+void ClusteredLighting::buildClusterBounds(const float &camFOV, const float &aspectRatio, const float &zNear, const float &zFar) {
+    // Half Extents of The View Frustum at A Depth of 1
+    const float tanHalfFOV{std::tan(glm::radians(camFOV) * 0.5f)};
+    const glm::vec2 halfExtents{tanHalfFOV * aspectRatio, tanHalfFOV};
+
+    // Calculate The Bounds of Every Cluster
+    this->clusterBounds.resize(this->getClusterCount());
+    for(unsigned int z = 0; z < this->clusterCountZ; z++) {
+        // Exponential Depth Slices so Clusters Stay Roughly Cubic
+        const float sliceNear{zNear * std::pow(zFar / zNear, (float)z / this->clusterCountZ)};
+        const float sliceFar{zNear * std::pow(zFar / zNear, (float)(z + 1) / this->clusterCountZ)};
+        for(unsigned int y = 0; y < this->clusterCountY; y++) {
+            for(unsigned int x = 0; x < this->clusterCountX; x++) {
+                // Tile Corners in Normalized Device Coordinates
+                const glm::vec2 tileMin{-1.0f + 2.0f * x / this->clusterCountX, -1.0f + 2.0f * y / this->clusterCountY};
+                const glm::vec2 tileMax{-1.0f + 2.0f * (x + 1) / this->clusterCountX, -1.0f + 2.0f * (y + 1) / this->clusterCountY};
+
+                // Bounds of The Tile's Corners at The Slice's Near and Far Depth (Camera Looks Down -Z)
+                BoundingBox bounds{glm::vec3(INFINITY), glm::vec3(-INFINITY)};
+                for(const float depth : {sliceNear, sliceFar}) {
+                    for(const glm::vec2 &corner : {tileMin, tileMax, glm::vec2(tileMin.x, tileMax.y), glm::vec2(tileMax.x, tileMin.y)}) {
+                        const glm::vec3 point{corner * halfExtents * depth, -depth};
+                        bounds.min = glm::min(bounds.min, point);
+                        bounds.max = glm::max(bounds.max, point);
+                    }
+                }
+                this->clusterBounds[x + this->clusterCountX * (y + this->clusterCountY * z)] = bounds;
+            }
+        }
+    }
+}
+
+// Assign Lights to Clusters on The CPU (Across The Job System's Workers) and Upload The Results
+void ClusteredLighting::update(const std::vector<LightStruct> &lights, const glm::mat4 &viewMatrix, const float &camFOV, const unsigned int &screenWidth, const unsigned int &screenHeight, const float &zNear, const float &zFar) {
+    // Rebuild Cluster Bounds Only When The Projection Changed
+    const float aspectRatio{(float)screenWidth / (float)screenHeight};
+    if(this->clusterBounds.empty() || camFOV != this->clusterFOV || aspectRatio != this->clusterAspectRatio || zNear != this->zNear || zFar != this->zFar) {
+        this->buildClusterBounds(camFOV, aspectRatio, zNear, zFar);
+        this->clusterFOV = camFOV;
+        this->clusterAspectRatio = aspectRatio;
+        this->zNear = zNear;
+        this->zFar = zFar;
+    }
+    this->screenWidth = screenWidth;
+    this->screenHeight = screenHeight;
+    this->viewMatrix = viewMatrix;
+
+    // Pack Lights For The GPU and Find The Depth Slices Each Light Touches (Scratch Lists Live in The Frame Arena)
+    FrameVector<GPULightStruct> gpuLights;
+    FrameVector<LightCullStruct> cullLights;
+    gpuLights.reserve(lights.size());
+    cullLights.reserve(lights.size());
+    const float logDepthRatio{std::log(zFar / zNear)};
+    for(const LightStruct &light : lights) {
+        const float range{calculateLightRange(light)};
+        gpuLights.push_back({
+            glm::vec4(light.position, range),
+            glm::vec4(glm::normalize(light.direction), (float)light.type),
+            glm::vec4(light.ambientIntensity, light.innerCutOff),
+            glm::vec4(light.diffusionIntensity, light.outerCutOff),
+            glm::vec4(light.specularIntensity, (float)light.shadowIndex),
+            glm::vec4(light.attenuationConstant, light.attenuationLinear, light.attenuationQuadratic, 0.0f),
+        });
+
+        // View Space Depth Range of The Light's Bounding Sphere
+        const glm::vec3 viewPos{viewMatrix * glm::vec4(light.position, 1.0f)};
+        const float nearDepth{std::max(-viewPos.z - range, zNear)}, farDepth{std::min(-viewPos.z + range, zFar)};
+        LightCullStruct cullLight{viewPos, range, 1, 0};
+        if(nearDepth <= farDepth) {
+            // Convert Depth Range to Slice Range
+            cullLight.firstSlice = (unsigned int)std::clamp(std::floor(std::log(nearDepth / zNear) / logDepthRatio * this->clusterCountZ), 0.0f, (float)this->clusterCountZ - 1.0f);
+            cullLight.lastSlice = (unsigned int)std::clamp(std::floor(std::log(farDepth / zNear) / logDepthRatio * this->clusterCountZ), 0.0f, (float)this->clusterCountZ - 1.0f);
+        }
+        cullLights.push_back(cullLight);
+    }
+
+    // Fixed Capacity Per Cluster Light Lists (Each Cluster is Written by Exactly One Job)
+    const unsigned int clusterCount{this->getClusterCount()}, clustersPerSlice{this->clusterCountX * this->clusterCountY};
+    FrameVector<unsigned int> clusterLightCounts(clusterCount, 0);
+    FrameVector<unsigned int> clusterLightIndices((std::size_t)clusterCount * this->maxLightsPerCluster);
+
+    // Assign Lights to The Clusters of A Range of Depth Slices
+    auto assignLights = [&](const unsigned int firstSlice, const unsigned int lastSlice) {
+        for(unsigned int slice = firstSlice; slice < lastSlice; slice++) {
+            for(unsigned int i = 0; i < cullLights.size(); i++) {
+                // Skip Lights That Don't Reach This Depth Slice
+                const LightCullStruct &cullLight = cullLights[i];
+                if(slice < cullLight.firstSlice || slice > cullLight.lastSlice) continue;
+
+                // Test The Light Against The Clusters in The Slice
+                // A Cluster's Y Range Only Depends on Its Row and Its X Range Only on Its Column, so Whole Rows and Columns Can Be Skipped
+                for(unsigned int y = 0; y < this->clusterCountY; y++) {
+                    const unsigned int rowStart{slice * clustersPerSlice + y * this->clusterCountX};
+                    const BoundingBox &rowBounds = this->clusterBounds[rowStart];
+                    if(cullLight.viewPos.y + cullLight.range < rowBounds.min.y || cullLight.viewPos.y - cullLight.range > rowBounds.max.y) continue;
+                    for(unsigned int cluster = rowStart; cluster < rowStart + this->clusterCountX; cluster++) {
+                        const BoundingBox &bounds = this->clusterBounds[cluster];
+                        if(cullLight.viewPos.x + cullLight.range < bounds.min.x) break;
+                        if(cullLight.viewPos.x - cullLight.range > bounds.max.x || clusterLightCounts[cluster] >= this->maxLightsPerCluster) continue;
+                        if(Culling::sphereIntersectsBox(cullLight.viewPos, cullLight.range, bounds)) {
+                            clusterLightIndices[(std::size_t)cluster * this->maxLightsPerCluster + clusterLightCounts[cluster]++] = i;
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    // One Job Per Depth Slice
+    if(!lights.empty()) {
+        JobSystem::parallelFor(this->clusterCountZ, 1, [&assignLights](const std::size_t firstSlice, const std::size_t lastSlice) {
+            assignLights(firstSlice, lastSlice);
+        }, "Assign Lights");
+    }
+
+    // Compact Per Cluster Light Lists Into One Light Index List
+    this->lightGrid.resize(clusterCount);
+    this->lightIndexList.clear();
+    for(unsigned int cluster = 0; cluster < clusterCount; cluster++) {
+        this->lightGrid[cluster] = glm::uvec2(this->lightIndexList.size(), clusterLightCounts[cluster]);
+        const auto first = clusterLightIndices.begin() + (std::size_t)cluster * this->maxLightsPerCluster;
+        this->lightIndexList.insert(this->lightIndexList.end(), first, first + clusterLightCounts[cluster]);
+    }
+    this->lightCount = lights.size();
+    this->assignedLightIndexCount = this->lightIndexList.size();
+
+    // Upload Lights, Light Grid and Light Index List (Orphaning Last Frame's Storage)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->lightSSBO);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, std::max<std::size_t>(gpuLights.size(), 1) * sizeof(GPULightStruct), gpuLights.empty() ? nullptr : gpuLights.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->lightGridSSBO);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, this->lightGrid.size() * sizeof(glm::uvec2), this->lightGrid.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->lightIndexSSBO);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, std::max<std::size_t>(this->lightIndexList.size(), 1) * sizeof(unsigned int), this->lightIndexList.empty() ? nullptr : this->lightIndexList.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    GPUMemoryTracker::trackBuffer(this->lightSSBO, std::max<std::size_t>(gpuLights.size(), 1) * sizeof(GPULightStruct), "Clustered Lighting");
+    GPUMemoryTracker::trackBuffer(this->lightGridSSBO, this->lightGrid.size() * sizeof(glm::uvec2), "Clustered Lighting");
+    GPUMemoryTracker::trackBuffer(this->lightIndexSSBO, std::max<std::size_t>(this->lightIndexList.size(), 1) * sizeof(unsigned int), "Clustered Lighting");
+}
+
+// Bind Light Storage Buffers and Send Cluster Grid Properties to A Shader
+void ClusteredLighting::setUniforms(Shader &shader) {
+    // Bind Shader Storage Buffer Objects to The Binding Points Used in lighting.glsl
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, this->lightSSBO);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, this->lightGridSSBO);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, this->lightIndexSSBO);
+
+    // Send Cluster Grid Properties
+    shader.setIVec3("clusterGridSize", glm::ivec3(this->clusterCountX, this->clusterCountY, this->clusterCountZ));
+    shader.setVec2("clusterScreenSize", (float)this->screenWidth, (float)this->screenHeight);
+    shader.setFloat("clusterZNear", this->zNear);
+    shader.setFloat("clusterZFar", this->zFar);
+    shader.setMat4("clusterViewMatrix", this->viewMatrix);
+}
+
+// Destroy
+void ClusteredLighting::destroy(void) {
+    // Delete Shader Storage Buffer Objects
+    GPUMemoryTracker::untrack(GL_BUFFER, this->lightSSBO);
+    GPUMemoryTracker::untrack(GL_BUFFER, this->lightGridSSBO);
+    GPUMemoryTracker::untrack(GL_BUFFER, this->lightIndexSSBO);
+    glDeleteBuffers(1, &this->lightSSBO);
+    glDeleteBuffers(1, &this->lightGridSSBO);
+    glDeleteBuffers(1, &this->lightIndexSSBO);
+}
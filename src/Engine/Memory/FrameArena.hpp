@@ -0,0 +1,82 @@
+#pragma once
+
+// Standard Headers
+#include<new>
+#include<limits>
+#include<string>
+#include<vector>
+#include<cstddef>
+#include<cstdint>
+
+// Frame Arena Statistics of The Calling Thread
+struct FrameArenaStatsStruct {
+    std::size_t capacity{0}, usedBytes{0}, peakUsedBytes{0};
+    std::uint64_t overflowCount{0};
+};
+
+// Frame Arena Class - Per Thread Bump Allocator For Data That Only Lives For A Frame (Draw Lists, Uniform Names, Sort Buffers)
+// Every Thread Has Two Buffers - beginFrame() Swaps Them and Empties The New One, so Anything Allocated Stays Valid Until The End of The Next Frame
+// Allocating Just Moves An Offset and Freeing Does Nothing, Allocations That Don't Fit (Or On Threads Without An Arena) Fall Back to The Heap
+// Free Memory on The Thread That Allocated it (Only The Calling Thread's Buffers Are Recognized, Anything Else is Handed to free())
+class FrameArena {
+    public:
+        // Give The Calling Thread Two Buffers of capacity Bytes / Free Them
+        static void initializeThread(const std::size_t &capacity);
+        static void shutdownThread(void);
+
+        // Start The Calling Thread's Next Frame (Memory From Two Frames Ago is Reused)
+        static void beginFrame(void);
+
+        // Allocate / Free Memory in The Calling Thread's Arena
+        static void *allocate(const std::size_t &size, const std::size_t &alignment);
+        static void deallocate(void *memory);
+
+        // printf Into The Calling Thread's Arena (Uniform Names Like "cascadeLightPV[2]")
+        static const char *format(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+        // Getters
+        static FrameArenaStatsStruct getStats(void);
+};
+
+// Frame Arena Allocator - STL Allocator Backed by The Allocating Thread's Frame Arena
+template<typename T>
+class FrameArenaAllocator {
+    public:
+        typedef T value_type;
+        FrameArenaAllocator(void) noexcept {}
+        template<typename U> FrameArenaAllocator(const FrameArenaAllocator<U>&) noexcept {}
+        T *allocate(const std::size_t count) {
+            if(count > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+            return (T*)FrameArena::allocate(count * sizeof(T), alignof(T));
+        }
+        void deallocate(T *memory, const std::size_t) noexcept {FrameArena::deallocate(memory);}
+        template<typename U> bool operator==(const FrameArenaAllocator<U>&) const noexcept {return true;}
+        template<typename U> bool operator!=(const FrameArenaAllocator<U>&) const noexcept {return false;}
+};
+
+// Containers in The Frame Arena (Only For Data That Doesn't Outlive The Next Frame)
+typedef std::basic_string<char, std::char_traits<char>, FrameArenaAllocator<char>> FrameString;
+template<typename T> using FrameVector = std::vector<T, FrameArenaAllocator<T>>;
+
+// Heap Tracker Class - Counts Global operator new Calls Per Thread When The Build Defines HEAP_TRACKING_ENABLED (CMake Option HEAP_TRACKING)
+class HeapTracker {
+    public:
+        // Whether Allocations Are Being Counted
+        static bool isEnabled(void);
+
+        // Allocations Made by The Calling Thread Since it Started (Paused Allocations Aside)
+        static std::uint64_t getThreadAllocationCount(void);
+
+        // Stop / Restart Counting The Calling Thread's Allocations (Nests)
+        static void pause(void);
+        static void resume(void);
+};
+
+// Heap Tracker Pause Scope - The Calling Thread's Allocations Aren't Counted While it Lives (Work That May Allocate Inside A Checked Frame, Like Streaming or Logging)
+class HeapTrackerPauseScope {
+    public:
+        HeapTrackerPauseScope(void) {HeapTracker::pause();}
+        ~HeapTrackerPauseScope(void) {HeapTracker::resume();}
+        HeapTrackerPauseScope(const HeapTrackerPauseScope&) = delete;
+        HeapTrackerPauseScope &operator=(const HeapTrackerPauseScope&) = delete;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<cstdint>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// GPU Memory Categories
+enum GPUMemoryCategory : unsigned int {
+    GPU_MEMORY_BUFFER = 0,          // Vertex, Index and Storage Buffers
+    GPU_MEMORY_TEXTURE,             // Sampled Image Textures (Model Materials, Skyboxes)
+    GPU_MEMORY_RENDER_TARGET,       // Textures Rendered Into (Framebuffer Attachments, Shadow Maps, Render Graph Targets)
+    GPU_MEMORY_RENDERBUFFER,        // Renderbuffers (Depth and Stencil Buffers Never Sampled)
+    GPU_MEMORY_CATEGORY_COUNT,
+};
+
+// Tracked Memory of One Owner in One Category
+struct GPUMemoryOwnerStatsStruct {
+    std::string owner;
+    GPUMemoryCategory category{GPU_MEMORY_BUFFER};
+    std::uint64_t bytes{0};
+    unsigned int objectCount{0};
+};
+
+// Tracked Memory Totals (Estimates From Sizes and Formats - Drivers Add Padding, Alignment and Compression of Their Own)
+struct GPUMemoryStatsStruct {
+    std::uint64_t totalBytes{0}, peakBytes{0};
+    unsigned int objectCount{0};
+    std::uint64_t categoryBytes[GPU_MEMORY_CATEGORY_COUNT]{};
+    unsigned int categoryObjectCounts[GPU_MEMORY_CATEGORY_COUNT]{};
+    std::vector<GPUMemoryOwnerStatsStruct> owners;
+};
+
+// Video Memory Reported by The Driver (GL_NVX_gpu_memory_info on NVIDIA, GL_ATI_meminfo on AMD - ATI Doesn't Report A Total)
+struct GPUDriverMemoryStruct {
+    bool available{false};
+    const char *source{"None"};
+    std::uint64_t totalBytes{0}, availableBytes{0}, evictedBytes{0};
+    unsigned int evictionCount{0};
+};
+
+// GPU Memory Tracker Class - Buffers, Textures and Renderbuffers Register Their Estimated Size With An Owner Name When Created and Unregister When Deleted
+// so Memory Can Be Broken Down by Category and Owner (Capacity Planning) and Objects Still Registered at Shutdown Point at Leaks
+// Objects Are Keyed by Their OpenGL Name so Tracking An Object Again (e.g. After Resizing A Buffer) Replaces Its Old Size, Safe on Any Thread
+class GPUMemoryTracker {
+    public:
+        // Register An Object (owner Must Outlive The Object - Use String Literals)
+        static void trackBuffer(const GLuint &buffer, const std::uint64_t &bytes, const char *owner);
+        static void trackTexture(const GLuint &texture, const GPUMemoryCategory &category, const GLenum &internalFormat, const unsigned int &width, const unsigned int &height, const unsigned int &layerCount, const unsigned int &mipLevelCount, const unsigned int &sampleCount, const char *owner);
+        static void trackRenderbuffer(const GLuint &renderbuffer, const GLenum &internalFormat, const unsigned int &width, const unsigned int &height, const unsigned int &sampleCount, const char *owner);
+
+        // Unregister Objects Being Deleted (objectType is GL_BUFFER, GL_TEXTURE or GL_RENDERBUFFER, Unknown Names and 0 Are Ignored)
+        static void untrack(const GLenum &objectType, const GLuint &object);
+        static void untrack(const GLenum &objectType, const GLsizei &objectCount, const GLuint *objects);
+
+        // Estimated Size of A Texture (Every Mip Level of Every Layer and Sample) / Of One Texel of An Internal Format
+        static std::uint64_t estimateTextureBytes(const GLenum &internalFormat, const unsigned int &width, const unsigned int &height, const unsigned int &layerCount, const unsigned int &mipLevelCount, const unsigned int &sampleCount);
+        static unsigned int getBytesPerTexel(const GLenum &internalFormat);
+
+        // Video Memory Reported by The Driver (Call on A Thread With A Current Context)
+        static GPUDriverMemoryStruct queryDriverMemory(void);
+
+        // Getters (The Report - Totals Then One Line Per Owner - Queries The Driver Too so Also Needs A Current Context)
+        static std::uint64_t getTrackedBytes(void);
+        static GPUMemoryStatsStruct getStats(void);
+        static std::string getStatsReport(void);
+};
@@ -0,0 +1,114 @@
+#include"FrameArena.hpp"
+
+// Standard Headers
+#include<cstdio>
+#include<cstdlib>
+#include<cstdarg>
+#include<algorithm>
+
+// Calling Thread's Arena - Two Buffers, The Current One Fills Up From offset
+struct FrameArenaThreadStruct {
+    std::byte *buffers[2]{nullptr, nullptr};
+    std::size_t capacity{0}, offset{0}, peakUsedBytes{0};
+    std::uint64_t overflowCount{0};
+    unsigned int currentBuffer{0};
+    ~FrameArenaThreadStruct(void) {
+        std::free(this->buffers[0]);
+        std::free(this->buffers[1]);
+    }
+};
+static thread_local FrameArenaThreadStruct threadArena;
+
+// Give The Calling Thread Two Buffers
+void FrameArena::initializeThread(const std::size_t &capacity) {
+    shutdownThread();
+    threadArena.buffers[0] = (std::byte*)std::malloc(capacity);
+    threadArena.buffers[1] = (std::byte*)std::malloc(capacity);
+    threadArena.capacity = threadArena.buffers[0] != nullptr && threadArena.buffers[1] != nullptr ? capacity : 0;
+}
+
+// Free The Calling Thread's Buffers
+void FrameArena::shutdownThread(void) {
+    std::free(threadArena.buffers[0]);
+    std::free(threadArena.buffers[1]);
+    threadArena = FrameArenaThreadStruct{};
+}
+
+// Start The Calling Thread's Next Frame
+void FrameArena::beginFrame(void) {
+    threadArena.currentBuffer ^= 1;
+    threadArena.offset = 0;
+}
+
+// Allocate Memory in The Calling Thread's Arena (The Heap if it Doesn't Fit)
+void *FrameArena::allocate(const std::size_t &size, const std::size_t &alignment) {
+    const std::size_t alignedOffset{(threadArena.offset + alignment - 1) & ~(alignment - 1)};
+    if(threadArena.capacity != 0 && alignedOffset + size <= threadArena.capacity) {
+        threadArena.offset = alignedOffset + size;
+        threadArena.peakUsedBytes = std::max(threadArena.peakUsedBytes, threadArena.offset);
+        return threadArena.buffers[threadArena.currentBuffer] + alignedOffset;
+    }
+    if(threadArena.capacity != 0) threadArena.overflowCount++;
+    void *memory{std::aligned_alloc(std::max(alignment, alignof(std::max_align_t)), (size + alignment - 1) / alignment * alignment)};
+    if(memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+// Free Memory - Nothing to Do For Arena Memory, Heap Fallbacks Are Freed
+void FrameArena::deallocate(void *memory) {
+    for(std::byte *buffer : threadArena.buffers) {
+        if(buffer != nullptr && (std::byte*)memory >= buffer && (std::byte*)memory < buffer + threadArena.capacity) return;
+    }
+    std::free(memory);
+}
+
+// printf Into The Calling Thread's Arena
+const char *FrameArena::format(const char *format, ...) {
+    va_list arguments, argumentsCopy;
+    va_start(arguments, format);
+    va_copy(argumentsCopy, arguments);
+    const int length{std::vsnprintf(nullptr, 0, format, argumentsCopy)};
+    va_end(argumentsCopy);
+    char *text{(char*)allocate(std::max(length, 0) + 1, 1)};
+    std::vsnprintf(text, std::max(length, 0) + 1, format, arguments);
+    va_end(arguments);
+    return text;
+}
+
+// Get The Calling Thread's Statistics
+FrameArenaStatsStruct FrameArena::getStats(void) {
+    return FrameArenaStatsStruct{threadArena.capacity, threadArena.offset, threadArena.peakUsedBytes, threadArena.overflowCount};
+}
+
+#ifdef HEAP_TRACKING_ENABLED
+// Global Allocation Functions Counting Every Allocation of The Calling Thread Unless Paused (Every Other operator new Form Forwards to These)
+static thread_local std::uint64_t threadAllocationCount{0};
+static thread_local unsigned int threadPauseDepth{0};
+void *operator new(std::size_t size) {
+    if(threadPauseDepth == 0) threadAllocationCount++;
+    void *memory{std::malloc(size == 0 ? 1 : size)};
+    if(memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    if(threadPauseDepth == 0) threadAllocationCount++;
+    const std::size_t alignmentBytes{std::max((std::size_t)alignment, sizeof(void*))};
+    void *memory{std::aligned_alloc(alignmentBytes, (std::max<std::size_t>(size, 1) + alignmentBytes - 1) / alignmentBytes * alignmentBytes)};
+    if(memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+void operator delete(void *memory) noexcept {std::free(memory);}
+void operator delete(void *memory, std::size_t) noexcept {std::free(memory);}
+void operator delete(void *memory, std::align_val_t) noexcept {std::free(memory);}
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept {std::free(memory);}
+
+bool HeapTracker::isEnabled(void) {return true;}
+std::uint64_t HeapTracker::getThreadAllocationCount(void) {return threadAllocationCount;}
+void HeapTracker::pause(void) {threadPauseDepth++;}
+void HeapTracker::resume(void) {threadPauseDepth--;}
+#else
+bool HeapTracker::isEnabled(void) {return false;}
+std::uint64_t HeapTracker::getThreadAllocationCount(void) {return 0;}
+void HeapTracker::pause(void) {}
+void HeapTracker::resume(void) {}
+#endif
@@ -0,0 +1,236 @@
+#include"GPUMemoryTracker.hpp"
+
+// Standard Headers
+#include<map>
+#include<mutex>
+#include<cstring>
+#include<sstream>
+#include<iomanip>
+#include<algorithm>
+#include<unordered_map>
+
+// Driver Memory Queries (Not in The Core Profile Headers) - NVX Values Are in KB, ATI Returns Four KB Values Per Pool (Free Memory First)
+#define GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX 0x9047
+#define GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX 0x9048
+#define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX 0x9049
+#define GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX 0x904A
+#define GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX 0x904B
+#define GL_TEXTURE_FREE_MEMORY_ATI 0x87FC
+
+// Tracked Object
+struct GPUMemoryObjectStruct {
+    GPUMemoryCategory category{GPU_MEMORY_BUFFER};
+    std::uint64_t bytes{0};
+    const char *owner{""};
+};
+
+// Tracked Objects Keyed by Object Type and Name (Names Are Only Unique Per Object Type)
+static std::mutex trackerMutex;
+static std::unordered_map<std::uint64_t, GPUMemoryObjectStruct> trackedObjects;
+static std::uint64_t trackedBytes{0}, peakTrackedBytes{0};
+
+// Driver Memory Extension Support (Checked Once)
+enum GPUDriverMemoryExtension : unsigned int {
+    DRIVER_MEMORY_UNCHECKED = 0,
+    DRIVER_MEMORY_NONE,
+    DRIVER_MEMORY_NVX,
+    DRIVER_MEMORY_ATI,
+};
+static GPUDriverMemoryExtension driverMemoryExtension{DRIVER_MEMORY_UNCHECKED};
+
+// Object Key
+static std::uint64_t getObjectKey(const GLenum &objectType, const GLuint &object) {
+    return (std::uint64_t)objectType << 32 | object;
+}
+
+// Category Names
+static const char *getCategoryName(const GPUMemoryCategory &category) {
+    switch(category) {
+        case GPU_MEMORY_BUFFER:
+            return "Buffers";
+        case GPU_MEMORY_TEXTURE:
+            return "Textures";
+        case GPU_MEMORY_RENDER_TARGET:
+            return "Render Targets";
+        case GPU_MEMORY_RENDERBUFFER:
+            return "Renderbuffers";
+        default:
+            return "Unknown";
+    }
+}
+
+// Register An Object (Replacing Its Old Size if Already Tracked)
+static void track(const GLenum &objectType, const GLuint &object, const GPUMemoryCategory &category, const std::uint64_t &bytes, const char *owner) {
+    if(object == 0) return;
+    std::lock_guard<std::mutex> lock(trackerMutex);
+    GPUMemoryObjectStruct &trackedObject = trackedObjects[getObjectKey(objectType, object)];
+    trackedBytes = trackedBytes - trackedObject.bytes + bytes;
+    peakTrackedBytes = std::max(peakTrackedBytes, trackedBytes);
+    trackedObject = GPUMemoryObjectStruct{category, bytes, owner};
+}
+
+// Register A Buffer
+void GPUMemoryTracker::trackBuffer(const GLuint &buffer, const std::uint64_t &bytes, const char *owner) {
+    track(GL_BUFFER, buffer, GPU_MEMORY_BUFFER, bytes, owner);
+}
+
+// Register A Texture
+void GPUMemoryTracker::trackTexture(const GLuint &texture, const GPUMemoryCategory &category, const GLenum &internalFormat, const unsigned int &width, const unsigned int &height, const unsigned int &layerCount, const unsigned int &mipLevelCount, const unsigned int &sampleCount, const char *owner) {
+    track(GL_TEXTURE, texture, category, estimateTextureBytes(internalFormat, width, height, layerCount, mipLevelCount, sampleCount), owner);
+}
+
+// Register A Renderbuffer
+void GPUMemoryTracker::trackRenderbuffer(const GLuint &renderbuffer, const GLenum &internalFormat, const unsigned int &width, const unsigned int &height, const unsigned int &sampleCount, const char *owner) {
+    track(GL_RENDERBUFFER, renderbuffer, GPU_MEMORY_RENDERBUFFER, estimateTextureBytes(internalFormat, width, height, 1, 1, sampleCount), owner);
+}
+
+// Unregister Objects
+void GPUMemoryTracker::untrack(const GLenum &objectType, const GLuint &object) {
+    untrack(objectType, 1, &object);
+}
+void GPUMemoryTracker::untrack(const GLenum &objectType, const GLsizei &objectCount, const GLuint *objects) {
+    std::lock_guard<std::mutex> lock(trackerMutex);
+    for(GLsizei i = 0; i < objectCount; i++) {
+        const auto trackedObject = trackedObjects.find(getObjectKey(objectType, objects[i]));
+        if(trackedObject == trackedObjects.end()) continue;
+        trackedBytes -= trackedObject->second.bytes;
+        trackedObjects.erase(trackedObject);
+    }
+}
+
+// Estimated Size of A Texture - Block Compressed Formats Store 4x4 Texel Blocks, Multisampled Textures Have No Mip Levels
+std::uint64_t GPUMemoryTracker::estimateTextureBytes(const GLenum &internalFormat, const unsigned int &width, const unsigned int &height, const unsigned int &layerCount, const unsigned int &mipLevelCount, const unsigned int &sampleCount) {
+    unsigned int bytesPerBlock{0};
+    switch(internalFormat) {
+        case GL_COMPRESSED_RED_RGTC1:
+        case GL_COMPRESSED_RGB8_ETC2:
+            bytesPerBlock = 8;
+            break;
+        case GL_COMPRESSED_RG_RGTC2:
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:
+            bytesPerBlock = 16;
+            break;
+    }
+    std::uint64_t bytes{0};
+    for(unsigned int mipLevel = 0; mipLevel < std::max(mipLevelCount, 1u); mipLevel++) {
+        const std::uint64_t mipWidth{std::max(width >> mipLevel, 1u)}, mipHeight{std::max(height >> mipLevel, 1u)};
+        bytes += bytesPerBlock > 0 ? (mipWidth + 3) / 4 * ((mipHeight + 3) / 4) * bytesPerBlock : mipWidth * mipHeight * getBytesPerTexel(internalFormat);
+    }
+    return bytes * std::max(layerCount, 1u) * std::max(sampleCount, 1u);
+}
+
+// Estimated Bytes Per Texel of An Internal Format (Drivers Pad Three Channel Formats to Four)
+unsigned int GPUMemoryTracker::getBytesPerTexel(const GLenum &internalFormat) {
+    switch(internalFormat) {
+        case GL_R8:
+        case GL_RED:
+            return 1;
+        case GL_RG8:
+        case GL_RG:
+        case GL_R16F:
+        case GL_DEPTH_COMPONENT16:
+            return 2;
+        case GL_RGB16F:
+        case GL_RGBA16F:
+        case GL_RG32F:
+        case GL_DEPTH32F_STENCIL8:
+            return 8;
+        case GL_RGB32F:
+        case GL_RGBA32F:
+            return 16;
+        default:
+            return 4;
+    }
+}
+
+// Video Memory Reported by The Driver
+GPUDriverMemoryStruct GPUMemoryTracker::queryDriverMemory(void) {
+    // Check Which Extension The Driver Supports
+    if(driverMemoryExtension == DRIVER_MEMORY_UNCHECKED) {
+        driverMemoryExtension = DRIVER_MEMORY_NONE;
+        GLint extensionCount{0};
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        for(GLint i = 0; i < extensionCount; i++) {
+            const char *extension{(const char*)glGetStringi(GL_EXTENSIONS, i)};
+            if(extension == nullptr) continue;
+            if(std::strcmp(extension, "GL_NVX_gpu_memory_info") == 0) driverMemoryExtension = DRIVER_MEMORY_NVX;
+            if(std::strcmp(extension, "GL_ATI_meminfo") == 0 && driverMemoryExtension != DRIVER_MEMORY_NVX) driverMemoryExtension = DRIVER_MEMORY_ATI;
+        }
+    }
+
+    // Query it
+    GPUDriverMemoryStruct driverMemory;
+    if(driverMemoryExtension == DRIVER_MEMORY_NVX) {
+        GLint totalKB{0}, availableKB{0}, evictionCount{0}, evictedKB{0};
+        glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &totalKB);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &availableKB);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX, &evictionCount);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX, &evictedKB);
+        driverMemory = GPUDriverMemoryStruct{true, "GL_NVX_gpu_memory_info", (std::uint64_t)totalKB * 1024, (std::uint64_t)availableKB * 1024, (std::uint64_t)evictedKB * 1024, (unsigned int)evictionCount};
+    } else if(driverMemoryExtension == DRIVER_MEMORY_ATI) {
+        GLint textureFreeMemory[4]{};
+        glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, textureFreeMemory);
+        driverMemory.available = true;
+        driverMemory.source = "GL_ATI_meminfo";
+        driverMemory.availableBytes = (std::uint64_t)textureFreeMemory[0] * 1024;
+    }
+    return driverMemory;
+}
+
+// Get Total Tracked Bytes
+std::uint64_t GPUMemoryTracker::getTrackedBytes(void) {
+    std::lock_guard<std::mutex> lock(trackerMutex);
+    return trackedBytes;
+}
+
+// Get Statistics (Owners Sorted by Size, Largest First)
+GPUMemoryStatsStruct GPUMemoryTracker::getStats(void) {
+    GPUMemoryStatsStruct stats;
+    std::map<std::pair<std::string, GPUMemoryCategory>, GPUMemoryOwnerStatsStruct> owners;
+    {
+        std::lock_guard<std::mutex> lock(trackerMutex);
+        stats.totalBytes = trackedBytes;
+        stats.peakBytes = peakTrackedBytes;
+        stats.objectCount = trackedObjects.size();
+        for(const auto &[key, trackedObject] : trackedObjects) {
+            stats.categoryBytes[trackedObject.category] += trackedObject.bytes;
+            stats.categoryObjectCounts[trackedObject.category]++;
+            GPUMemoryOwnerStatsStruct &owner = owners[{trackedObject.owner, trackedObject.category}];
+            owner.bytes += trackedObject.bytes;
+            owner.objectCount++;
+        }
+    }
+    for(auto &[ownerKey, owner] : owners) {
+        owner.owner = ownerKey.first;
+        owner.category = ownerKey.second;
+        stats.owners.push_back(owner);
+    }
+    std::sort(stats.owners.begin(), stats.owners.end(), [](const GPUMemoryOwnerStatsStruct &a, const GPUMemoryOwnerStatsStruct &b) {return a.bytes > b.bytes;});
+    return stats;
+}
+
+// Get Statistics as A Report - Totals on The First Line, Then One Line Per Owner
+std::string GPUMemoryTracker::getStatsReport(void) {
+    const GPUMemoryStatsStruct stats{getStats()};
+    const GPUDriverMemoryStruct driverMemory{queryDriverMemory()};
+    const double bytesPerMB{1024.0 * 1024.0};
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << stats.totalBytes / bytesPerMB << "MB in " << stats.objectCount << " Objects (Peak " << stats.peakBytes / bytesPerMB << "MB)";
+    for(unsigned int category = 0; category < GPU_MEMORY_CATEGORY_COUNT; category++) {
+        report << (category == 0 ? " | " : ", ") << getCategoryName((GPUMemoryCategory)category) << " " << stats.categoryBytes[category] / bytesPerMB << "MB";
+    }
+    if(driverMemory.available) {
+        report << " | Driver: " << driverMemory.availableBytes / bytesPerMB << "MB Free";
+        if(driverMemory.totalBytes > 0) report << " of " << driverMemory.totalBytes / bytesPerMB << "MB";
+        if(driverMemory.evictionCount > 0) report << ", " << driverMemory.evictionCount << " Evictions (" << driverMemory.evictedBytes / bytesPerMB << "MB)";
+        report << " (" << driverMemory.source << ")";
+    }
+    report << "\n";
+    for(const GPUMemoryOwnerStatsStruct &owner : stats.owners) {
+        report << "  " << owner.owner << " (" << getCategoryName(owner.category) << "): " << owner.bytes / bytesPerMB << "MB in " << owner.objectCount << " Objects\n";
+    }
+    return report.str();
+}
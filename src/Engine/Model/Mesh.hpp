@@ -11,6 +11,10 @@
 
 // Custom Engine Headers
 #include"../Shader/Shader.hpp"
+#include"../Shader/ShaderVariants.hpp"
+#include"../Culling/Culling.hpp"
+#include"../Renderer/DrawStats.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
 
 // Vertex Struct
 struct VertexStruct {
@@ -25,6 +29,11 @@ struct TextureStruct {
     std::string type, path;
 };
 
+// Mesh Buffers - Vertex, Element/Index and Position Only Buffer Objects (Unlike Vertex Array Objects, Buffers Are Shared Between Contexts)
+struct MeshBuffersStruct {
+    GLuint VBO{0}, EBO{0}, positionVBO{0};
+};
+
 // Mesh Class
 class Mesh {
     public:
@@ -34,30 +43,81 @@ class Mesh {
         std::vector<TextureStruct> textures;
 
         // Constructor - Create A New Mesh
-        Mesh(std::vector<VertexStruct> vertices, std::vector<unsigned int> indices, std::vector<TextureStruct> textures) {
+        Mesh(std::vector<VertexStruct> vertices, std::vector<unsigned int> indices, std::vector<TextureStruct> textures) : Mesh(vertices, indices, textures, createBuffers(vertices, indices)) {}
+
+        // Constructor - Create A New Mesh From Buffers Already Filled by createBuffers() (Possibly on Another Context Sharing Objects With This One)
+        Mesh(std::vector<VertexStruct> vertices, std::vector<unsigned int> indices, std::vector<TextureStruct> textures, const MeshBuffersStruct &buffers) {
             // Initialize Mesh
             this->vertices = vertices;
             this->indices = indices;
             this->textures = textures;
+            this->VBO = buffers.VBO;
+            this->EBO = buffers.EBO;
+            this->positionVBO = buffers.positionVBO;
+
+            // Figure Out Which Shader Keywords The Mesh's Material Needs
+            for(const TextureStruct &texture : this->textures) {
+                if(texture.type == "texture_specular") this->shaderKeywords |= SHADER_KEYWORD_HAS_SPECULAR_MAP;
+            }
+
+            // Calculate Mesh Bounding Box
+            if(!this->vertices.empty()) {
+                this->boundingBox = BoundingBox{this->vertices[0].vertexPos, this->vertices[0].vertexPos};
+                for(const VertexStruct &vertex : this->vertices) {
+                    this->boundingBox.min = glm::min(this->boundingBox.min, vertex.vertexPos);
+                    this->boundingBox.max = glm::max(this->boundingBox.max, vertex.vertexPos);
+                }
+            }
 
             // Setup Mesh
             this->setupMesh();
         }
 
+        // Create and Fill A Mesh's Buffers (Only Touches Buffer Objects so Any Context Sharing Objects With The Render Context Can Do it)
+        static MeshBuffersStruct createBuffers(const std::vector<VertexStruct> &vertices, const std::vector<unsigned int> &indices);
+
         // Render Mesh
         void render(Shader &shader);
 
+        // Render Mesh Geometry Only From The Position Only Stream (Depth Passes Don't Need Normals or Material Textures)
+        void renderDepth(void) {
+            glBindVertexArray(this->depthVAO);
+            glDrawElements(GL_TRIANGLES, this->indices.size(), GL_UNSIGNED_INT, 0);
+            DrawStats::recordDraw(this->indices.size() / 3);
+            glBindVertexArray(0);
+        }
+
+        // Getters
+        unsigned int getShaderKeywords(void) {return this->shaderKeywords;}
+        const BoundingBox &getBoundingBox(void) {return this->boundingBox;}
+
         // Destroy Mesh
         void destroy(void) {
             // Delete Vertex Array, Vertex Buffer and Element/Index Buffer Object
             glDeleteVertexArrays(1, &this->VAO);
+            GPUMemoryTracker::untrack(GL_BUFFER, this->VBO);
+            GPUMemoryTracker::untrack(GL_BUFFER, this->EBO);
+            GPUMemoryTracker::untrack(GL_BUFFER, this->positionVBO);
             glDeleteBuffers(1, &this->VBO);
             glDeleteBuffers(1, &this->EBO);
+
+            // Delete Position Only Stream
+            glDeleteVertexArrays(1, &this->depthVAO);
+            glDeleteBuffers(1, &this->positionVBO);
         }
     private:
         // Render Data - Vertex Array Object, Vertex Buffer Object and Element/Index Buffer Object
         GLuint VAO, VBO, EBO;
 
-        // Setup Mesh
+        // Position Only Stream For Depth Passes - Vertex Array Object and Vertex Buffer Object (Shares The Element/Index Buffer Object)
+        GLuint depthVAO, positionVBO;
+
+        // Shader Keywords Required by The Mesh's Material (e.g. Specular Map)
+        unsigned int shaderKeywords{SHADER_KEYWORD_NONE};
+
+        // Object Space Bounding Box
+        BoundingBox boundingBox;
+
+        // Setup Mesh - Create The Vertex Array Objects Reading Its Buffers
         void setupMesh();
 };
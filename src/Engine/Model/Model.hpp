@@ -3,6 +3,7 @@
 // Standard Headers
 #include<iostream>
 #include<vector>
+#include<functional>
 
 // Assimp (Open Asset Importer)
 #include<assimp/Importer.hpp>
@@ -15,17 +16,53 @@
 // Custom Engine Headers
 #include"Mesh.hpp"
 #include"../Shader/Shader.hpp"
+#include"../Shader/ShaderVariants.hpp"
 #include"../Texture/Texture.hpp"
 
+// Imported Material Texture (Decoded While Importing, Uploaded Later)
+struct ModelTextureDataStruct {
+    std::string type, path;
+    TextureImageStruct image;
+};
+
+// Imported Mesh (Converted While Importing, Uploaded Later) - Its Textures Are Indices Into ModelDataStruct::textures
+struct ModelMeshDataStruct {
+    std::vector<VertexStruct> vertices;
+    std::vector<unsigned int> indices;
+    std::vector<unsigned int> textureIndices;
+};
+
+// Imported Model - Everything Needed to Create A Model Without Touching The Model File Again
+struct ModelDataStruct {
+    std::vector<ModelMeshDataStruct> meshes;
+    std::vector<ModelTextureDataStruct> textures;
+    BoundingBox boundingBox;
+};
+
 // Model Class
 class Model {
     public:
+        // Constructor - Empty Model, Filled in With addTexture() and addMesh() (Streaming Builds Models A Piece at A Time)
+        Model(void) {}
+
         // Constructor - Load 3D Model File
         Model(const std::string modelFilePath, const unsigned int processFlags) {
             // Load Model File
             loadModel(modelFilePath, processFlags);
         }
 
+        // Import A Model File Into Memory - No OpenGL Calls so it Can Run on Any Thread (Free The Decoded Images With freeModelData())
+        // Baked Models (.bmodel) Are Read Directly and Ignore processFlags, The Baker Already Applied Its Own
+        static bool importModel(const std::string &modelFilePath, const unsigned int &processFlags, ModelDataStruct &modelData);
+        static void freeModelData(ModelDataStruct &modelData);
+
+        // Add An Uploaded Material Texture (Textures Must Be Added in The Order They Were Imported, Before The Meshes Using Them)
+        void addTexture(const GLuint &textureObject, const ModelTextureDataStruct &texture);
+
+        // Upload An Imported Mesh, or Add One Whose Buffers Were Already Filled (e.g. by The Upload Thread)
+        void addMesh(const ModelMeshDataStruct &mesh);
+        void addMesh(const ModelMeshDataStruct &mesh, const MeshBuffersStruct &buffers);
+
         // Render Model
         void render(Shader &shader) {
             // Render All The Meshes of The Model
@@ -33,29 +70,73 @@ class Model {
                 meshes[i].render(shader);
             }
         }
-    
+
+        // Render Model Using The Cheapest Shader Variant Each Mesh's Material Allows
+        // Uniforms Are Set Through setUniforms(shader) Whenever A Different Shader Variant Gets Used (A Template so Capturing Lambdas Aren't Copied Into A Heap Allocated std::function Every Draw)
+        template<typename SetUniforms>
+        void render(ShaderVariants &shaderVariants, const unsigned int &keywords, const SetUniforms &setUniforms) {
+            Shader* currentShader = nullptr;
+            for(unsigned int i = 0; i < meshes.size(); i++) {
+                Shader &shader = shaderVariants.get(keywords | meshes[i].getShaderKeywords());
+                if(&shader != currentShader) {
+                    shader.use();
+                    setUniforms(shader);
+                    currentShader = &shader;
+                }
+                meshes[i].render(shader);
+            }
+        }
+
+        // Render Model Geometry Only (Depth Passes)
+        void renderDepth(void) {
+            for(unsigned int i = 0; i < meshes.size(); i++) {
+                meshes[i].renderDepth();
+            }
+        }
+
+        // Get Object Space Bounding Box of All The Meshes
+        BoundingBox getBoundingBox(void) {
+            if(this->meshes.empty()) return BoundingBox{};
+            BoundingBox boundingBox{this->meshes[0].getBoundingBox()};
+            for(unsigned int i = 1; i < this->meshes.size(); i++) {
+                boundingBox.min = glm::min(boundingBox.min, this->meshes[i].getBoundingBox().min);
+                boundingBox.max = glm::max(boundingBox.max, this->meshes[i].getBoundingBox().max);
+            }
+            return boundingBox;
+        }
+
+        // Convert An Imported Mesh's Vertices and Indices (The CPU Side of processMesh, Public so it Can Be Benchmarked Without GL)
+        static void convertMesh(const aiMesh* mesh, std::vector<VertexStruct> &vertices, std::vector<unsigned int> &indices);
+
         // Destroy Model
         void destroy(void) {
             // Loop Through All The Meshes and Destroy Them One by One
             for(unsigned int i = 0; i < this->meshes.size(); i++) {
                 this->meshes[i].destroy();
             }
+
+            // Delete Material Textures (Shared Between Meshes so Meshes Don't Delete Them)
+            for(const TextureStruct &texture : this->loadedTextures) {
+                GPUMemoryTracker::untrack(GL_TEXTURE, texture.id);
+                glDeleteTextures(1, &texture.id);
+            }
+            this->loadedTextures.clear();
+            this->meshes.clear();
         }
     private:
         // Model Data
         std::vector<Mesh> meshes;
         std::vector<TextureStruct> loadedTextures;
-        std::string directory;
 
-        // Load Model File
+        // Load Model File (Import Then Upload Everything at Once)
         void loadModel(const std::string modelFilePath, const unsigned int processFlags);
 
-        // Process All The Nodes in A Model
-        void processNode(const aiNode* node, const aiScene* scene);
+        // Gather All The Meshes in A Model's Nodes
+        static void processNode(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*> &nodeMeshes);
 
-        // Process All The Meshes in A Model
-        Mesh processMesh(const aiMesh* mesh, const aiScene* scene);
+        // Decode Every Gathered Texture of A Model
+        static void loadTextureImages(const std::string &modelFilePath, ModelDataStruct &modelData);
 
-        // Load Model Material Textures
-        std::vector<TextureStruct> loadMaterialTextures(aiMaterial* material, aiTextureType textureType, std::string textureTypeName);
+        // Gather A Material's Textures of One Type (Each Texture File is Only Imported Once)
+        static void loadMaterialTextures(aiMaterial* material, aiTextureType textureType, std::string textureTypeName, ModelDataStruct &modelData, std::vector<unsigned int> &textureIndices);
 };
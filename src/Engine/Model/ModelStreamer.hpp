@@ -0,0 +1,102 @@
+#pragma once
+
+// Standard Headers
+#include<mutex>
+#include<atomic>
+#include<memory>
+#include<string>
+#include<vector>
+#include<cstddef>
+
+// Custom Engine Headers
+#include"Model.hpp"
+#include"../Jobs/JobSystem.hpp"
+#include"../Renderer/UploadThread.hpp"
+
+// Streamed Model States
+enum ModelStreamState {
+    MODEL_STREAM_IMPORTING,
+    MODEL_STREAM_UPLOADING,
+    MODEL_STREAM_READY,
+    MODEL_STREAM_FAILED
+};
+
+// Streamed Model Handle
+typedef unsigned int ModelHandle;
+
+// Model Streamer Statistics
+struct ModelStreamerStatsStruct {
+    unsigned int importingModelCount{0}, uploadingModelCount{0}, readyModelCount{0}, failedModelCount{0};
+    std::size_t lastFrameUploadBytes{0}, totalUploadBytes{0};
+    float lastFrameUploadMs{0.0f}, maxFrameUploadMs{0.0f};
+};
+
+// Model Streamer Class - Loads Models Without Stalling Frames
+// load() Returns A Handle Immediately and Imports The Model File (Assimp, Mesh Conversion and Texture Decoding) as A Background Job on The Job System's Idle Workers
+// update() Runs on The Thread Owning The OpenGL Context and Hands Imported Models to The Upload Thread, Which Fills Their Buffers and Textures on Its Shared Context
+// Without An Upload Thread (Or Without Its Shared Context) update() Uploads Within A Per Frame Budget Instead - Textures A Few Rows at A Time, Meshes Whole
+// getModel() Returns nullptr Until A Model is Fully Uploaded so The Scene Draws A Placeholder Until Then
+class ModelStreamer {
+    public:
+        // Constructor - Upload on uploadThread, or Without One Upload At Most uploadBudgetBytes or uploadBudgetMs Per Frame (At Least One Piece Always Goes Up so Uploads Never Stall)
+        ModelStreamer(const std::size_t &uploadBudgetBytes, const float &uploadBudgetMs, UploadThread *uploadThread = nullptr) : uploadBudgetBytes(uploadBudgetBytes), uploadBudgetMs(uploadBudgetMs), uploadThread(uploadThread) {}
+
+        // Start Streaming A Model File
+        ModelHandle load(const std::string &modelFilePath, const unsigned int &processFlags);
+
+        // Upload Imported Models Within The Frame's Budget (OpenGL Context Thread Only)
+        void update(void);
+
+        // Wait For Every Import Then Upload Everything Left at Once (Benchmarks and Loading Screens, OpenGL Context Thread Only)
+        void flush(void);
+
+        // Getters (Safe From Any Thread - A Ready Model Never Changes Again)
+        ModelStreamState getState(const ModelHandle &handle);
+        Model *getModel(const ModelHandle &handle);
+        bool getBoundingBox(const ModelHandle &handle, BoundingBox &boundingBox);
+        ModelStreamerStatsStruct getStats(void);
+        std::string getStatsReport(void);
+
+        // Destroy (Waits For Imports Still Running, OpenGL Context Thread Only - Destroy The Upload Thread First so Its Uploads Complete)
+        void destroy(void);
+    private:
+        // Streamed Model - The Importing Job Fills in modelData Then Hands it to update() by Setting The State to Uploading
+        struct StreamedModelStruct {
+            std::string filePath;
+            std::atomic<ModelStreamState> state{MODEL_STREAM_IMPORTING};
+            ModelDataStruct modelData;
+            Model model;
+
+            // Upload Progress - Next Texture (and Row of it) Then Next Mesh
+            unsigned int textureIndex{0}, textureRow{0}, meshIndex{0};
+            Texture texture;
+
+            // Objects Created by The Upload Thread (Added to The Model Once Their Fence Signals)
+            bool uploadSubmitted{false};
+            std::vector<GLuint> textureObjects;
+            std::vector<MeshBuffersStruct> meshBuffers;
+        };
+        std::mutex modelsMutex;
+        std::vector<std::unique_ptr<StreamedModelStruct>> models;
+        JobCounterStruct importCounter;
+
+        // Per Frame Upload Budget
+        std::size_t uploadBudgetBytes;
+        float uploadBudgetMs;
+
+        // Upload Thread (nullptr = Budgeted Uploads Only)
+        UploadThread *uploadThread;
+
+        // Statistics
+        std::size_t lastFrameUploadBytes{0}, totalUploadBytes{0};
+        float lastFrameUploadMs{0.0f}, maxFrameUploadMs{0.0f};
+
+        // Upload Imported Models Until budgetBytes or budgetMs is Used Up
+        void upload(const std::size_t &budgetBytes, const float &budgetMs);
+
+        // Hand Every Newly Imported Model to The Upload Thread
+        void submitUploads(void);
+
+        // Find A Handle's Model (nullptr For Invalid Handles)
+        StreamedModelStruct *find(const ModelHandle &handle);
+};
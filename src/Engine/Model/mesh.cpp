@@ -1,20 +1,44 @@
 #include"Mesh.hpp"
 
+// Custom Engine Headers
+#include"../Memory/FrameArena.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
+
+// Create and Fill A Mesh's Buffers
+MeshBuffersStruct Mesh::createBuffers(const std::vector<VertexStruct> &vertices, const std::vector<unsigned int> &indices) {
+    MeshBuffersStruct buffers;
+
+    // Vertex Buffer Object
+    glCreateBuffers(1, &buffers.VBO);
+    glNamedBufferData(buffers.VBO, vertices.size() * sizeof(VertexStruct), vertices.data(), GL_STATIC_DRAW);
+
+    // Element/Index Buffer Object
+    glCreateBuffers(1, &buffers.EBO);
+    glNamedBufferData(buffers.EBO, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+    // Position Only Stream For Depth Passes (Tightly Packed so Depth Only Draws Fetch Less Vertex Data)
+    std::vector<glm::vec3> vertexPositions;
+    vertexPositions.reserve(vertices.size());
+    for(const VertexStruct &vertex : vertices) {
+        vertexPositions.push_back(vertex.vertexPos);
+    }
+    glCreateBuffers(1, &buffers.positionVBO);
+    glNamedBufferData(buffers.positionVBO, vertexPositions.size() * sizeof(glm::vec3), vertexPositions.data(), GL_STATIC_DRAW);
+
+    // Track Buffer Memory
+    GPUMemoryTracker::trackBuffer(buffers.VBO, vertices.size() * sizeof(VertexStruct), "Mesh Vertices");
+    GPUMemoryTracker::trackBuffer(buffers.EBO, indices.size() * sizeof(unsigned int), "Mesh Indices");
+    GPUMemoryTracker::trackBuffer(buffers.positionVBO, vertexPositions.size() * sizeof(glm::vec3), "Mesh Depth Positions");
+    return buffers;
+}
+
 // Setup Mesh
 void Mesh::setupMesh() {
     // Vertex Array Object
     glGenVertexArrays(1, &this->VAO);
     glBindVertexArray(this->VAO);
-
-    // Vertex Buffer Object
-    glGenBuffers(1, &this->VBO);
     glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-    glBufferData(GL_ARRAY_BUFFER, this->vertices.size() * sizeof(VertexStruct), &this->vertices[0], GL_STATIC_DRAW);
-
-    // Element/Index Buffer Object
-    glGenBuffers(1, &this->EBO);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->indices.size() * sizeof(unsigned int), &this->indices[0], GL_STATIC_DRAW);
 
     // Vertex Attributes
     // Vertex Positions
@@ -29,6 +53,14 @@ void Mesh::setupMesh() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)offsetof(VertexStruct, texCords));
     glEnableVertexAttribArray(2);
 
+    // Position Only Stream For Depth Passes (Shares The Element/Index Buffer Object)
+    glGenVertexArrays(1, &this->depthVAO);
+    glBindVertexArray(this->depthVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, this->positionVBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+    glEnableVertexAttribArray(0);
+
     // Unbind Vertex Array Object
     glBindVertexArray(0);
 }
@@ -38,17 +70,18 @@ void Mesh::render(Shader &shader) {
     // Iterate Through All The Textures And Seperate Diffusion and Specular Textures
     unsigned int diffuseNr{1}, specularNr{1};
     for(unsigned int i = 0; i < this->textures.size(); i++) {
-        // Count The Number of Diffusion and Specular Textures
-        std::string number, name{this->textures[i].type};
+        // Count The Number of Diffusion and Specular Textures (Other Texture Types Aren't Numbered)
+        const std::string &name = this->textures[i].type;
+        unsigned int number{0};
         if(name == "texture_diffuse") {
-            number = std::to_string(diffuseNr++);
-        } if(name == "texture_specular") {
-            number = std::to_string(specularNr++);
+            number = diffuseNr++;
+        } else if(name == "texture_specular") {
+            number = specularNr++;
         }
 
-        // Set Material Textures
+        // Set Material Textures (Uniform Names Are Formatted Into The Frame Arena)
         glActiveTexture(GL_TEXTURE0 + i);
-        shader.setInt(("material." + name + number).c_str(), i);
+        shader.setInt(number == 0 ? FrameArena::format("material.%s", name.c_str()) : FrameArena::format("material.%s%u", name.c_str(), number), i);
         glBindTexture(GL_TEXTURE_2D, this->textures[i].id);
     }
     glActiveTexture(GL_TEXTURE0);
@@ -56,5 +89,6 @@ void Mesh::render(Shader &shader) {
     // Render Mesh
     glBindVertexArray(this->VAO);
     glDrawElements(GL_TRIANGLES, this->indices.size(), GL_UNSIGNED_INT, 0);
+    DrawStats::recordDraw(this->indices.size() / 3);
     glBindVertexArray(0);
 }
@@ -1,47 +1,155 @@
 #include"Model.hpp"
 
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+#include"../Jobs/JobSystem.hpp"
+#include"../Assets/BakedAssets.hpp"
+#include"../Assets/AssimpFileSystem.hpp"
+
  // Load Model File
 void Model::loadModel(const std::string modelFilePath, const unsigned int processFlags) {
-    // Model Importer
+    CPU_PROFILE_SCOPE("Model::loadModel");
+
+    // Import The Model File
+    ModelDataStruct modelData;
+    if(!importModel(modelFilePath, processFlags, modelData)) return;
+
+    // Upload Its Textures Then Its Meshes
+    for(const ModelTextureDataStruct &texture : modelData.textures) {
+        Texture textureImage;
+        if(texture.image.pixels) textureImage.create2DTexture(texture.image, "Model Textures");
+        this->addTexture(textureImage.getTextureObject(), texture);
+    }
+    for(const ModelMeshDataStruct &mesh : modelData.meshes) this->addMesh(mesh);
+
+    // Free The Decoded Images
+    freeModelData(modelData);
+}
+
+// Import A Model File Into Memory
+bool Model::importModel(const std::string &modelFilePath, const unsigned int &processFlags, ModelDataStruct &modelData) {
+    CPU_PROFILE_SCOPE("Model::importModel");
+
+    // Baked Models Are Already Converted, Only Their Textures Are Left to Load
+    if(BakedAssets::isBakedModel(modelFilePath)) {
+        if(!BakedAssets::readModel(modelFilePath, modelData)) {
+            std::cerr << "Failed to Load Baked Model File! Rebake The Assets and Try Again.\n\n";
+            return false;
+        }
+        loadTextureImages(modelFilePath, modelData);
+        return true;
+    }
+
+    // Model Importer (Reading The Model and The Files it References Through The Virtual File System)
     Assimp::Importer importer;
-    const aiScene* scene = importer.ReadFile(modelFilePath, processFlags);
+    importer.SetIOHandler(new AssimpFileSystem());
+    const aiScene* scene{nullptr};
+    {
+        CPU_PROFILE_SCOPE("Assimp Import");
+        scene = importer.ReadFile(modelFilePath, processFlags);
+    }
 
     // Check if Model Was Successfully Imported From Model File or Not
     if(!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
         // Display Error Message
         std::cerr << "Failed to Load Model File!\n";
         std::cerr << "Error Desc: " << importer.GetErrorString() << "\n\n";
-        return;
+        return false;
     }
 
-    // Figure Out The Full Directory of Where The Model File is Located
-    this->directory = modelFilePath.substr(0, modelFilePath.find_last_of('/'));
+    // Gather All The Meshes in The Model's Nodes
+    std::vector<const aiMesh*> nodeMeshes;
+    processNode(scene->mRootNode, scene, nodeMeshes);
+
+    // Convert Every Mesh's Vertices and Indices in Parallel
+    modelData.meshes.resize(nodeMeshes.size());
+    JobSystem::parallelFor(nodeMeshes.size(), 1, [&](const std::size_t firstMesh, const std::size_t lastMesh) {
+        for(std::size_t i = firstMesh; i < lastMesh; i++) convertMesh(nodeMeshes[i], modelData.meshes[i].vertices, modelData.meshes[i].indices);
+    }, "Model::convertMesh");
+
+    // Gather Every Mesh's Material Textures
+    for(unsigned int i = 0; i < nodeMeshes.size(); i++) {
+        if(nodeMeshes[i]->mMaterialIndex > 0) {
+            aiMaterial* material = scene->mMaterials[nodeMeshes[i]->mMaterialIndex];
+            loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffuse", modelData, modelData.meshes[i].textureIndices);
+            loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular", modelData, modelData.meshes[i].textureIndices);
+        }
+    }
 
-    // Process All The Nodes in The Model
-    this->processNode(scene->mRootNode, scene);
+    // Decode Every Texture
+    loadTextureImages(modelFilePath, modelData);
+
+    // Calculate The Bounding Box of All The Meshes (Known Before Anything is Uploaded)
+    bool firstVertex{true};
+    for(const ModelMeshDataStruct &mesh : modelData.meshes) {
+        for(const VertexStruct &vertex : mesh.vertices) {
+            if(firstVertex) modelData.boundingBox = BoundingBox{vertex.vertexPos, vertex.vertexPos};
+            modelData.boundingBox.min = glm::min(modelData.boundingBox.min, vertex.vertexPos);
+            modelData.boundingBox.max = glm::max(modelData.boundingBox.max, vertex.vertexPos);
+            firstVertex = false;
+        }
+    }
+    return true;
 }
 
-// Process All The Nodes in A Model
-void Model::processNode(const aiNode* node, const aiScene* scene) {
-    // Process All The Node's Meshes (If Any)
+// Load Every Texture of An Imported Model in Parallel (Paths Are Relative to The Model File's Directory)
+void Model::loadTextureImages(const std::string &modelFilePath, ModelDataStruct &modelData) {
+    const std::string directory{modelFilePath.substr(0, modelFilePath.find_last_of('/'))};
+    JobSystem::parallelFor(modelData.textures.size(), 1, [&](const std::size_t firstTexture, const std::size_t lastTexture) {
+        for(std::size_t i = firstTexture; i < lastTexture; i++) {
+            if(!Texture::loadImage(directory + '/' + modelData.textures[i].path, true, modelData.textures[i].image)) {
+                std::cerr << "Failed to Load Texture Image File! Check File Path and Try Again.\n";
+            }
+        }
+    }, "Model Texture Decode");
+}
+
+// Free An Imported Model's Decoded Images and Mesh Data
+void Model::freeModelData(ModelDataStruct &modelData) {
+    for(ModelTextureDataStruct &texture : modelData.textures) Texture::freeImage(texture.image);
+    modelData.textures.clear();
+    modelData.meshes.clear();
+}
+
+// Add An Uploaded Material Texture
+void Model::addTexture(const GLuint &textureObject, const ModelTextureDataStruct &texture) {
+    if(textureObject != 0) {
+        glTextureParameteri(textureObject, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(textureObject, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(textureObject, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(textureObject, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    }
+    this->loadedTextures.push_back(TextureStruct{textureObject, texture.type, texture.path});
+}
+
+// Upload An Imported Mesh
+void Model::addMesh(const ModelMeshDataStruct &mesh) {
+    this->addMesh(mesh, Mesh::createBuffers(mesh.vertices, mesh.indices));
+}
+
+// Add An Imported Mesh Whose Buffers Are Already Filled
+void Model::addMesh(const ModelMeshDataStruct &mesh, const MeshBuffersStruct &buffers) {
+    CPU_PROFILE_SCOPE("Model::addMesh");
+    std::vector<TextureStruct> textures;
+    for(const unsigned int &textureIndex : mesh.textureIndices) textures.push_back(this->loadedTextures[textureIndex]);
+    this->meshes.push_back(Mesh(mesh.vertices, mesh.indices, textures, buffers));
+}
+
+// Gather All The Meshes in A Model's Nodes
+void Model::processNode(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*> &nodeMeshes) {
+    // Gather All The Node's Meshes (If Any)
     for(unsigned int i = 0; i < node->mNumMeshes; i++) {
-        aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        this->meshes.push_back(processMesh(mesh, scene));
+        nodeMeshes.push_back(scene->mMeshes[node->mMeshes[i]]);
     }
 
     // Process All The Children Nodes (If Any)
     for(unsigned int i = 0; i < node->mNumChildren; i++) {
-        this->processNode(node->mChildren[i], scene);
+        processNode(node->mChildren[i], scene, nodeMeshes);
     }
 }
 
-// Process All The Meshes in A Model
-Mesh Model::processMesh(const aiMesh* mesh, const aiScene* scene) {
-    // Mesh Data
-    std::vector<VertexStruct> vertices;
-    std::vector<unsigned int> indices;
-    std::vector<TextureStruct> textures;
-
+// Convert An Imported Mesh's Vertices and Indices
+void Model::convertMesh(const aiMesh* mesh, std::vector<VertexStruct> &vertices, std::vector<unsigned int> &indices) {
     // Process All The Vertices
     for(unsigned int i = 0; i < mesh->mNumVertices; i++) {
         VertexStruct vertex;
@@ -81,51 +189,25 @@ Mesh Model::processMesh(const aiMesh* mesh, const aiScene* scene) {
             indices.push_back(face.mIndices[j]);
         }
     }
-
-    // Process All Materials
-    if(mesh->mMaterialIndex > 0) {
-        aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
-        std::vector<TextureStruct> diffuseMaps = this->loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffuse");
-        textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
-        std::vector<TextureStruct> specularMaps = this->loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular");
-        textures.insert(textures.end(), specularMaps.begin(), specularMaps.end());
-    }
-
-    // Return Mesh
-    return Mesh(vertices, indices, textures);
 }
 
-// Load Material Textures
-std::vector<TextureStruct> Model::loadMaterialTextures(aiMaterial *material, aiTextureType textureType, std::string textureTypeName) {
-    std::vector<TextureStruct> textures;
+// Gather A Material's Textures of One Type
+void Model::loadMaterialTextures(aiMaterial *material, aiTextureType textureType, std::string textureTypeName, ModelDataStruct &modelData, std::vector<unsigned int> &textureIndices) {
     for(unsigned int i = 0; i < material->GetTextureCount(textureType); i++) {
         aiString str;
         material->GetTexture(textureType, i, &str);
         bool skip = false;
-        for(unsigned int j = 0; j < this->loadedTextures.size(); j++) {
-            if(std::strcmp(this->loadedTextures[j].path.data(), str.C_Str()) == 0) {
-                textures.push_back(this->loadedTextures[j]);
-                skip = true; 
+        for(unsigned int j = 0; j < modelData.textures.size(); j++) {
+            if(std::strcmp(modelData.textures[j].path.data(), str.C_Str()) == 0) {
+                textureIndices.push_back(j);
+                skip = true;
                 break;
             }
         }
         if(!skip) {
-            // If texture Hasn't Been Loaded Already, Load it
-            TextureStruct texture;
-            Texture textureImage;
-            textureImage.create2DTexture(this->directory + '/' + str.C_Str());
-            textureImage.bind2DTexture();
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-            texture.id = textureImage.getTextureObject();
-            texture.type = textureTypeName;
-            texture.path = str.C_Str();
-            textures.push_back(texture);
-            this->loadedTextures.push_back(texture); // add to loaded textures
+            // If Texture Hasn't Been Gathered Already, Gather it (Decoded Once Every Texture is Known)
+            textureIndices.push_back(modelData.textures.size());
+            modelData.textures.push_back(ModelTextureDataStruct{textureTypeName, str.C_Str(), TextureImageStruct{}});
         }
     }
-
-    return textures;
 }
@@ -0,0 +1,241 @@
+#include"ModelStreamer.hpp"
+
+// Standard Headers
+#include<chrono>
+#include<limits>
+#include<sstream>
+#include<iomanip>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+
+// Start Streaming A Model File
+ModelHandle ModelStreamer::load(const std::string &modelFilePath, const unsigned int &processFlags) {
+    // Register The Model (Handles Start at 1 so 0 is Never Valid)
+    StreamedModelStruct *streamedModel{nullptr};
+    ModelHandle handle{0};
+    {
+        std::lock_guard<std::mutex> lock(this->modelsMutex);
+        this->models.push_back(std::make_unique<StreamedModelStruct>());
+        streamedModel = this->models.back().get();
+        streamedModel->filePath = modelFilePath;
+        handle = this->models.size();
+    }
+
+    // Import it as A Background Job so it Never Runs Inside A Frame's Wait or Takes Every Worker (Nothing Else Touches The Model Until The State Changes)
+    const unsigned int flags{processFlags};
+    JobSystem::runBackground([streamedModel, flags](void) {
+        const bool imported{Model::importModel(streamedModel->filePath, flags, streamedModel->modelData)};
+        if(!imported) std::cerr << "Failed to Stream Model: " << streamedModel->filePath << "\n";
+        streamedModel->state.store(imported ? MODEL_STREAM_UPLOADING : MODEL_STREAM_FAILED, std::memory_order_release);
+    }, &this->importCounter, "Model Import");
+    return handle;
+}
+
+// Upload Imported Models Within The Frame's Budget
+void ModelStreamer::update(void) {
+    CPU_PROFILE_SCOPE("ModelStreamer::update");
+    if(this->uploadThread != nullptr && this->uploadThread->hasContext()) this->submitUploads();
+    else this->upload(this->uploadBudgetBytes, this->uploadBudgetMs);
+}
+
+// Wait For Every Import Then Upload Everything Left at Once
+void ModelStreamer::flush(void) {
+    CPU_PROFILE_SCOPE("ModelStreamer::flush");
+    JobSystem::wait(this->importCounter);
+    if(this->uploadThread != nullptr && this->uploadThread->hasContext()) {
+        this->submitUploads();
+        this->uploadThread->finish();
+    } else {
+        this->upload(std::numeric_limits<std::size_t>::max(), std::numeric_limits<float>::infinity());
+    }
+}
+
+// Hand Every Newly Imported Model to The Upload Thread
+void ModelStreamer::submitUploads(void) {
+    // Models Imported Since The Last Call
+    std::vector<StreamedModelStruct*> importedModels;
+    {
+        std::lock_guard<std::mutex> lock(this->modelsMutex);
+        for(const std::unique_ptr<StreamedModelStruct> &streamedModel : this->models) {
+            if(!streamedModel->uploadSubmitted && streamedModel->state.load(std::memory_order_acquire) == MODEL_STREAM_UPLOADING) importedModels.push_back(streamedModel.get());
+        }
+    }
+
+    // Fill Every Texture and Mesh Buffer on The Upload Thread, Then Build The Model (Its Vertex Array Objects Belong to This Context) Once The GPU Has Them
+    std::size_t submittedBytes{0};
+    for(StreamedModelStruct *streamedModel : importedModels) {
+        streamedModel->uploadSubmitted = true;
+        for(const ModelTextureDataStruct &texture : streamedModel->modelData.textures) submittedBytes += (std::size_t)texture.image.width * texture.image.height * texture.image.channelCount;
+        for(const ModelMeshDataStruct &mesh : streamedModel->modelData.meshes) submittedBytes += mesh.vertices.size() * (sizeof(VertexStruct) + sizeof(glm::vec3)) + mesh.indices.size() * sizeof(unsigned int);
+        this->uploadThread->submit([streamedModel](void) {
+            for(ModelTextureDataStruct &texture : streamedModel->modelData.textures) {
+                Texture textureImage;
+                if(texture.image.pixels) textureImage.create2DTexture(texture.image, "Model Textures");
+                streamedModel->textureObjects.push_back(textureImage.getTextureObject());
+                Texture::freeImage(texture.image);
+            }
+            for(const ModelMeshDataStruct &mesh : streamedModel->modelData.meshes) streamedModel->meshBuffers.push_back(Mesh::createBuffers(mesh.vertices, mesh.indices));
+        }, [streamedModel](void) {
+            CPU_PROFILE_SCOPE("Model Upload Complete");
+            ModelDataStruct &modelData = streamedModel->modelData;
+            for(unsigned int i = 0; i < modelData.textures.size(); i++) streamedModel->model.addTexture(streamedModel->textureObjects[i], modelData.textures[i]);
+            for(unsigned int i = 0; i < modelData.meshes.size(); i++) streamedModel->model.addMesh(modelData.meshes[i], streamedModel->meshBuffers[i]);
+            Model::freeModelData(modelData);
+            streamedModel->state.store(MODEL_STREAM_READY, std::memory_order_release);
+        }, "Model Upload");
+    }
+
+    // Statistics (Counted When Submitted)
+    this->lastFrameUploadBytes = submittedBytes;
+    this->totalUploadBytes += submittedBytes;
+    this->lastFrameUploadMs = 0.0f;
+}
+
+// Upload Imported Models Until budgetBytes or budgetMs is Used Up
+void ModelStreamer::upload(const std::size_t &budgetBytes, const float &budgetMs) {
+    const std::chrono::steady_clock::time_point startTime{std::chrono::steady_clock::now()};
+    const auto getElapsedMs = [&](void) -> float {return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();};
+
+    // Models Waiting to Be Uploaded
+    std::vector<StreamedModelStruct*> uploadingModels;
+    {
+        std::lock_guard<std::mutex> lock(this->modelsMutex);
+        for(const std::unique_ptr<StreamedModelStruct> &streamedModel : this->models) {
+            if(streamedModel->state.load(std::memory_order_acquire) == MODEL_STREAM_UPLOADING) uploadingModels.push_back(streamedModel.get());
+        }
+    }
+
+    // Upload One Piece at A Time Until The Budget Runs Out (The First Piece Always Goes Up)
+    std::size_t uploadedBytes{0};
+    for(StreamedModelStruct *streamedModel : uploadingModels) {
+        if(streamedModel->uploadSubmitted) continue;
+        ModelDataStruct &modelData = streamedModel->modelData;
+        while(uploadedBytes == 0 || (uploadedBytes < budgetBytes && getElapsedMs() < budgetMs)) {
+            if(streamedModel->textureIndex < modelData.textures.size()) {
+                // Upload As Many Rows of The Next Texture as The Budget Has Room For (Textures That Failed to Decode Are Added Empty)
+                ModelTextureDataStruct &texture = modelData.textures[streamedModel->textureIndex];
+                if(texture.image.pixels) {
+                    if(streamedModel->textureRow == 0) streamedModel->texture.allocate2DTexture(texture.image, "Model Textures");
+                    const std::size_t rowSize{(std::size_t)texture.image.width * texture.image.channelCount};
+                    const std::size_t remainingBytes{budgetBytes > uploadedBytes ? budgetBytes - uploadedBytes : 0};
+                    const unsigned int rowCount{(unsigned int)std::clamp<std::size_t>(remainingBytes / std::max<std::size_t>(rowSize, 1), 1, texture.image.height - streamedModel->textureRow)};
+                    streamedModel->texture.upload2DTextureRows(texture.image, streamedModel->textureRow, rowCount);
+                    streamedModel->textureRow += rowCount;
+                    uploadedBytes += rowCount * rowSize;
+                    if(streamedModel->textureRow < (unsigned int)texture.image.height) continue;
+                }
+
+                // Texture Finished
+                streamedModel->model.addTexture(streamedModel->texture.getTextureObject(), texture);
+                Texture::freeImage(texture.image);
+                streamedModel->texture = Texture();
+                streamedModel->textureIndex++;
+                streamedModel->textureRow = 0;
+            } else if(streamedModel->meshIndex < modelData.meshes.size()) {
+                // Upload The Next Mesh Then Free its Vertices and Indices
+                ModelMeshDataStruct &mesh = modelData.meshes[streamedModel->meshIndex++];
+                streamedModel->model.addMesh(mesh);
+                uploadedBytes += mesh.vertices.size() * (sizeof(VertexStruct) + sizeof(glm::vec3)) + mesh.indices.size() * sizeof(unsigned int);
+                mesh = ModelMeshDataStruct();
+            } else {
+                // Everything is Uploaded - Hand The Model Out
+                Model::freeModelData(modelData);
+                streamedModel->state.store(MODEL_STREAM_READY, std::memory_order_release);
+                break;
+            }
+        }
+    }
+
+    // Statistics
+    this->lastFrameUploadBytes = uploadedBytes;
+    this->totalUploadBytes += uploadedBytes;
+    this->lastFrameUploadMs = uploadedBytes > 0 ? getElapsedMs() : 0.0f;
+    this->maxFrameUploadMs = std::max(this->maxFrameUploadMs, this->lastFrameUploadMs);
+}
+
+// Find A Handle's Model
+ModelStreamer::StreamedModelStruct *ModelStreamer::find(const ModelHandle &handle) {
+    std::lock_guard<std::mutex> lock(this->modelsMutex);
+    if(handle == 0 || handle > this->models.size()) return nullptr;
+    return this->models[handle - 1].get();
+}
+
+// Get A Streamed Model's State
+ModelStreamState ModelStreamer::getState(const ModelHandle &handle) {
+    StreamedModelStruct *streamedModel = this->find(handle);
+    return streamedModel == nullptr ? MODEL_STREAM_FAILED : streamedModel->state.load(std::memory_order_acquire);
+}
+
+// Get A Streamed Model (nullptr Until it's Ready)
+Model *ModelStreamer::getModel(const ModelHandle &handle) {
+    StreamedModelStruct *streamedModel = this->find(handle);
+    if(streamedModel == nullptr || streamedModel->state.load(std::memory_order_acquire) != MODEL_STREAM_READY) return nullptr;
+    return &streamedModel->model;
+}
+
+// Get A Streamed Model's Bounding Box (Known as Soon as it's Imported, Before Anything is Uploaded)
+bool ModelStreamer::getBoundingBox(const ModelHandle &handle, BoundingBox &boundingBox) {
+    StreamedModelStruct *streamedModel = this->find(handle);
+    if(streamedModel == nullptr) return false;
+    const ModelStreamState state{streamedModel->state.load(std::memory_order_acquire)};
+    if(state == MODEL_STREAM_IMPORTING || state == MODEL_STREAM_FAILED) return false;
+    boundingBox = streamedModel->modelData.boundingBox;
+    return true;
+}
+
+// Get Statistics (Upload Figures Come From The Latest update() Call)
+ModelStreamerStatsStruct ModelStreamer::getStats(void) {
+    ModelStreamerStatsStruct stats;
+    {
+        std::lock_guard<std::mutex> lock(this->modelsMutex);
+        for(const std::unique_ptr<StreamedModelStruct> &streamedModel : this->models) {
+            switch(streamedModel->state.load(std::memory_order_acquire)) {
+                case MODEL_STREAM_IMPORTING:
+                    stats.importingModelCount++;
+                    break;
+                case MODEL_STREAM_UPLOADING:
+                    stats.uploadingModelCount++;
+                    break;
+                case MODEL_STREAM_READY:
+                    stats.readyModelCount++;
+                    break;
+                case MODEL_STREAM_FAILED:
+                    stats.failedModelCount++;
+                    break;
+            }
+        }
+    }
+    stats.lastFrameUploadBytes = this->lastFrameUploadBytes;
+    stats.totalUploadBytes = this->totalUploadBytes;
+    stats.lastFrameUploadMs = this->lastFrameUploadMs;
+    stats.maxFrameUploadMs = this->maxFrameUploadMs;
+    return stats;
+}
+
+// Get Statistics as A Single Line Report
+std::string ModelStreamer::getStatsReport(void) {
+    const ModelStreamerStatsStruct stats{this->getStats()};
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << stats.importingModelCount << " Importing, " << stats.uploadingModelCount << " Uploading, " << stats.readyModelCount << " Ready, " << stats.failedModelCount << " Failed"
+           << " | Last Frame Upload: " << stats.lastFrameUploadBytes / 1024.0f << " KB in " << stats.lastFrameUploadMs << "ms (Max " << stats.maxFrameUploadMs << "ms)"
+           << " | Total Uploaded: " << stats.totalUploadBytes / (1024.0f * 1024.0f) << " MB";
+    return report.str();
+}
+
+// Destroy
+void ModelStreamer::destroy(void) {
+    // Let Running Imports Finish First
+    JobSystem::wait(this->importCounter);
+
+    // Delete Every Model Including Half Uploaded Ones
+    std::lock_guard<std::mutex> lock(this->modelsMutex);
+    for(const std::unique_ptr<StreamedModelStruct> &streamedModel : this->models) {
+        if(streamedModel->textureRow > 0) streamedModel->texture.destroy();
+        streamedModel->model.destroy();
+        Model::freeModelData(streamedModel->modelData);
+    }
+    this->models.clear();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// EGL (Native Platform Interface)
+#include<EGL/egl.h>
+#include<EGL/eglext.h>
+
+// Headless Context Class - An OpenGL 4.6 Core Context Without A Window or Display (EGL With The Mesa Surfaceless Platform)
+// There's No Default Framebuffer so Frames Are Rendered Into An Offscreen Framebuffer Object Instead (Works on Mesa llvmpipe Without A GPU)
+class HeadlessContext {
+    public:
+        // Constructor - Set The Offscreen Framebuffer Size
+        HeadlessContext(const unsigned int &width, const unsigned int &height);
+
+        // Create The Context, Make it Current and Create The Offscreen Framebuffer (GLAD Must Be Loaded in Between Using getProcAddress)
+        bool create(void);
+        bool createFramebuffer(void);
+
+        // Make The Context Current on The Calling Thread or Release it (A Context is Current on At Most One Thread)
+        bool makeCurrent(void);
+        void releaseCurrent(void);
+
+        // Create A Second Context Sharing Objects (Buffers, Textures and Syncs) With The Main One and Make it Current on Another Thread (e.g. The Upload Thread)
+        bool createSharedContext(void);
+        bool makeSharedContextCurrent(void);
+
+        // Write The Offscreen Framebuffer's Color to A Binary PPM Image (Top Row First)
+        bool writeFrame(const std::string &filePath);
+
+        // OpenGL Function Loader For GLAD
+        static void* getProcAddress(const char* name) {return (void*)eglGetProcAddress(name);}
+
+        // Getters
+        GLuint getFramebuffer(void) {return this->framebuffer;}
+        unsigned int getWidth(void) {return this->width;}
+        unsigned int getHeight(void) {return this->height;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Offscreen Framebuffer Size
+        unsigned int width, height;
+
+        // EGL Display and Context
+        EGLDisplay display{EGL_NO_DISPLAY};
+        EGLContext context{EGL_NO_CONTEXT}, sharedContext{EGL_NO_CONTEXT};
+
+        // Offscreen Framebuffer Object (Color and Depth/Stencil Renderbuffers)
+        GLuint framebuffer{0}, colorRenderbuffer{0}, depthStencilRenderbuffer{0};
+};
@@ -0,0 +1,169 @@
+#include"HeadlessContext.hpp"
+
+// Standard Headers
+#include<vector>
+#include<cstring>
+#include<fstream>
+#include<iostream>
+
+// Custom Engine Headers
+#include"../Memory/GPUMemoryTracker.hpp"
+
+// Constructor
+HeadlessContext::HeadlessContext(const unsigned int &width, const unsigned int &height) {
+    this->width = width;
+    this->height = height;
+}
+
+// Create The Context and Make it Current
+bool HeadlessContext::create(void) {
+    // Prefer The Surfaceless Platform (No Window System at All), Falling Back to The Default Display
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if(clientExtensions != nullptr && std::strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != nullptr && eglGetPlatformDisplayEXT != nullptr) {
+        this->display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+    if(this->display == EGL_NO_DISPLAY) this->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    // Initialize EGL
+    EGLint majorVersion, minorVersion;
+    if(this->display == EGL_NO_DISPLAY || !eglInitialize(this->display, &majorVersion, &minorVersion)) {
+        std::cerr << "Failed to Initialize EGL!\n";
+        return false;
+    }
+
+    // Desktop OpenGL Without A Window Surface Needs EGL_KHR_surfaceless_context (And Creating it Without A Config Needs EGL_KHR_no_config_context)
+    const char* displayExtensions = eglQueryString(this->display, EGL_EXTENSIONS);
+    if(displayExtensions == nullptr || std::strstr(displayExtensions, "EGL_KHR_surfaceless_context") == nullptr || std::strstr(displayExtensions, "EGL_KHR_no_config_context") == nullptr) {
+        std::cerr << "EGL Display Doesn't Support Surfaceless Contexts!\n";
+        this->destroy();
+        return false;
+    }
+    if(!eglBindAPI(EGL_OPENGL_API)) {
+        std::cerr << "EGL Doesn't Support Desktop OpenGL!\n";
+        this->destroy();
+        return false;
+    }
+
+    // Create An OpenGL 4.6 Core Context and Make it Current Without A Surface
+    const EGLint contextAttributes[] {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 6,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    this->context = eglCreateContext(this->display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+    if(this->context == EGL_NO_CONTEXT || !eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, this->context)) {
+        std::cerr << "Failed to Create Headless OpenGL 4.6 Context! (Mesa Drivers That Don't Expose 4.6 Need MESA_GL_VERSION_OVERRIDE=4.6 MESA_GLSL_VERSION_OVERRIDE=460)\n";
+        this->destroy();
+        return false;
+    }
+    return true;
+}
+
+// Create A Second Context Sharing Objects With The Main One
+bool HeadlessContext::createSharedContext(void) {
+    const EGLint contextAttributes[] {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 6,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    this->sharedContext = eglCreateContext(this->display, EGL_NO_CONFIG_KHR, this->context, contextAttributes);
+    if(this->sharedContext == EGL_NO_CONTEXT) {
+        std::cerr << "Failed to Create Shared Headless OpenGL Context!\n";
+        return false;
+    }
+    return true;
+}
+
+// Make The Shared Context Current on The Calling Thread (Released With releaseCurrent)
+bool HeadlessContext::makeSharedContextCurrent(void) {
+    if(eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, this->sharedContext)) return true;
+    std::cerr << "Failed to Make Shared Headless Context Current!\n";
+    return false;
+}
+
+// Create The Offscreen Framebuffer (Stands in For The Default Framebuffer)
+bool HeadlessContext::createFramebuffer(void) {
+    // Color and Depth/Stencil Renderbuffers
+    glGenRenderbuffers(1, &this->colorRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, this->colorRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, this->width, this->height);
+    glGenRenderbuffers(1, &this->depthStencilRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, this->depthStencilRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, this->width, this->height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    GPUMemoryTracker::trackRenderbuffer(this->colorRenderbuffer, GL_RGBA8, this->width, this->height, 1, "Headless Backbuffer");
+    GPUMemoryTracker::trackRenderbuffer(this->depthStencilRenderbuffer, GL_DEPTH24_STENCIL8, this->width, this->height, 1, "Headless Backbuffer");
+
+    // Framebuffer Object
+    glGenFramebuffers(1, &this->framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->colorRenderbuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, this->depthStencilRenderbuffer);
+
+    // Check if Framebuffer Object is Complete
+    const bool complete{glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE};
+    if(!complete) std::cerr << "Headless Framebuffer is Not Complete!\n";
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return complete;
+}
+
+// Make The Context Current on The Calling Thread
+bool HeadlessContext::makeCurrent(void) {
+    if(eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, this->context)) return true;
+    std::cerr << "Failed to Make Headless Context Current!\n";
+    return false;
+}
+
+// Release The Context From The Calling Thread
+void HeadlessContext::releaseCurrent(void) {
+    eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+// Write The Offscreen Framebuffer's Color to A Binary PPM Image
+bool HeadlessContext::writeFrame(const std::string &filePath) {
+    // Read Back The Color Buffer (Bottom Row First)
+    std::vector<unsigned char> pixels(this->width * this->height * 3);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glNamedFramebufferReadBuffer(this->framebuffer, GL_COLOR_ATTACHMENT0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, this->framebuffer);
+    glReadPixels(0, 0, this->width, this->height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    // Open Image File
+    std::ofstream imageFile(filePath, std::ios::binary);
+    if(!imageFile) {
+        std::cerr << "Failed to Write Frame: " << filePath << "\n";
+        return false;
+    }
+
+    // Write Header Then Rows Top to Bottom
+    imageFile << "P6\n" << this->width << " " << this->height << "\n255\n";
+    for(unsigned int row = this->height; row > 0; row--) imageFile.write((const char*)&pixels[(row - 1) * this->width * 3], this->width * 3);
+    return true;
+}
+
+// Destroy
+void HeadlessContext::destroy(void) {
+    // Delete Offscreen Framebuffer
+    if(this->framebuffer != 0) {
+        glDeleteFramebuffers(1, &this->framebuffer);
+        GPUMemoryTracker::untrack(GL_RENDERBUFFER, this->colorRenderbuffer);
+        GPUMemoryTracker::untrack(GL_RENDERBUFFER, this->depthStencilRenderbuffer);
+        glDeleteRenderbuffers(1, &this->colorRenderbuffer);
+        glDeleteRenderbuffers(1, &this->depthStencilRenderbuffer);
+        this->framebuffer = this->colorRenderbuffer = this->depthStencilRenderbuffer = 0;
+    }
+
+    // Destroy Context and Terminate EGL
+    if(this->display != EGL_NO_DISPLAY) {
+        eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if(this->sharedContext != EGL_NO_CONTEXT) eglDestroyContext(this->display, this->sharedContext);
+        if(this->context != EGL_NO_CONTEXT) eglDestroyContext(this->display, this->context);
+        eglTerminate(this->display);
+    }
+    this->context = this->sharedContext = EGL_NO_CONTEXT;
+    this->display = EGL_NO_DISPLAY;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+// Standard Headers
+#include<atomic>
+#include<string>
+#include<chrono>
+#include<cstdint>
+
+// Time Stamp Counter Intrinsics
+#if defined(__x86_64__) || defined(__i386__)
+#include<x86intrin.h>
+#endif
+
+// Profiling Zones Compile to Nothing Unless The Build Defines CPU_PROFILER_ENABLED (CMake Option CPU_PROFILER)
+// Zone Names Must Outlive The Capture - Use String Literals or CPUProfiler::internName()
+#ifdef CPU_PROFILER_ENABLED
+#define CPU_PROFILE_CONCAT_INNER(a, b) a##b
+#define CPU_PROFILE_CONCAT(a, b) CPU_PROFILE_CONCAT_INNER(a, b)
+#define CPU_PROFILE_SCOPE(name) CPUProfilerZone CPU_PROFILE_CONCAT(cpuProfilerZone, __LINE__)(name)
+#define CPU_PROFILE_THREAD_NAME(name) CPUProfiler::setThreadName(name)
+#else
+#define CPU_PROFILE_SCOPE(name) ((void)0)
+#define CPU_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+// CPU Profiler Event (A Finished Zone)
+struct CPUProfilerEventStruct {
+    const char *name;
+    std::uint64_t startTime, endTime;
+    std::uint32_t depth;
+};
+
+// CPU Profiler Class - Every Thread Records Finished Zones Into Its Own Ring Buffer Without Locks (Only Registering A Thread Locks)
+// Timestamps Come From The Time Stamp Counter on x86 (Calibrated Against steady_clock When A Trace is Written) and steady_clock Elsewhere
+class CPUProfiler {
+    public:
+        // Events Kept Per Thread (Older Events Are Overwritten)
+        static constexpr unsigned int eventCapacity{16384};
+
+        // Current Timestamp in Profiler Ticks
+        static std::uint64_t now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+
+        // Record A Finished Zone on The Calling Thread
+        static void record(const char *name, const std::uint64_t &startTime, const std::uint64_t &endTime, const std::uint32_t &depth);
+
+        // Nesting Depth of The Calling Thread's Open Zones
+        static std::uint32_t &getDepth(void);
+
+        // Name The Calling Thread in Traces
+        static void setThreadName(const std::string &name);
+
+        // Get A Copy of A Dynamic Name That Lives as Long as The Program (Zone Names Are Stored as Pointers)
+        static const char *internName(const std::string &name);
+
+        // Write Every Thread's Recorded Events as Chrome Trace JSON (Opens in chrome://tracing and Perfetto)
+        static void writeTrace(const std::string &filePath);
+};
+
+// CPU Profiler Zone - Records Everything Until it Goes Out of Scope
+class CPUProfilerZone {
+    public:
+        CPUProfilerZone(const char *name) : name(name), startTime(CPUProfiler::now()), depth(CPUProfiler::getDepth()++) {}
+        ~CPUProfilerZone(void) {
+            CPUProfiler::getDepth()--;
+            CPUProfiler::record(this->name, this->startTime, CPUProfiler::now(), this->depth);
+        }
+        CPUProfilerZone(const CPUProfilerZone&) = delete;
+        CPUProfilerZone &operator=(const CPUProfilerZone&) = delete;
+    private:
+        const char *name;
+        std::uint64_t startTime;
+        std::uint32_t depth;
+};
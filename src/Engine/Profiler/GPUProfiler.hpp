@@ -0,0 +1,104 @@
+#pragma once
+
+// Standard Headers
+#include<map>
+#include<string>
+#include<vector>
+#include<cstdint>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Rolling GPU Time Statistics of A Profiler Scope
+struct GPUProfilerStatsStruct {
+    std::string name;
+    unsigned int depth{0};
+    float lastMs{0.0f}, averageMs{0.0f}, minMs{0.0f}, maxMs{0.0f};
+};
+
+// GPU Profiler Class - Times Nested Scopes With Timestamp Queries That Are Read Back Several Frames Later so The CPU Never Waits on The GPU
+// Every Scope is Also A Debug Group so Frame Debuggers (RenderDoc, Nsight) Show The Same Hierarchy
+class GPUProfiler {
+    public:
+        // Constructor - Create Query Pools For frameLatency Frames of Up to maxScopesPerFrame Scopes, Statistics Average The Last statsWindow Frames
+        GPUProfiler(const unsigned int &frameLatency, const unsigned int &maxScopesPerFrame, const unsigned int &statsWindow);
+
+        // Bracket A Frame - beginFrame Reads Back The Oldest Frame in Flight (if The GPU Has Finished it)
+        void beginFrame(void);
+        void endFrame(void);
+
+        // Begin / End A Nested Scope (Use GPUProfilerScope to Do Both Automatically)
+        // Names Are Kept Until The Frame is Read Back Several Frames Later - Use String Literals
+        void beginScope(const char *name);
+        void endScope(void);
+
+        // Record The Next frameCount Frames For A Chrome Trace / Perfetto JSON Export, Written Once They Are Read Back
+        void captureTrace(const std::string &filePath, const unsigned int &frameCount);
+
+        // Setters
+        void setEnabled(const bool &enabled) {this->enabled = enabled;}
+
+        // Getters
+        bool isEnabled(void) {return this->enabled;}
+        bool isCapturingTrace(void) {return this->traceFramesPending > 0;}
+        std::vector<GPUProfilerStatsStruct> getStats(void);
+        std::string getStatsReport(void);
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Scope Recorded in A Frame
+        struct ScopeStruct {
+            const char *name;
+            unsigned int depth{0}, queryIndex{0};
+        };
+
+        // Frame in Flight - Two Timestamp Queries (Begin and End) Per Scope, lastQueryIndex is The Last One Issued (The Frame Scope's End, Not The Last Allocated)
+        struct FrameStruct {
+            std::vector<GLuint> queries;
+            std::vector<ScopeStruct> scopes;
+            unsigned int usedQueryCount{0}, lastQueryIndex{0};
+            bool pending{false}, captured{false};
+        };
+        std::vector<FrameStruct> frames;
+        unsigned int frameIndex{0}, statsWindow;
+        bool enabled{true}, recording{false};
+
+        // Open Scopes (Indices Into The Current Frame's Scopes, or -1 For Scopes That Didn't Fit in The Pool)
+        std::vector<int> openScopes;
+
+        // Rolling Statistics Per Scope Name (Times Are A Ring Buffer of The Last statsWindow Frames)
+        struct ScopeHistoryStruct {
+            unsigned int depth{0}, nextTime{0};
+            std::vector<float> timesMs;
+        };
+        std::map<std::string, ScopeHistoryStruct, std::less<>> history;
+        std::vector<std::string> scopeOrder;
+
+        // Trace Capture
+        struct TraceEventStruct {
+            std::string name;
+            std::uint64_t startTime, endTime;
+            unsigned int depth;
+        };
+        std::vector<TraceEventStruct> traceEvents;
+        std::string traceFilePath;
+        unsigned int traceFramesToCapture{0}, traceFramesPending{0};
+
+        // Read Back A Finished Frame's Queries
+        bool readFrame(FrameStruct &frame);
+
+        // Write Captured Trace Events as Chrome Trace JSON
+        void writeTrace(void);
+};
+
+// GPU Profiler Scope - Times Everything Until it Goes Out of Scope
+class GPUProfilerScope {
+    public:
+        GPUProfilerScope(GPUProfiler &profiler, const char *name) : profiler(profiler) {this->profiler.beginScope(name);}
+        ~GPUProfilerScope(void) {this->profiler.endScope();}
+        GPUProfilerScope(const GPUProfilerScope&) = delete;
+        GPUProfilerScope &operator=(const GPUProfilerScope&) = delete;
+    private:
+        GPUProfiler &profiler;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+// Standard Headers
+#include<cstdio>
+#include<string>
+
+// Escape A String For A JSON Value - Shared by Trace and Benchmark Report Writers (Thread, Scope, Driver and Scene Names Can Hold Quotes, Backslashes or Control Characters)
+inline std::string escapeJSON(const std::string &text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for(const char &character : text) {
+        if(character == '"' || character == '\\') {
+            escaped += '\\';
+            escaped += character;
+        } else if((unsigned char)character < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", (unsigned int)(unsigned char)character);
+            escaped += code;
+        } else {
+            escaped += character;
+        }
+    }
+    return escaped;
+}
@@ -0,0 +1,149 @@
+#include"CPUProfiler.hpp"
+
+// Standard Headers
+#include<mutex>
+#include<thread>
+#include<vector>
+#include<memory>
+#include<fstream>
+#include<iostream>
+#include<algorithm>
+#include<unordered_set>
+
+// Custom Engine Headers
+#include"JSONEscape.hpp"
+
+// Per Thread Ring Buffer - Only Its Thread Writes Events, writeCount Publishes Them to Trace Writers
+// startedWriteCount Goes Up Before An Event is Written so A Trace Writer Can Tell Which Events A Write Overlapped Its Copy (A Sequence Lock Per Slot)
+struct CPUProfilerThreadBufferStruct {
+    CPUProfilerEventStruct events[CPUProfiler::eventCapacity];
+    std::atomic<std::uint64_t> writeCount{0}, startedWriteCount{0};
+    std::string threadName;
+    std::uint32_t depth{0};
+    bool inUse{false};
+};
+
+// Registry of Every Thread Buffer (Buffers of Finished Threads Are Reused so Short Lived Worker Threads Don't Leak Memory, Starting Empty Under A Default Name)
+static std::mutex registryMutex;
+static std::vector<std::unique_ptr<CPUProfilerThreadBufferStruct>> threadBuffers;
+static std::unordered_set<std::string> internedNames;
+
+// Timestamp Calibration Point (Taken at Startup)
+static const std::uint64_t startTicks{CPUProfiler::now()};
+static const std::chrono::steady_clock::time_point startClock{std::chrono::steady_clock::now()};
+
+// Calling Thread's Buffer (Registered on First Use, Released When The Thread Exits)
+struct CPUProfilerThreadHandleStruct {
+    CPUProfilerThreadBufferStruct *buffer{nullptr};
+    ~CPUProfilerThreadHandleStruct(void) {
+        if(this->buffer == nullptr) return;
+        std::lock_guard<std::mutex> lock(registryMutex);
+        this->buffer->inUse = false;
+    }
+};
+static thread_local CPUProfilerThreadHandleStruct threadHandle;
+static CPUProfilerThreadBufferStruct &getThreadBuffer(void) {
+    if(threadHandle.buffer != nullptr) return *threadHandle.buffer;
+
+    // Reuse A Finished Thread's Buffer or Register A New One (Trace Writers Copy Under The Same Lock so They Never See A Buffer Half Reset)
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::size_t bufferIndex{0};
+    for(; bufferIndex < threadBuffers.size(); bufferIndex++) {
+        if(!threadBuffers[bufferIndex]->inUse) break;
+    }
+    if(bufferIndex == threadBuffers.size()) threadBuffers.push_back(std::make_unique<CPUProfilerThreadBufferStruct>());
+    threadHandle.buffer = threadBuffers[bufferIndex].get();
+
+    // The Previous Thread's Events and Name Don't Carry Over
+    threadHandle.buffer->writeCount.store(0, std::memory_order_relaxed);
+    threadHandle.buffer->startedWriteCount.store(0, std::memory_order_relaxed);
+    threadHandle.buffer->threadName = bufferIndex == 0 ? "Main Thread" : "Thread " + std::to_string(bufferIndex);
+    threadHandle.buffer->inUse = true;
+    threadHandle.buffer->depth = 0;
+    return *threadHandle.buffer;
+}
+
+// Record A Finished Zone on The Calling Thread
+void CPUProfiler::record(const char *name, const std::uint64_t &startTime, const std::uint64_t &endTime, const std::uint32_t &depth) {
+    CPUProfilerThreadBufferStruct &buffer = getThreadBuffer();
+    const std::uint64_t writeCount{buffer.writeCount.load(std::memory_order_relaxed)};
+    buffer.startedWriteCount.store(writeCount + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    buffer.events[writeCount % eventCapacity] = {name, startTime, endTime, depth};
+    buffer.writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+// Nesting Depth of The Calling Thread's Open Zones
+std::uint32_t &CPUProfiler::getDepth(void) {
+    return getThreadBuffer().depth;
+}
+
+// Name The Calling Thread in Traces
+void CPUProfiler::setThreadName(const std::string &name) {
+    CPUProfilerThreadBufferStruct &buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer.threadName = name;
+}
+
+// Get A Copy of A Dynamic Name That Lives as Long as The Program
+const char *CPUProfiler::internName(const std::string &name) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return internedNames.insert(name).first->c_str();
+}
+
+// Write Every Thread's Recorded Events as Chrome Trace JSON
+void CPUProfiler::writeTrace(const std::string &filePath) {
+    // Calibrate Ticks Against steady_clock Over at Least 50ms
+    const std::chrono::steady_clock::time_point minCalibrationEnd{startClock + std::chrono::milliseconds(50)};
+    if(std::chrono::steady_clock::now() < minCalibrationEnd) std::this_thread::sleep_until(minCalibrationEnd);
+    const std::uint64_t calibrationTicks{CPUProfiler::now() - startTicks};
+    const double calibrationMicroseconds{std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startClock).count()};
+    const double microsecondsPerTick{calibrationMicroseconds / (double)calibrationTicks};
+
+    // Snapshot Every Thread's Ring (Events A Write Overlapped While Copying Are Dropped Rather Than Written Torn)
+    struct ThreadEventsStruct {
+        std::string threadName;
+        std::vector<CPUProfilerEventStruct> events;
+    };
+    std::vector<ThreadEventsStruct> threadEvents;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for(const std::unique_ptr<CPUProfilerThreadBufferStruct> &buffer : threadBuffers) {
+            ThreadEventsStruct thread;
+            thread.threadName = buffer->threadName;
+            const std::uint64_t endCount{buffer->writeCount.load(std::memory_order_acquire)};
+            const std::uint64_t beginCount{endCount > eventCapacity ? endCount - eventCapacity : 0};
+            for(std::uint64_t i = beginCount; i < endCount; i++) thread.events.push_back(buffer->events[i % eventCapacity]);
+
+            // Drop Events The Thread Overwrote (Or Was Overwriting) During The Copy - The Fence Pairs With The One in record() so Any Write The Copy Saw Part of is Counted
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const std::uint64_t startedCount{buffer->startedWriteCount.load(std::memory_order_relaxed)};
+            const std::uint64_t firstIntactCount{startedCount > eventCapacity ? startedCount - eventCapacity : 0};
+            if(firstIntactCount > beginCount) thread.events.erase(thread.events.begin(), thread.events.begin() + std::min<std::uint64_t>(firstIntactCount - beginCount, thread.events.size()));
+            threadEvents.push_back(thread);
+        }
+    }
+
+    // Open Trace File
+    std::ofstream traceFile(filePath);
+    if(!traceFile) {
+        std::cerr << "Failed to Write CPU Trace: " << filePath << "\n";
+        return;
+    }
+
+    // Write Thread Names Then Every Event (Microseconds Since Startup)
+    std::size_t eventCount{0};
+    traceFile.precision(3);
+    traceFile << std::fixed << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for(unsigned int i = 0; i < threadEvents.size(); i++) {
+        traceFile << (i == 0 ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i + 1 << ",\"args\":{\"name\":\"" << escapeJSON(threadEvents[i].threadName) << "\"}}";
+        for(const CPUProfilerEventStruct &event : threadEvents[i].events) {
+            const double startMicroseconds{(double)(std::int64_t)(event.startTime - startTicks) * microsecondsPerTick};
+            traceFile << ",\n{\"name\":\"" << escapeJSON(event.name) << "\",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":1,\"tid\":" << i + 1 << ",\"ts\":" << startMicroseconds
+                      << ",\"dur\":" << (double)(event.endTime - event.startTime) * microsecondsPerTick << ",\"args\":{\"depth\":" << event.depth << "}}";
+        }
+        eventCount += threadEvents[i].events.size();
+    }
+    traceFile << "\n]}\n";
+    std::cout << "CPU Trace Written: " << filePath << " (" << eventCount << " Events)" << std::endl;
+}
@@ -0,0 +1,194 @@
+#include"GPUProfiler.hpp"
+
+// Standard Headers
+#include<fstream>
+#include<sstream>
+#include<iostream>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"JSONEscape.hpp"
+
+// Constructor - Create Query Pools
+GPUProfiler::GPUProfiler(const unsigned int &frameLatency, const unsigned int &maxScopesPerFrame, const unsigned int &statsWindow) {
+    // Set Statistics Window
+    this->statsWindow = std::max(statsWindow, 1u);
+
+    // One Query Pool Per Frame in Flight
+    this->frames.resize(std::max(frameLatency, 1u));
+    for(FrameStruct &frame : this->frames) {
+        frame.queries.resize(maxScopesPerFrame * 2);
+        glGenQueries(frame.queries.size(), frame.queries.data());
+    }
+}
+
+// Begin A Frame
+void GPUProfiler::beginFrame(void) {
+    this->openScopes.clear();
+    this->recording = false;
+    if(!this->enabled) return;
+
+    // Reuse The Oldest Frame's Queries Once Read Back - if The GPU Hasn't Finished it Yet This Frame Goes Unprofiled Rather Than Stalling
+    FrameStruct &frame = this->frames[this->frameIndex % this->frames.size()];
+    if(frame.pending && !this->readFrame(frame)) return;
+    frame.scopes.clear();
+    frame.usedQueryCount = 0;
+    frame.captured = this->traceFramesToCapture > 0;
+    if(frame.captured) this->traceFramesToCapture--;
+    this->recording = true;
+
+    // Whole Frame Scope
+    this->beginScope("Frame");
+}
+
+// End A Frame
+void GPUProfiler::endFrame(void) {
+    // Close Every Open Scope (Including The Frame Scope)
+    while(!this->openScopes.empty()) this->endScope();
+    if(this->recording) {
+        FrameStruct &frame = this->frames[this->frameIndex % this->frames.size()];
+        frame.pending = frame.usedQueryCount > 0;
+    }
+    this->recording = false;
+    this->frameIndex++;
+}
+
+// Begin A Nested Scope
+void GPUProfiler::beginScope(const char *name) {
+    if(!this->recording) return;
+    glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+
+    // Scopes Beyond The Query Pool Still Get A Debug Group but Aren't Timed
+    FrameStruct &frame = this->frames[this->frameIndex % this->frames.size()];
+    if(frame.usedQueryCount + 2 > frame.queries.size()) {
+        this->openScopes.push_back(-1);
+        return;
+    }
+    ScopeStruct scope;
+    scope.name = name;
+    scope.depth = this->openScopes.size();
+    scope.queryIndex = frame.usedQueryCount;
+    frame.scopes.push_back(scope);
+    frame.usedQueryCount += 2;
+    frame.lastQueryIndex = scope.queryIndex;
+    glQueryCounter(frame.queries[scope.queryIndex], GL_TIMESTAMP);
+    this->openScopes.push_back(frame.scopes.size() - 1);
+}
+
+// End The Innermost Scope
+void GPUProfiler::endScope(void) {
+    if(!this->recording || this->openScopes.empty()) return;
+    const int scopeIndex{this->openScopes.back()};
+    this->openScopes.pop_back();
+    if(scopeIndex >= 0) {
+        FrameStruct &frame = this->frames[this->frameIndex % this->frames.size()];
+        frame.lastQueryIndex = frame.scopes[scopeIndex].queryIndex + 1;
+        glQueryCounter(frame.queries[frame.lastQueryIndex], GL_TIMESTAMP);
+    }
+    glPopDebugGroup();
+}
+
+// Record The Next frameCount Frames For A Trace Export
+void GPUProfiler::captureTrace(const std::string &filePath, const unsigned int &frameCount) {
+    this->traceEvents.clear();
+    this->traceFilePath = filePath;
+    this->traceFramesToCapture = frameCount;
+    this->traceFramesPending = frameCount;
+}
+
+// Rolling Statistics of Every Scope (In The Order They Were First Seen)
+std::vector<GPUProfilerStatsStruct> GPUProfiler::getStats(void) {
+    std::vector<GPUProfilerStatsStruct> stats;
+    for(const std::string &name : this->scopeOrder) {
+        const ScopeHistoryStruct &scopeHistory = this->history[name];
+        if(scopeHistory.timesMs.empty()) continue;
+        GPUProfilerStatsStruct scopeStats;
+        scopeStats.name = name;
+        scopeStats.depth = scopeHistory.depth;
+        scopeStats.lastMs = scopeHistory.timesMs[(scopeHistory.nextTime + this->statsWindow - 1) % this->statsWindow];
+        scopeStats.minMs = *std::min_element(scopeHistory.timesMs.begin(), scopeHistory.timesMs.end());
+        scopeStats.maxMs = *std::max_element(scopeHistory.timesMs.begin(), scopeHistory.timesMs.end());
+        for(const float &timeMs : scopeHistory.timesMs) scopeStats.averageMs += timeMs;
+        scopeStats.averageMs /= scopeHistory.timesMs.size();
+        stats.push_back(scopeStats);
+    }
+    return stats;
+}
+
+// Rolling Statistics as Text (One Indented Line Per Scope)
+std::string GPUProfiler::getStatsReport(void) {
+    std::ostringstream report;
+    report.precision(3);
+    report << std::fixed;
+    for(const GPUProfilerStatsStruct &scopeStats : this->getStats()) {
+        report << std::string(scopeStats.depth * 2, ' ') << scopeStats.name << ": " << scopeStats.averageMs << "ms Average (" << scopeStats.minMs << " Min, " << scopeStats.maxMs << " Max)\n";
+    }
+    return report.str();
+}
+
+// Read Back A Finished Frame's Queries
+bool GPUProfiler::readFrame(FrameStruct &frame) {
+    // Queries Finish in Order so The Last One Issued Being Available Means They All Are (Outer Scopes End After Inner Ones Allocated Later)
+    GLint resultAvailable{0};
+    glGetQueryObjectiv(frame.queries[frame.lastQueryIndex], GL_QUERY_RESULT_AVAILABLE, &resultAvailable);
+    if(!resultAvailable) return false;
+    frame.pending = false;
+
+    // Record Every Scope's Time
+    for(const ScopeStruct &scope : frame.scopes) {
+        GLuint64 startTime{0}, endTime{0};
+        glGetQueryObjectui64v(frame.queries[scope.queryIndex], GL_QUERY_RESULT, &startTime);
+        glGetQueryObjectui64v(frame.queries[scope.queryIndex + 1], GL_QUERY_RESULT, &endTime);
+        if(endTime < startTime) endTime = startTime;
+
+        // Rolling Statistics (Looked Up Without Building A String, The History is Only Allocated For New Scope Names)
+        auto scopeHistoryEntry = this->history.find(scope.name);
+        if(scopeHistoryEntry == this->history.end()) {
+            scopeHistoryEntry = this->history.emplace(scope.name, ScopeHistoryStruct{}).first;
+            scopeHistoryEntry->second.timesMs.reserve(this->statsWindow);
+            this->scopeOrder.push_back(scope.name);
+        }
+        ScopeHistoryStruct &scopeHistory = scopeHistoryEntry->second;
+        scopeHistory.depth = scope.depth;
+        const float timeMs{(float)((double)(endTime - startTime) / 1000000.0)};
+        if(scopeHistory.timesMs.size() < this->statsWindow) scopeHistory.timesMs.push_back(timeMs);
+        else scopeHistory.timesMs[scopeHistory.nextTime] = timeMs;
+        scopeHistory.nextTime = (scopeHistory.nextTime + 1) % this->statsWindow;
+
+        // Trace Events
+        if(frame.captured) this->traceEvents.push_back({scope.name, startTime, endTime, scope.depth});
+    }
+
+    // Write The Trace Once Every Captured Frame is Read Back
+    if(frame.captured && this->traceFramesPending > 0 && --this->traceFramesPending == 0) this->writeTrace();
+    return true;
+}
+
+// Write Captured Trace Events as Chrome Trace JSON (Opens in chrome://tracing and Perfetto)
+void GPUProfiler::writeTrace(void) {
+    std::ofstream traceFile(this->traceFilePath);
+    if(!traceFile) {
+        std::cerr << "Failed to Write GPU Trace: " << this->traceFilePath << "\n";
+        return;
+    }
+
+    // Timestamps Are Nanoseconds on The GPU Clock - Traces Use Microseconds From The First Event
+    std::uint64_t firstTime{UINT64_MAX};
+    for(const TraceEventStruct &event : this->traceEvents) firstTime = std::min(firstTime, event.startTime);
+    traceFile.precision(3);
+    traceFile << std::fixed << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    traceFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"GPU\"}}";
+    for(const TraceEventStruct &event : this->traceEvents) {
+        traceFile << ",\n{\"name\":\"" << escapeJSON(event.name) << "\",\"cat\":\"GPU\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << (double)(event.startTime - firstTime) / 1000.0
+                  << ",\"dur\":" << (double)(event.endTime - event.startTime) / 1000.0 << ",\"args\":{\"depth\":" << event.depth << "}}";
+    }
+    traceFile << "\n]}\n";
+    std::cout << "GPU Trace Written: " << this->traceFilePath << " (" << this->traceEvents.size() << " Events)" << std::endl;
+    this->traceEvents.clear();
+}
+
+// Destroy
+void GPUProfiler::destroy(void) {
+    for(FrameStruct &frame : this->frames) glDeleteQueries(frame.queries.size(), frame.queries.data());
+    this->frames.clear();
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<functional>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"../Shader/Shader.hpp"
+#include"../Shader/ShaderVariants.hpp"
+#include"../Lighting/ClusteredLighting.hpp"
+#include"DrawStats.hpp"
+
+// G-Buffer Render Targets (Owned by The Render Graph)
+struct GBufferStruct {
+    // Albedo and Specular Intensity, Octahedral Normal and Shininess and Sampleable Depth Textures
+    GLuint albedoSpecular, normalShininess, depth;
+
+    // Framebuffer Object The G-Buffer Was Rendered Through (Its Depth is Copied Into The Output)
+    GLuint framebuffer;
+
+    // Rendered Size and Fraction of The Textures it Covers (Pooled Textures Can Be Larger)
+    unsigned int width, height;
+    glm::vec2 uvScale;
+};
+
+// Deferred Renderer Class - Renders Geometry Into A Compact G-Buffer Then Lights Every Pixel Once
+// MSAA Isn't Used (Post-Processing FXAA Smooths Edges Instead) so Lighting Cost Stays Per Pixel
+// Render Targets Come From The Render Graph - A G-Buffer Pass Writes The Three Formats Below, The Lighting Pass Reads Them
+class DeferredRenderer {
+    public:
+        // G-Buffer Formats - Albedo and Specular Intensity, Octahedral Normal and Shininess, Sampleable Depth
+        static constexpr GLenum albedoSpecularFormat{GL_RGBA8}, normalShininessFormat{GL_RGB10_A2}, depthFormat{GL_DEPTH24_STENCIL8};
+
+        // Constructor - Create Shaders
+        DeferredRenderer(const std::string &shaderDirectoryPath);
+
+        // Clear The Bound G-Buffer - Render Opaque Geometry With The Geometry Shaders Afterwards
+        void beginGeometryPass(void);
+
+        // Light Every G-Buffer Pixel Into The Bound Output Framebuffer Using The Clustered Light Lists and Any Extra Light Casters Enabled by The Keywords
+        // Uniforms of Extra Light Casters (e.g. Directional Light and Its Shadows) Are Set Through The Callback
+        // Leaves The Output Framebuffer Bound With The G-Buffer's Depth so Forward Passes (e.g. Skybox) Can Follow
+        void renderLightingPass(const GBufferStruct &gBuffer, const GLuint &outputFramebuffer, ClusteredLighting &clusteredLighting, const glm::mat4 &projectionViewMatrix, const glm::vec3 &viewPos, const unsigned int &keywords, const std::function<void(Shader&)> &setUniforms);
+
+        // Getters
+        ShaderVariants &getGeometryShaders(void) {return this->geometryShaders;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Geometry and Lighting Pass Shader Variants
+        ShaderVariants geometryShaders, lightingShaders;
+
+        // Empty Vertex Array Object (Fullscreen Triangle is Generated in The Vertex Shader)
+        GLuint emptyVAO;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Custom Engine Headers
+#include"../Shader/Shader.hpp"
+
+// Depth Pre-Pass Modes
+enum DepthPrePassMode : unsigned int {
+    DEPTH_PRE_PASS_OFF = 0,
+    DEPTH_PRE_PASS_ON,
+    DEPTH_PRE_PASS_AUTO,
+};
+
+// Depth Pre-Pass Class - Lays Down Depth With A Trivial Shader so Expensive Lighting Shaders Only Run For Visible Fragments
+// Auto Mode Measures Overdraw With Occlusion Queries (Depth Pass Samples / Color Pass Samples) and Only Keeps The Pre-Pass While it Pays Off
+class DepthPrePass {
+    public:
+        // Constructor - Create Depth Only Shaders and Occlusion Queries
+        DepthPrePass(const DepthPrePassMode &mode, const float &enableOverdraw, const float &disableOverdraw, const unsigned int &probeInterval, const std::string &shaderDirectoryPath);
+
+        // Decide Whether This Frame Uses The Pre-Pass (Overdraw Measured in Earlier Frames is Read Without Waiting on The GPU)
+        bool beginFrame(void);
+
+        // Depth Only Pass - Render Opaque Geometry With getShader() and Model::renderDepth() Between These
+        void beginDepthPass(void);
+        void endDepthPass(void);
+
+        // Color Pass - Render Opaque Geometry With Its Usual Shaders Between These (Depth Test is GL_EQUAL While The Pre-Pass is Enabled)
+        void beginColorPass(void);
+        void endColorPass(void);
+
+        // Setters
+        void setMode(const DepthPrePassMode &mode) {this->mode = mode;}
+
+        // Getters
+        Shader &getShader(void) {return this->depthShaders;}
+        bool isEnabled(void) {return this->enabled;}
+        float getOverdraw(void) {return this->overdraw;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Pre-Pass Settings - Auto Mode Turns The Pre-Pass on Above enableOverdraw and Off Below disableOverdraw
+        DepthPrePassMode mode;
+        float enableOverdraw, disableOverdraw;
+
+        // While Off in Auto Mode The Pre-Pass is Re-Enabled For One Frame Every probeInterval Frames to Re-Measure Overdraw
+        unsigned int probeInterval, framesSinceProbe{0};
+
+        // Depth Only Shaders
+        Shader depthShaders;
+
+        // Double Buffered Occlusion Queries (Samples Passed in The Depth and Color Passes)
+        GLuint depthQueries[2], colorQueries[2];
+        bool queryPending[2]{false, false};
+        unsigned int frameIndex{0}, queryIndex{0};
+
+        // Current Frame State and Last Measured Overdraw
+        bool enabled{false}, measuring{false}, autoEnabled{true};
+        float overdraw{1.0f};
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+// Standard Headers
+#include<cstdint>
+
+// Draw Statistics of A Frame
+struct DrawStatsStruct {
+    unsigned int drawCallCount{0};
+    std::uint64_t triangleCount{0};
+};
+
+// Draw Statistics Class - Draw Call Sites Record Every Draw Here, The Main Loop Reads and Resets The Counters Once A Frame (Render Thread Only)
+class DrawStats {
+    public:
+        // Record A Draw Call
+        static void recordDraw(const std::uint64_t &triangleCount) {
+            frameStats.drawCallCount++;
+            frameStats.triangleCount += triangleCount;
+        }
+
+        // Get The Counters Since The Last Reset
+        static DrawStatsStruct get(void) {return frameStats;}
+
+        // Reset The Counters (Start of A Frame)
+        static void reset(void) {frameStats = DrawStatsStruct{};}
+    private:
+        static inline DrawStatsStruct frameStats{};
+};
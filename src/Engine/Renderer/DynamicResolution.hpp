@@ -0,0 +1,47 @@
+#pragma once
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Dynamic Resolution Class - Scales The Scene's Render Resolution so GPU Frame Time Stays Under A Target
+// GPU Frame Time is Measured With Timestamp Queries Read A Few Frames Later (Never Stalling on The GPU), The Scale Drops Quickly
+// When A Frame Runs Over Budget and Recovers Slowly Once There's Headroom Again
+class DynamicResolution {
+    public:
+        // Number of Frames Whose Timestamp Queries Can Be in Flight
+        static constexpr unsigned int queryFrameCount{4};
+
+        // Constructor - Create Timestamp Queries
+        DynamicResolution(const float &targetFrameTimeMs, const float &minScale, const float &maxScale);
+
+        // Bracket A Frame's GPU Work - beginFrame Also Reads Finished Measurements and Updates The Scale
+        void beginFrame(void);
+        void endFrame(void);
+
+        // Setters
+        void setEnabled(const bool &enabled) {this->enabled = enabled;}
+        void setTargetFrameTime(const float &targetFrameTimeMs) {this->targetFrameTimeMs = targetFrameTimeMs;}
+
+        // Getters
+        float getScale(void) {return this->enabled ? this->scale : this->maxScale;}
+        float getGPUFrameTime(void) {return this->gpuFrameTimeMs;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Controller Settings
+        bool enabled{true};
+        float targetFrameTimeMs, minScale, maxScale;
+
+        // Current Scale (Fraction of The Full Resolution Along Each Axis) and Last Measured GPU Frame Time
+        float scale, gpuFrameTimeMs{0.0f};
+
+        // Frame Start and End Timestamp Queries (And The Scale Each Frame Was Rendered at)
+        GLuint startQueries[queryFrameCount], endQueries[queryFrameCount];
+        float queryScales[queryFrameCount]{};
+        bool queryPending[queryFrameCount]{};
+        unsigned int frameIndex{0};
+
+        // Move The Scale Towards One Rendering A Frame in The Target Time
+        void updateScale(void);
+};
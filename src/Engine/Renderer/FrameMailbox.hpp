@@ -0,0 +1,97 @@
+#pragma once
+
+// Standard Headers
+#include<mutex>
+#include<chrono>
+#include<algorithm>
+#include<condition_variable>
+
+// Frame Mailbox Class - Hands Frames From One Producer Thread to One Consumer Thread Through A Fixed Set of Reused Slots
+// With 2 Slots The Producer Builds Frame N+1 While The Consumer Works on Frame N, With 3 it Can Get Two Frames Ahead
+// Frames Are Consumed in Order and Never Dropped, so Either Side Waits When The Other Falls Behind
+template<typename FrameType>
+class FrameMailbox {
+    public:
+        // Most Slots A Mailbox Can Have
+        static constexpr unsigned int maxSlotCount{3};
+
+        // Constructor - Number of Slots (2 = Double Buffered, 3 = Triple Buffered)
+        FrameMailbox(const unsigned int &slotCount) {
+            for(unsigned int i = 0; i < std::clamp(slotCount, 2u, maxSlotCount); i++) this->freeSlots.pushBack(i);
+        }
+
+        // Get A Free Slot to Fill (Producer Only) - Returns nullptr if None Freed Up Within The Timeout or The Mailbox Was Closed
+        // The Slot Still Holds An Old Frame so Containers in it Keep Their Capacity
+        FrameType *beginWrite(const std::chrono::microseconds &timeout) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            if(!this->condition.wait_for(lock, timeout, [this](void) {return this->closed || !this->freeSlots.empty();}) || this->closed) return nullptr;
+            this->writeSlot = this->freeSlots.popFront();
+            return &this->slots[this->writeSlot];
+        }
+
+        // Hand The Filled Slot to The Consumer (Producer Only)
+        void publish(void) {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->publishedSlots.pushBack(this->writeSlot);
+            }
+            this->condition.notify_all();
+        }
+
+        // Wait For The Oldest Published Frame (Consumer Only) - Returns nullptr Once The Mailbox is Closed and Every Published Frame Was Read
+        FrameType *beginRead(void) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->condition.wait(lock, [this](void) {return this->closed || !this->publishedSlots.empty();});
+            if(this->publishedSlots.empty()) return nullptr;
+            this->readSlot = this->publishedSlots.popFront();
+            return &this->slots[this->readSlot];
+        }
+
+        // Return The Read Slot to The Producer (Consumer Only)
+        void endRead(void) {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->freeSlots.pushBack(this->readSlot);
+            }
+            this->condition.notify_all();
+        }
+
+        // Close The Mailbox - Wakes Both Sides, The Producer Gets No More Slots and The Consumer Stops Once Every Published Frame Was Read
+        void close(void) {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->closed = true;
+            }
+            this->condition.notify_all();
+        }
+
+        // Getters
+        bool isClosed(void) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->closed;
+        }
+    private:
+        // Queue of Slot Indices - A Fixed Ring (Each Slot is in At Most One Queue at A Time so it Never Overflows, and Unlike std::deque Never Allocates)
+        struct SlotQueueStruct {
+            unsigned int slots[maxSlotCount]{}, head{0}, count{0};
+
+            bool empty(void) const {return this->count == 0;}
+            void pushBack(const unsigned int &slot) {this->slots[(this->head + this->count++) % maxSlotCount] = slot;}
+            unsigned int popFront(void) {
+                const unsigned int slot{this->slots[this->head]};
+                this->head = (this->head + 1) % maxSlotCount;
+                this->count--;
+                return slot;
+            }
+        };
+
+        // Frame Slots and Which Ones Are Free or Waiting to Be Read
+        FrameType slots[maxSlotCount];
+        SlotQueueStruct freeSlots, publishedSlots;
+        unsigned int writeSlot{0}, readSlot{0};
+        bool closed{false};
+
+        // Synchronization
+        std::mutex mutex;
+        std::condition_variable condition;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+// Standard Headers
+#include<vector>
+#include<chrono>
+#include<string>
+#include<functional>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Frame Pacing Statistics Over The Last Frames (Milliseconds)
+struct FramePacingStatsStruct {
+    float averageFrameIntervalMs{0.0f}, minFrameIntervalMs{0.0f}, maxFrameIntervalMs{0.0f}, frameIntervalJitterMs{0.0f};
+    float averagePresentMs{0.0f}, maxPresentMs{0.0f};
+    float averageFenceWaitMs{0.0f}, maxFenceWaitMs{0.0f};
+    float averageLimiterWaitMs{0.0f};
+};
+
+// Frame Pacer Class - Controls How Far The CPU Runs Ahead of The GPU and How Evenly Frames Are Presented
+// A Fence After Every Present Lets The CPU Wait Until At Most queuedFrameCount Frames Are Queued (1 = Lowest Latency, 3 = Most Throughput)
+// Without Vsync A Frame Rate Limit Sleeps Until Just Before Each Frame's Deadline Then Spins so Frames Start on Time Despite Coarse Sleeps
+class FramePacer {
+    public:
+        // Most Frames That Can Be Queued
+        static constexpr unsigned int maxQueuedFrameCount{3};
+
+        // Constructor - Frames Allowed in Flight (1 to 3), Frame Rate Limit (0 = Unlimited), Time Spent Spinning Before Deadlines and Frames The Statistics Cover
+        FramePacer(const unsigned int &queuedFrameCount, const float &frameRateLimit, const float &spinTimeMs, const unsigned int &statsWindow);
+
+        // Present A Frame (The Callback Swaps Buffers) Then Fence it
+        void present(const std::function<void(void)> &swapBuffers);
+
+        // Wait Until A New Frame May Start - For The GPU to Drain Down to The Queued Frame Limit, Then For The Frame Rate Limit's Deadline
+        void waitForNextFrame(void);
+
+        // Setters
+        void setQueuedFrameCount(const unsigned int &queuedFrameCount);
+        void setFrameRateLimit(const float &frameRateLimit) {this->frameRateLimit = frameRateLimit;}
+
+        // Getters
+        unsigned int getQueuedFrameCount(void) {return this->queuedFrameCount;}
+        FramePacingStatsStruct getStats(void);
+        std::string getStatsReport(void);
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Pacing Settings
+        unsigned int queuedFrameCount, statsWindow;
+        float frameRateLimit, spinTimeMs;
+
+        // Fence of Every Queued Frame (And Which Frame Each Slot Holds)
+        GLsync fences[maxQueuedFrameCount]{};
+        unsigned long long fenceFrames[maxQueuedFrameCount]{}, presentCount{0};
+
+        // Frame Rate Limiter Deadline and Last Present Time
+        std::chrono::steady_clock::time_point nextFrameDeadline, lastPresentTime;
+        bool hasLastPresentTime{false};
+
+        // Per Frame Timings - A Ring of The Last statsWindow Frames Sized Once Up Front so Recording Never Allocates
+        struct FrameTimingStruct {
+            float frameIntervalMs{0.0f}, presentMs{0.0f}, fenceWaitMs{0.0f}, limiterWaitMs{0.0f};
+        };
+        std::vector<FrameTimingStruct> frameTimings;
+        unsigned int nextFrameTiming{0}, frameTimingCount{0};
+        FrameTimingStruct currentTiming;
+
+        // Wait For A Frame's Fence and Delete it
+        void waitForFence(const unsigned int &slot);
+};
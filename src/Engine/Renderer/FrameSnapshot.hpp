@@ -0,0 +1,39 @@
+#pragma once
+
+// Standard Headers
+#include<vector>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"../Model/Model.hpp"
+#include"../Lighting/ClusteredLighting.hpp"
+#include"../Shadows/ShadowCaster.hpp"
+
+// Camera State A Frame is Rendered From
+struct FrameCameraStruct {
+    glm::vec3 position{0.0f}, front{0.0f, 0.0f, -1.0f};
+    glm::mat4 viewMatrix{1.0f}, projectionMatrix{1.0f};
+    float fov{70.0f};
+};
+
+// Model Instance That Passed Culling
+struct RenderInstanceStruct {
+    Model *model{nullptr};
+    glm::mat4 modelMatrix{1.0f};
+};
+
+// Frame Snapshot Struct - Everything The Render Thread Needs to Draw A Frame, Built by The Main Thread and Not Changed After it's Published
+// Shadow Casters Are Gathered With The Instances so Streamed Models Swap in For Their Placeholders in The Same Frame Everywhere
+// Lights Are A Copy so The Main Thread Can Move Them For The Next Frame While This One Renders (The Render Thread Fills in Their Shadow Indices)
+struct FrameSnapshotStruct {
+    unsigned int frameIndex{0};
+    double time{0.0};
+    unsigned int windowWidth{0}, windowHeight{0};
+    FrameCameraStruct camera;
+    std::vector<RenderInstanceStruct> visibleInstances;
+    std::vector<ShadowCasterStruct> shadowCasters;
+    std::vector<LightStruct> lights;
+    bool gpuTraceRequested{false};
+};
@@ -0,0 +1,208 @@
+#pragma once
+
+// Standard Headers
+#include<map>
+#include<new>
+#include<span>
+#include<string>
+#include<vector>
+#include<cstddef>
+#include<cstdint>
+#include<type_traits>
+#include<initializer_list>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"../Profiler/GPUProfiler.hpp"
+
+// Render Graph Resource Handle
+typedef unsigned int RenderGraphResource;
+
+// Render Target Description (Transient Targets With Equal Descriptions Can Share The Same Texture)
+struct RenderTargetDescStruct {
+    // Dimensions
+    unsigned int width{0}, height{0};
+
+    // Internal Format (Depth Formats Are Attached as Depth (Stencil) Attachments) and MSAA Samples (0 = Not Multisampled)
+    GLenum internalFormat{GL_RGBA8};
+    unsigned int samples{0};
+
+    // Equality Check
+    bool operator==(const RenderTargetDescStruct &other) const {
+        return this->width == other.width && this->height == other.height && this->internalFormat == other.internalFormat && this->samples == other.samples;
+    }
+};
+
+// Render Graph Class - Passes Declare What They Read and Write, The Graph Culls Passes Nothing Needs,
+// Allocates Transient Render Targets From A Pool (Aliasing Targets Whose Lifetimes Don't Overlap) and Invalidates Them After Their Last Use
+// Pooled Textures Can Be Larger Than The Targets Using Them so Resizing Doesn't Reallocate Every Frame - Passes Render Into The
+// Bottom Left Region (The Graph Sets The Viewport) and Sample it Through getUVScale()
+class RenderGraph {
+    public:
+        // Constructor - Textures Are Allocated sizeHeadroom Larger Than Requested and Reused Until A Target Shrinks Past Twice The Headroom
+        // Pooled Textures Unused For maxUnusedFrames Frames Are Freed
+        RenderGraph(const unsigned int &maxUnusedFrames, const float &sizeHeadroom);
+
+        // Build A Frame - Reset, Declare Resources and Passes, Compile Then Execute
+        // Reset Drops Last Frame's Passes and Resources but Keeps Pooled Textures and Framebuffer Objects (Except Ones Left Unused For Too Long)
+        void reset(void);
+
+        // Declare A Transient Render Target (Only Backed by A Texture While Passes Use it)
+        // A Render Scale Below 1 Keeps The Full Size Texture but Only Renders A Scaled Region of it (Dynamic Resolution Without Reallocating)
+        // Resource and Pass Names Are Kept Rather Than Copied (The Profilers Hold on to Pass Names) - Use String Literals
+        RenderGraphResource createRenderTarget(const char *name, const RenderTargetDescStruct &desc, const float &renderScale = 1.0f);
+
+        // Import An Externally Owned Render Target / The Backbuffer (Passes Writing The Backbuffer Are Never Culled)
+        // The Backbuffer is The Default Framebuffer Unless A Headless Context Stands in For it With An Offscreen Framebuffer
+        RenderGraphResource importRenderTarget(const char *name, const GLuint &texture, const GLuint &framebuffer, const unsigned int &width, const unsigned int &height);
+        RenderGraphResource importBackbuffer(const unsigned int &width, const unsigned int &height, const GLuint &framebuffer = 0);
+
+        // Add A Pass - The Graph Binds A Framebuffer With The Written Targets Attached (And Sets The Viewport) Before Calling execute(graph)
+        // Passes With Side Effects (e.g. Rendering Shadow Maps Owned Elsewhere) Are Never Culled
+        // execute is Copied Into Storage The Graph Reuses Every Frame Instead of A std::function (Which Allocates For Lambdas Capturing More Than Two Pointers),
+        // so it Must Be Trivially Copyable - Capture by Reference or Capture Plain Values Like Resource Handles
+        template<typename Execute>
+        void addPass(const char *name, std::initializer_list<RenderGraphResource> reads, std::initializer_list<RenderGraphResource> writes, const Execute &execute, const bool &hasSideEffects = false) {
+            static_assert(std::is_trivially_copyable_v<Execute> && alignof(Execute) <= alignof(std::max_align_t), "Render Graph Pass Callbacks Must Be Trivially Copyable");
+            const std::size_t callbackIndex{this->callbackStorage.size()};
+            this->callbackStorage.resize(callbackIndex + (sizeof(Execute) + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+            new(&this->callbackStorage[callbackIndex]) Execute(execute);
+            this->recordPass(name, reads, writes, [](void *callback, RenderGraph &graph) {(*(Execute*)callback)(graph);}, callbackIndex, hasSideEffects);
+        }
+
+        // Cull Unused Passes and Calculate Transient Target Lifetimes
+        void compile(void);
+
+        // Execute Every Pass That Wasn't Culled
+        void execute(void);
+
+        // Time Every Executed Pass as A GPU Profiler Scope Named After The Pass (nullptr Disables)
+        void setProfiler(GPUProfiler *profiler) {this->profiler = profiler;}
+
+        // Resource Access (During Pass Execution)
+        GLuint getTexture(const RenderGraphResource &resource) {return this->resources[resource].texture;}
+        GLuint getFramebuffer(const RenderGraphResource &resource) {return this->resources[resource].framebuffer;}
+        const RenderTargetDescStruct &getDesc(const RenderGraphResource &resource) {return this->resources[resource].desc;}
+
+        // Size of The Region Passes Render Into (The Graph Sets The Viewport to This)
+        unsigned int getRenderWidth(const RenderGraphResource &resource) {return this->resources[resource].renderWidth;}
+        unsigned int getRenderHeight(const RenderGraphResource &resource) {return this->resources[resource].renderHeight;}
+
+        // Fraction of A Resource's Texture Covered by The Rendered Region (Texture Coordinates Must Be Scaled by This When Sampling it)
+        glm::vec2 getUVScale(const RenderGraphResource &resource) {
+            const ResourceStruct &target = this->resources[resource];
+            return glm::vec2((float)target.renderWidth / target.textureWidth, (float)target.renderHeight / target.textureHeight);
+        }
+
+        // Size of A Region Rendered at A Render Scale (Matches The Viewport Passes Get)
+        static unsigned int scaleRenderSize(const unsigned int &size, const float &renderScale);
+
+        // Getters (Statistics of The Last Compile / Execute)
+        unsigned int getPassCount(void) {return this->passes.size();}
+        unsigned int getCulledPassCount(void) {return this->culledPassCount;}
+        unsigned int getTransientTargetCount(void) {return this->transientTargetCount;}
+        unsigned int getPooledTextureCount(void) {return this->texturePool.size();}
+        unsigned int getAllocatedTextureCount(void) {return this->allocatedTextureCount;}
+        std::uint64_t getPooledTextureBytes(void);
+
+        // Destroy Pooled Textures and Framebuffer Objects
+        void destroy(void);
+    private:
+        // Resource Kinds
+        enum ResourceKind : unsigned int {
+            RESOURCE_TRANSIENT = 0,
+            RESOURCE_IMPORTED,
+            RESOURCE_BACKBUFFER,
+        };
+
+        // Resource
+        struct ResourceStruct {
+            // Name, Kind, Description and Rendered Region Size
+            const char *name{""};
+            ResourceKind kind{RESOURCE_TRANSIENT};
+            RenderTargetDescStruct desc;
+            unsigned int renderWidth{0}, renderHeight{0};
+
+            // Texture Backing The Resource (And Its Size) and The Framebuffer Object it Was Last Written Through (And Its Attachment Point)
+            GLuint texture{0}, framebuffer{0};
+            unsigned int textureWidth{0}, textureHeight{0};
+            GLenum attachment{GL_NONE};
+
+            // Pass That Writes it, Number of Passes Reading it and First and Last Pass Using it
+            int producer{-1};
+            unsigned int refCount{0};
+            int firstUse{-1}, lastUse{-1};
+        };
+        std::vector<ResourceStruct> resources;
+
+        // Pass
+        struct PassStruct {
+            // Name, Resources (Ranges of passResources) and Execute Callback (Calls The Callable Stored at callbackStorage[callbackIndex])
+            const char *name{""};
+            unsigned int firstRead{0}, readCount{0}, firstWrite{0}, writeCount{0};
+            void (*execute)(void *callback, RenderGraph &graph){nullptr};
+            std::size_t callbackIndex{0};
+
+            // Culling State
+            bool hasSideEffects{false}, culled{false};
+            unsigned int refCount{0};
+        };
+        std::vector<PassStruct> passes;
+
+        // Every Pass's Read and Written Resources and Execute Callables - Cleared by reset() but Keeping Their Capacity so Building A Frame Doesn't Allocate
+        std::vector<RenderGraphResource> passResources;
+        std::vector<std::max_align_t> callbackStorage;
+
+        // Scratch Lists Reused by compile() and getPassFramebuffer()
+        std::vector<RenderGraphResource> unreferencedResources;
+        std::vector<GLuint> attachedTextures;
+        std::vector<GLenum> drawBuffers;
+
+        // Texture Pool - Transient Targets Borrow Free Textures With A Matching Format That Are Large Enough (But Not Too Large)
+        struct PooledTextureStruct {
+            RenderTargetDescStruct desc;
+            GLuint texture{0};
+            bool inUse{false};
+            unsigned int lastUsedFrame{0};
+        };
+        std::vector<PooledTextureStruct> texturePool;
+
+        // Pool Settings and Current Frame
+        unsigned int maxUnusedFrames, frameIndex{0};
+        float sizeHeadroom;
+
+        // GPU Profiler Timing Passes
+        GPUProfiler *profiler{nullptr};
+
+        // Framebuffer Object Cache (Keyed by Attached Textures)
+        std::map<std::vector<GLuint>, GLuint> framebufferCache;
+
+        // Statistics
+        unsigned int culledPassCount{0}, transientTargetCount{0}, allocatedTextureCount{0};
+
+        // Add A Pass Whose Callback Was Stored in callbackStorage
+        void recordPass(const char *name, std::initializer_list<RenderGraphResource> reads, std::initializer_list<RenderGraphResource> writes, void (*execute)(void*, RenderGraph&), const std::size_t &callbackIndex, const bool &hasSideEffects);
+
+        // Resources A Pass Reads / Writes
+        std::span<const RenderGraphResource> getReads(const PassStruct &pass) {return {this->passResources.data() + pass.firstRead, pass.readCount};}
+        std::span<const RenderGraphResource> getWrites(const PassStruct &pass) {return {this->passResources.data() + pass.firstWrite, pass.writeCount};}
+
+        // Borrow A Pooled Texture For A Resource / Return it to The Pool
+        void acquireTexture(ResourceStruct &target);
+        void releaseTexture(const GLuint &texture);
+
+        // Free Pooled Textures Unused For Too Long (And Framebuffer Objects They Are Attached to)
+        void evictUnusedTextures(void);
+
+        // Get (or Create) The Framebuffer Object With A Pass's Written Targets Attached
+        GLuint getPassFramebuffer(const PassStruct &pass);
+
+        // Check if An Internal Format is A Depth (Stencil) Format
+        static bool isDepthFormat(const GLenum &internalFormat);
+        static bool isDepthStencilFormat(const GLenum &internalFormat);
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+// Standard Headers
+#include<mutex>
+#include<deque>
+#include<chrono>
+#include<string>
+#include<thread>
+#include<cstdint>
+#include<functional>
+#include<condition_variable>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// Upload Thread Statistics
+struct UploadThreadStatsStruct {
+    unsigned int queuedTaskCount{0}, inFlightTaskCount{0};
+    std::uint64_t completedTaskCount{0};
+    float lastUploadMs{0.0f}, maxUploadMs{0.0f}, lastLatencyMs{0.0f}, maxLatencyMs{0.0f};
+};
+
+// Upload Thread Class - Creates and Fills Buffers and Textures on A Second OpenGL Context Sharing Objects With The Render Context
+// Every Task's upload() Runs on The Upload Thread and is Followed by A Fence, Its onComplete() Runs on The Render Thread (in update()) Once The Fence Has Signalled
+// so The Render Thread Never Waits on An Upload and Never Touches An Object Before The GPU Has Finished Filling it
+// Vertex Array and Framebuffer Objects Aren't Shared Between Contexts - Create Those in onComplete()
+class UploadThread {
+    public:
+        // Constructor - Start The Thread, Which Makes The Shared Context Current With makeContextCurrent and Releases it With releaseContext When Destroyed
+        // Without A Current Context Tasks Upload on The Thread Calling submit() Instead (Still Fenced)
+        UploadThread(const std::function<bool(void)> &makeContextCurrent, const std::function<void(void)> &releaseContext);
+
+        // Queue An Upload (name Must Outlive The Capture)
+        void submit(const std::function<void(void)> &upload, const std::function<void(void)> &onComplete, const char *name = "Upload");
+
+        // Run onComplete() of Every Upload The GPU Has Finished (Render Thread, Never Blocks - update(), finish() and destroy() Must All Be Called From One Thread at A Time)
+        void update(void);
+
+        // Wait Until Every Queued Upload Has Finished and Run Their onComplete() (Loading Screens, Benchmarks and Shutdown)
+        void finish(void);
+
+        // Getters
+        bool hasContext(void) {return this->contextCurrent;}
+        UploadThreadStatsStruct getStats(void);
+        std::string getStatsReport(void);
+
+        // Destroy (Finishes Every Queued Upload First, Call on A Thread With The Render Context Current)
+        void destroy(void);
+    private:
+        // Queued Upload
+        struct TaskStruct {
+            std::function<void(void)> upload, onComplete;
+            const char *name;
+            std::chrono::steady_clock::time_point submitTime;
+        };
+
+        // Uploaded Task Waiting For Its Fence
+        struct FencedTaskStruct {
+            std::function<void(void)> onComplete;
+            GLsync fence;
+            std::chrono::steady_clock::time_point submitTime;
+        };
+
+        // Thread and Queues
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable taskCondition, idleCondition;
+        std::deque<TaskStruct> tasks;
+        std::deque<FencedTaskStruct> fencedTasks;
+        bool running{true}, busy{false}, contextCurrent{false};
+
+        // Statistics
+        std::uint64_t completedTaskCount{0};
+        float lastUploadMs{0.0f}, maxUploadMs{0.0f}, lastLatencyMs{0.0f}, maxLatencyMs{0.0f};
+
+        // Upload A Task Then Fence it (Upload Thread, or The Submitting Thread Without A Shared Context)
+        void upload(TaskStruct &task);
+
+        // Run A Fenced Task's onComplete() if its Fence Has Signalled (Waiting Up to timeout)
+        bool complete(const GLuint64 &timeout);
+};
@@ -0,0 +1,71 @@
+#include"DeferredRenderer.hpp"
+
+// Constructor - Create Shaders
+DeferredRenderer::DeferredRenderer(const std::string &shaderDirectoryPath)
+    : geometryShaders(shaderDirectoryPath + "gBufferShaders/vertexShader.glsl", shaderDirectoryPath + "gBufferShaders/fragmentShader.glsl", "", SHADER_KEYWORD_HAS_SPECULAR_MAP),
+      lightingShaders(shaderDirectoryPath + "deferredLightingShaders/vertexShader.glsl", shaderDirectoryPath + "deferredLightingShaders/fragmentShader.glsl", "", SHADER_KEYWORD_LIGHT_CLUSTERED | SHADER_KEYWORD_LIGHT_DIRECTIONAL | SHADER_KEYWORD_SHADOWS_CASCADED | SHADER_KEYWORD_SHADOWS_ATLAS) {
+    // Empty Vertex Array Object
+    glGenVertexArrays(1, &this->emptyVAO);
+}
+
+// Clear The Bound G-Buffer
+void DeferredRenderer::beginGeometryPass(void) {
+    glEnable(GL_DEPTH_TEST);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+// Light Every G-Buffer Pixel Using The Clustered Light Lists
+void DeferredRenderer::renderLightingPass(const GBufferStruct &gBuffer, const GLuint &outputFramebuffer, ClusteredLighting &clusteredLighting, const glm::mat4 &projectionViewMatrix, const glm::vec3 &viewPos, const unsigned int &keywords, const std::function<void(Shader&)> &setUniforms) {
+    // Clear Output Framebuffer (Lighting Needs No Depth Testing)
+    glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+    glDisable(GL_DEPTH_TEST);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Bind G-Buffer Textures
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, gBuffer.albedoSpecular);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, gBuffer.normalShininess);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, gBuffer.depth);
+    glActiveTexture(GL_TEXTURE0);
+
+    // Lighting Shaders Read The G-Buffer From Texture Units 0 to 2
+    Shader &lightingShader = this->lightingShaders.get(SHADER_KEYWORD_LIGHT_CLUSTERED | keywords);
+    lightingShader.use();
+    lightingShader.setInt("gAlbedoSpecular", 0);
+    lightingShader.setInt("gNormalShininess", 1);
+    lightingShader.setInt("gDepth", 2);
+    lightingShader.setVec2("gBufferUVScale", gBuffer.uvScale);
+
+    // Send Camera Properties, Clustered Light Lists and Extra Light Casters to Lighting Shaders
+    lightingShader.setMat4("inversePV", glm::inverse(projectionViewMatrix));
+    lightingShader.setVec3("viewPos", viewPos);
+    clusteredLighting.setUniforms(lightingShader);
+    setUniforms(lightingShader);
+
+    // Render Fullscreen Triangle
+    glBindVertexArray(this->emptyVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    DrawStats::recordDraw(1);
+    glBindVertexArray(0);
+
+    // Copy G-Buffer Depth Into Output Framebuffer so Forward Passes Depth Test Against The Scene
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer.framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFramebuffer);
+    glBlitFramebuffer(0, 0, gBuffer.width, gBuffer.height, 0, 0, gBuffer.width, gBuffer.height, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT, GL_NEAREST);
+
+    // Leave Output Framebuffer Bound With Depth Testing Enabled
+    glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+    glEnable(GL_DEPTH_TEST);
+}
+
+// Destroy
+void DeferredRenderer::destroy(void) {
+    // Delete Shaders
+    this->geometryShaders.destroy();
+    this->lightingShaders.destroy();
+
+    // Delete Empty Vertex Array Object
+    glDeleteVertexArrays(1, &this->emptyVAO);
+}
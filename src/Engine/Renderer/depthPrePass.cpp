@@ -0,0 +1,98 @@
+#include"DepthPrePass.hpp"
+
+// Constructor - Create Depth Only Shaders and Occlusion Queries
+DepthPrePass::DepthPrePass(const DepthPrePassMode &mode, const float &enableOverdraw, const float &disableOverdraw, const unsigned int &probeInterval, const std::string &shaderDirectoryPath)
+    : depthShaders(shaderDirectoryPath + "depthPrePassShaders/vertexShader.glsl", shaderDirectoryPath + "depthPrePassShaders/fragmentShader.glsl") {
+    // Set Pre-Pass Settings
+    this->mode = mode;
+    this->enableOverdraw = enableOverdraw;
+    this->disableOverdraw = disableOverdraw;
+    this->probeInterval = probeInterval;
+
+    // Create Occlusion Queries
+    glGenQueries(2, this->depthQueries);
+    glGenQueries(2, this->colorQueries);
+}
+
+// Decide Whether This Frame Uses The Pre-Pass (Overdraw Measured in Earlier Frames is Read Without Waiting on The GPU)
+bool DepthPrePass::beginFrame(void) {
+    // Read Overdraw Measured Two Frames Ago (Once The GPU Has Finished it)
+    this->queryIndex = this->frameIndex++ % 2;
+    if(this->queryPending[this->queryIndex]) {
+        GLint resultAvailable{0};
+        glGetQueryObjectiv(this->colorQueries[this->queryIndex], GL_QUERY_RESULT_AVAILABLE, &resultAvailable);
+        if(resultAvailable) {
+            // Every Sample Passing The Depth Pass Would Have Been Shaded Without The Pre-Pass, The Color Pass Only Shades Visible Ones
+            GLuint64 depthSamples{0}, colorSamples{0};
+            glGetQueryObjectui64v(this->depthQueries[this->queryIndex], GL_QUERY_RESULT, &depthSamples);
+            glGetQueryObjectui64v(this->colorQueries[this->queryIndex], GL_QUERY_RESULT, &colorSamples);
+            this->queryPending[this->queryIndex] = false;
+            if(colorSamples > 0) this->overdraw = (float)((double)depthSamples / (double)colorSamples);
+
+            // Hysteresis Keeps The Pre-Pass From Flickering on and Off Around One Threshold
+            if(this->overdraw > this->enableOverdraw) this->autoEnabled = true;
+            else if(this->overdraw < this->disableOverdraw) this->autoEnabled = false;
+        }
+    }
+
+    // Pick This Frame's State
+    switch(this->mode) {
+        case DEPTH_PRE_PASS_ON:
+            this->enabled = true;
+            break;
+        case DEPTH_PRE_PASS_AUTO:
+            // Periodically Probe While Off so A Scene Getting More Overdraw Turns The Pre-Pass Back on
+            this->enabled = this->autoEnabled || ++this->framesSinceProbe >= this->probeInterval;
+            if(this->enabled) this->framesSinceProbe = 0;
+            break;
+        default:
+            this->enabled = false;
+            break;
+    }
+
+    // Only Measure When This Frame's Queries Are Free
+    this->measuring = this->enabled && !this->queryPending[this->queryIndex];
+    return this->enabled;
+}
+
+// Depth Only Pass
+void DepthPrePass::beginDepthPass(void) {
+    // Depth Writes Only
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glDepthMask(GL_TRUE);
+    glDepthFunc(GL_LESS);
+    if(this->measuring) glBeginQuery(GL_SAMPLES_PASSED, this->depthQueries[this->queryIndex]);
+    this->depthShaders.use();
+}
+void DepthPrePass::endDepthPass(void) {
+    if(this->measuring) glEndQuery(GL_SAMPLES_PASSED);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+// Color Pass
+void DepthPrePass::beginColorPass(void) {
+    if(!this->enabled) return;
+
+    // Only Fragments Matching The Pre-Pass Depth Are Shaded, Depth is Already Written
+    glDepthFunc(GL_EQUAL);
+    glDepthMask(GL_FALSE);
+    if(this->measuring) glBeginQuery(GL_SAMPLES_PASSED, this->colorQueries[this->queryIndex]);
+}
+void DepthPrePass::endColorPass(void) {
+    if(!this->enabled) return;
+    if(this->measuring) {
+        glEndQuery(GL_SAMPLES_PASSED);
+        this->queryPending[this->queryIndex] = true;
+    }
+
+    // Restore Default Depth State
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+}
+
+// Destroy
+void DepthPrePass::destroy(void) {
+    this->depthShaders.destroy();
+    glDeleteQueries(2, this->depthQueries);
+    glDeleteQueries(2, this->colorQueries);
+}
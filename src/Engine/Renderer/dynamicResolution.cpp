@@ -0,0 +1,79 @@
+#include"DynamicResolution.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<algorithm>
+
+// Constructor - Create Timestamp Queries
+DynamicResolution::DynamicResolution(const float &targetFrameTimeMs, const float &minScale, const float &maxScale) {
+    // Set Controller Settings
+    this->targetFrameTimeMs = targetFrameTimeMs;
+    this->minScale = minScale;
+    this->maxScale = maxScale;
+    this->scale = maxScale;
+
+    // Create Timestamp Queries
+    glGenQueries(queryFrameCount, this->startQueries);
+    glGenQueries(queryFrameCount, this->endQueries);
+}
+
+// Begin A Frame's GPU Work
+void DynamicResolution::beginFrame(void) {
+    // Read Every Finished Frame's GPU Time and Update The Scale
+    this->updateScale();
+
+    // Timestamp The Start of This Frame (Skipped While The Slot's Previous Queries Are Still Pending)
+    const unsigned int queryIndex{this->frameIndex % queryFrameCount};
+    if(this->queryPending[queryIndex]) return;
+    glQueryCounter(this->startQueries[queryIndex], GL_TIMESTAMP);
+    this->queryScales[queryIndex] = this->scale;
+}
+
+// End A Frame's GPU Work
+void DynamicResolution::endFrame(void) {
+    const unsigned int queryIndex{this->frameIndex++ % queryFrameCount};
+    if(this->queryPending[queryIndex]) return;
+    glQueryCounter(this->endQueries[queryIndex], GL_TIMESTAMP);
+    this->queryPending[queryIndex] = true;
+}
+
+// Move The Scale Towards One Rendering A Frame in The Target Time
+void DynamicResolution::updateScale(void) {
+    // Latest Finished Measurement (Queries Finish in Order so The Newest Available One Wins)
+    float measuredFrameTimeMs{-1.0f}, measuredScale{this->scale};
+    for(unsigned int i = 0; i < queryFrameCount; i++) {
+        const unsigned int queryIndex{(this->frameIndex + i) % queryFrameCount};
+        if(!this->queryPending[queryIndex]) continue;
+        GLint resultAvailable{0};
+        glGetQueryObjectiv(this->endQueries[queryIndex], GL_QUERY_RESULT_AVAILABLE, &resultAvailable);
+        if(!resultAvailable) continue;
+
+        // GPU Time Between The Frame's Timestamps
+        GLuint64 startTime{0}, endTime{0};
+        glGetQueryObjectui64v(this->startQueries[queryIndex], GL_QUERY_RESULT, &startTime);
+        glGetQueryObjectui64v(this->endQueries[queryIndex], GL_QUERY_RESULT, &endTime);
+        this->queryPending[queryIndex] = false;
+        if(endTime > startTime) {
+            measuredFrameTimeMs = (float)((double)(endTime - startTime) / 1000000.0);
+            measuredScale = this->queryScales[queryIndex];
+        }
+    }
+    if(measuredFrameTimeMs <= 0.0f) return;
+    this->gpuFrameTimeMs = measuredFrameTimeMs;
+    if(!this->enabled) return;
+
+    // Frame Cost Grows With Pixel Count (Scale Squared) so The Scale That Would Hit The Target Goes With The Square Root of The Ratio
+    // (Relative to The Scale The Measured Frame Was Rendered at, Which Can Be A Few Frames Old)
+    const float idealScale{std::clamp(measuredScale * std::sqrt(this->targetFrameTimeMs / measuredFrameTimeMs), this->minScale, this->maxScale)};
+
+    // Drop Straight to The Ideal Scale When Over Budget so Load Spikes Don't Drop Frames, Recover Gradually to Avoid Oscillating
+    // Small Differences Are Ignored so The Scale (And The Image) Stays Steady Under A Steady Load
+    if(idealScale < this->scale) this->scale = idealScale;
+    else if(idealScale > this->scale * 1.05f || idealScale == this->maxScale) this->scale = std::min(this->scale + (idealScale - this->scale) * 0.1f, this->maxScale);
+}
+
+// Destroy
+void DynamicResolution::destroy(void) {
+    glDeleteQueries(queryFrameCount, this->startQueries);
+    glDeleteQueries(queryFrameCount, this->endQueries);
+}
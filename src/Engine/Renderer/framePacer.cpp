@@ -0,0 +1,140 @@
+#include"FramePacer.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<thread>
+#include<sstream>
+#include<algorithm>
+
+// Time Between Two Time Points in Milliseconds
+static float elapsedMs(const std::chrono::steady_clock::time_point &startTime, const std::chrono::steady_clock::time_point &endTime) {
+    return std::chrono::duration<float, std::milli>(endTime - startTime).count();
+}
+
+// Constructor
+FramePacer::FramePacer(const unsigned int &queuedFrameCount, const float &frameRateLimit, const float &spinTimeMs, const unsigned int &statsWindow) {
+    this->setQueuedFrameCount(queuedFrameCount);
+    this->frameRateLimit = frameRateLimit;
+    this->spinTimeMs = spinTimeMs;
+    this->statsWindow = std::max(statsWindow, 1u);
+    this->frameTimings.resize(this->statsWindow);
+    this->nextFrameDeadline = std::chrono::steady_clock::now();
+}
+
+// Set Frames Allowed in Flight
+void FramePacer::setQueuedFrameCount(const unsigned int &queuedFrameCount) {
+    this->queuedFrameCount = std::clamp(queuedFrameCount, 1u, maxQueuedFrameCount);
+}
+
+// Present A Frame Then Fence it
+void FramePacer::present(const std::function<void(void)> &swapBuffers) {
+    // Time The Swap (Blocking Here Means The Driver's Own Queue is Full)
+    const std::chrono::steady_clock::time_point presentStartTime{std::chrono::steady_clock::now()};
+    swapBuffers();
+    const std::chrono::steady_clock::time_point presentEndTime{std::chrono::steady_clock::now()};
+    this->currentTiming.presentMs = elapsedMs(presentStartTime, presentEndTime);
+
+    // Fence The Frame (The Slot's Previous Fence Belongs to A Frame Old Enough to Have Finished)
+    const unsigned int slot{(unsigned int)(this->presentCount % maxQueuedFrameCount)};
+    if(this->fences[slot] != nullptr) glDeleteSync(this->fences[slot]);
+    this->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    this->fenceFrames[slot] = this->presentCount++;
+
+    // Present Interval
+    if(this->hasLastPresentTime) this->currentTiming.frameIntervalMs = elapsedMs(this->lastPresentTime, presentEndTime);
+    this->lastPresentTime = presentEndTime;
+    this->hasLastPresentTime = true;
+}
+
+// Wait Until A New Frame May Start
+void FramePacer::waitForNextFrame(void) {
+    // Wait Until No More Than queuedFrameCount Presented Frames Are Unfinished
+    const std::chrono::steady_clock::time_point fenceWaitStartTime{std::chrono::steady_clock::now()};
+    if(this->presentCount >= this->queuedFrameCount) {
+        const unsigned long long waitFrame{this->presentCount - this->queuedFrameCount};
+        const unsigned int slot{(unsigned int)(waitFrame % maxQueuedFrameCount)};
+        if(this->fences[slot] != nullptr && this->fenceFrames[slot] == waitFrame) this->waitForFence(slot);
+    }
+    const std::chrono::steady_clock::time_point fenceWaitEndTime{std::chrono::steady_clock::now()};
+    this->currentTiming.fenceWaitMs = elapsedMs(fenceWaitStartTime, fenceWaitEndTime);
+
+    // Frame Rate Limit - Sleep Until Shortly Before The Deadline Then Spin The Rest (Sleeps Can Overshoot by A Millisecond or More)
+    this->currentTiming.limiterWaitMs = 0.0f;
+    if(this->frameRateLimit > 0.0f) {
+        const std::chrono::steady_clock::duration frameTime{std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / this->frameRateLimit))};
+        this->nextFrameDeadline += frameTime;
+
+        // Running More Than A Frame Late - Restart The Schedule Instead of Rushing Frames to Catch Up
+        if(fenceWaitEndTime > this->nextFrameDeadline + frameTime) this->nextFrameDeadline = fenceWaitEndTime;
+        const std::chrono::steady_clock::time_point sleepEndTime{this->nextFrameDeadline - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float, std::milli>(this->spinTimeMs))};
+        if(std::chrono::steady_clock::now() < sleepEndTime) std::this_thread::sleep_until(sleepEndTime);
+        while(std::chrono::steady_clock::now() < this->nextFrameDeadline) std::this_thread::yield();
+        this->currentTiming.limiterWaitMs = elapsedMs(fenceWaitEndTime, std::chrono::steady_clock::now());
+    }
+
+    // Record This Frame's Timings
+    this->frameTimings[this->nextFrameTiming] = this->currentTiming;
+    this->nextFrameTiming = (this->nextFrameTiming + 1) % this->statsWindow;
+    this->frameTimingCount = std::min(this->frameTimingCount + 1, this->statsWindow);
+    this->currentTiming = FrameTimingStruct{};
+}
+
+// Wait For A Frame's Fence and Delete it
+void FramePacer::waitForFence(const unsigned int &slot) {
+    // Flush so The Fence Reaches The GPU, Then Wait in One Second Chunks (A Lost Device Would Otherwise Hang Forever Silently)
+    GLenum waitResult{glClientWaitSync(this->fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000)};
+    while(waitResult == GL_TIMEOUT_EXPIRED) waitResult = glClientWaitSync(this->fences[slot], 0, 1000000000);
+    glDeleteSync(this->fences[slot]);
+    this->fences[slot] = nullptr;
+}
+
+// Statistics Over The Last Frames
+FramePacingStatsStruct FramePacer::getStats(void) {
+    FramePacingStatsStruct stats;
+    if(this->frameTimingCount == 0) return stats;
+    // The First frameTimingCount Slots Are The Recorded Ones (Every Slot Once The Ring Has Wrapped)
+    stats.minFrameIntervalMs = this->frameTimings[0].frameIntervalMs;
+    for(unsigned int i = 0; i < this->frameTimingCount; i++) {
+        const FrameTimingStruct &timing = this->frameTimings[i];
+        stats.averageFrameIntervalMs += timing.frameIntervalMs;
+        stats.minFrameIntervalMs = std::min(stats.minFrameIntervalMs, timing.frameIntervalMs);
+        stats.maxFrameIntervalMs = std::max(stats.maxFrameIntervalMs, timing.frameIntervalMs);
+        stats.averagePresentMs += timing.presentMs;
+        stats.maxPresentMs = std::max(stats.maxPresentMs, timing.presentMs);
+        stats.averageFenceWaitMs += timing.fenceWaitMs;
+        stats.maxFenceWaitMs = std::max(stats.maxFenceWaitMs, timing.fenceWaitMs);
+        stats.averageLimiterWaitMs += timing.limiterWaitMs;
+    }
+    const float frameCount{(float)this->frameTimingCount};
+    stats.averageFrameIntervalMs /= frameCount;
+    stats.averagePresentMs /= frameCount;
+    stats.averageFenceWaitMs /= frameCount;
+    stats.averageLimiterWaitMs /= frameCount;
+
+    // Jitter is The Standard Deviation of The Present Interval
+    for(unsigned int i = 0; i < this->frameTimingCount; i++) {
+        const float deviationMs{this->frameTimings[i].frameIntervalMs - stats.averageFrameIntervalMs};
+        stats.frameIntervalJitterMs += deviationMs * deviationMs;
+    }
+    stats.frameIntervalJitterMs = std::sqrt(stats.frameIntervalJitterMs / frameCount);
+    return stats;
+}
+
+// Statistics as Text
+std::string FramePacer::getStatsReport(void) {
+    const FramePacingStatsStruct stats{this->getStats()};
+    std::ostringstream report;
+    report.precision(3);
+    report << std::fixed << "Frame Interval " << stats.averageFrameIntervalMs << "ms (" << stats.minFrameIntervalMs << " Min, " << stats.maxFrameIntervalMs << " Max, " << stats.frameIntervalJitterMs << " Jitter), "
+           << "Present " << stats.averagePresentMs << "ms (" << stats.maxPresentMs << " Max), Fence Wait " << stats.averageFenceWaitMs << "ms (" << stats.maxFenceWaitMs << " Max), "
+           << "Limiter Wait " << stats.averageLimiterWaitMs << "ms, " << this->queuedFrameCount << " Queued Frames";
+    return report.str();
+}
+
+// Destroy
+void FramePacer::destroy(void) {
+    for(GLsync &fence : this->fences) {
+        if(fence != nullptr) glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
@@ -0,0 +1,366 @@
+#include"RenderGraph.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<iostream>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
+
+// Constructor
+RenderGraph::RenderGraph(const unsigned int &maxUnusedFrames, const float &sizeHeadroom) {
+    this->maxUnusedFrames = maxUnusedFrames;
+    this->sizeHeadroom = sizeHeadroom;
+}
+
+// Reset Drops Last Frame's Passes and Resources but Keeps Pooled Textures and Framebuffer Objects (Except Ones Left Unused For Too Long)
+void RenderGraph::reset(void) {
+    this->passes.clear();
+    this->passResources.clear();
+    this->callbackStorage.clear();
+    this->resources.clear();
+    for(PooledTextureStruct &pooledTexture : this->texturePool) pooledTexture.inUse = false;
+    this->frameIndex++;
+    this->evictUnusedTextures();
+}
+
+// Declare A Transient Render Target (Only Backed by A Texture While Passes Use it)
+RenderGraphResource RenderGraph::createRenderTarget(const char *name, const RenderTargetDescStruct &desc, const float &renderScale) {
+    ResourceStruct resource;
+    resource.name = name;
+    resource.kind = RESOURCE_TRANSIENT;
+    resource.desc = desc;
+    resource.renderWidth = scaleRenderSize(desc.width, renderScale);
+    resource.renderHeight = scaleRenderSize(desc.height, renderScale);
+    this->resources.push_back(resource);
+    return this->resources.size() - 1;
+}
+
+// Import An Externally Owned Render Target
+RenderGraphResource RenderGraph::importRenderTarget(const char *name, const GLuint &texture, const GLuint &framebuffer, const unsigned int &width, const unsigned int &height) {
+    ResourceStruct resource;
+    resource.name = name;
+    resource.kind = RESOURCE_IMPORTED;
+    resource.desc.width = width;
+    resource.desc.height = height;
+    resource.texture = texture;
+    resource.renderWidth = width;
+    resource.renderHeight = height;
+    resource.textureWidth = width;
+    resource.textureHeight = height;
+    resource.framebuffer = framebuffer;
+    this->resources.push_back(resource);
+    return this->resources.size() - 1;
+}
+
+// Import The Backbuffer (Passes Writing it Are Never Culled)
+RenderGraphResource RenderGraph::importBackbuffer(const unsigned int &width, const unsigned int &height, const GLuint &framebuffer) {
+    ResourceStruct resource;
+    resource.name = "Backbuffer";
+    resource.kind = RESOURCE_BACKBUFFER;
+    resource.desc.width = width;
+    resource.desc.height = height;
+    resource.renderWidth = width;
+    resource.renderHeight = height;
+    resource.textureWidth = width;
+    resource.textureHeight = height;
+    resource.framebuffer = framebuffer;
+    this->resources.push_back(resource);
+    return this->resources.size() - 1;
+}
+
+// Add A Pass Whose Callback Was Stored in callbackStorage
+void RenderGraph::recordPass(const char *name, std::initializer_list<RenderGraphResource> reads, std::initializer_list<RenderGraphResource> writes, void (*execute)(void*, RenderGraph&), const std::size_t &callbackIndex, const bool &hasSideEffects) {
+    PassStruct pass;
+    pass.name = name;
+    pass.firstRead = this->passResources.size();
+    pass.readCount = reads.size();
+    this->passResources.insert(this->passResources.end(), reads);
+    pass.firstWrite = this->passResources.size();
+    pass.writeCount = writes.size();
+    this->passResources.insert(this->passResources.end(), writes);
+    pass.execute = execute;
+    pass.callbackIndex = callbackIndex;
+    pass.hasSideEffects = hasSideEffects;
+    this->passes.push_back(pass);
+}
+
+// Cull Unused Passes and Calculate Transient Target Lifetimes
+void RenderGraph::compile(void) {
+    // Passes Are Referenced by The Resources They Write, Resources by The Passes Reading Them
+    for(unsigned int i = 0; i < this->passes.size(); i++) {
+        PassStruct &pass = this->passes[i];
+        pass.culled = false;
+        pass.refCount = pass.writeCount;
+        for(const RenderGraphResource &resource : this->getReads(pass)) this->resources[resource].refCount++;
+        for(const RenderGraphResource &resource : this->getWrites(pass)) {
+            this->resources[resource].producer = i;
+
+            // Writing Something Outside The Graph Keeps A Pass Alive
+            if(this->resources[resource].kind != RESOURCE_TRANSIENT) pass.hasSideEffects = true;
+        }
+    }
+
+    // Walk Back From Resources Nothing Reads - A Pass Whose Outputs Are All Unread is Culled, Which May Leave Its Inputs Unread in Turn
+    this->unreferencedResources.clear();
+    for(unsigned int i = 0; i < this->resources.size(); i++) {
+        if(this->resources[i].refCount == 0) this->unreferencedResources.push_back(i);
+    }
+    while(!this->unreferencedResources.empty()) {
+        const ResourceStruct &resource = this->resources[this->unreferencedResources.back()];
+        this->unreferencedResources.pop_back();
+        if(resource.producer < 0) continue;
+
+        PassStruct &producer = this->passes[resource.producer];
+        if(producer.hasSideEffects || producer.culled || --producer.refCount > 0) continue;
+        producer.culled = true;
+        for(const RenderGraphResource &read : this->getReads(producer)) {
+            if(--this->resources[read].refCount == 0) this->unreferencedResources.push_back(read);
+        }
+    }
+
+    // Transient Target Lifetimes Span Their First to Last Use by A Pass That Wasn't Culled
+    this->culledPassCount = 0;
+    for(unsigned int i = 0; i < this->passes.size(); i++) {
+        const PassStruct &pass = this->passes[i];
+        if(pass.culled) {
+            this->culledPassCount++;
+            continue;
+        }
+        for(const std::span<const RenderGraphResource> accesses : {this->getReads(pass), this->getWrites(pass)}) {
+            for(const RenderGraphResource &resource : accesses) {
+                ResourceStruct &target = this->resources[resource];
+                if(target.firstUse < 0) target.firstUse = i;
+                target.lastUse = std::max<int>(target.lastUse, i);
+            }
+        }
+    }
+}
+
+// Execute Every Pass That Wasn't Culled
+void RenderGraph::execute(void) {
+    this->transientTargetCount = 0;
+    for(unsigned int i = 0; i < this->passes.size(); i++) {
+        PassStruct &pass = this->passes[i];
+        if(pass.culled) continue;
+
+        // Borrow Textures For Transient Targets First Used Here (Textures Freed by Earlier Passes Get Reused)
+        for(const RenderGraphResource &resource : this->getWrites(pass)) {
+            ResourceStruct &target = this->resources[resource];
+            if(target.kind == RESOURCE_TRANSIENT && target.firstUse == (int)i) {
+                this->acquireTexture(target);
+                this->transientTargetCount++;
+            }
+        }
+
+        // Profile Pass on The CPU and GPU
+        CPU_PROFILE_SCOPE(pass.name);
+        if(this->profiler) this->profiler->beginScope(pass.name);
+
+        // Bind A Framebuffer With The Written Targets Attached
+        if(pass.writeCount > 0) {
+            const GLuint framebuffer{this->getPassFramebuffer(pass)};
+            for(const RenderGraphResource &resource : this->getWrites(pass)) this->resources[resource].framebuffer = framebuffer;
+            const ResourceStruct &target = this->resources[this->getWrites(pass)[0]];
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glViewport(0, 0, target.renderWidth, target.renderHeight);
+        }
+
+        // Execute Pass
+        pass.execute(&this->callbackStorage[pass.callbackIndex], *this);
+        if(this->profiler) this->profiler->endScope();
+
+        // Transient Targets Last Used Here Are Invalidated (Their Contents Never Need Storing) and Their Textures Returned to The Pool
+        for(const std::span<const RenderGraphResource> accesses : {this->getReads(pass), this->getWrites(pass)}) {
+            for(const RenderGraphResource &resource : accesses) {
+                ResourceStruct &target = this->resources[resource];
+                if(target.kind != RESOURCE_TRANSIENT || target.lastUse != (int)i || target.texture == 0) continue;
+                if(target.framebuffer != 0) glInvalidateNamedFramebufferData(target.framebuffer, 1, &target.attachment);
+                this->releaseTexture(target.texture);
+                target.lastUse = -1;
+            }
+        }
+    }
+
+    // Unbind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Size of A Region Rendered at A Render Scale
+unsigned int RenderGraph::scaleRenderSize(const unsigned int &size, const float &renderScale) {
+    return std::clamp((unsigned int)std::lround(size * renderScale), 1u, std::max(size, 1u));
+}
+
+// Total Size of Pooled Textures in Bytes
+std::uint64_t RenderGraph::getPooledTextureBytes(void) {
+    std::uint64_t bytes{0};
+    for(const PooledTextureStruct &pooledTexture : this->texturePool) {
+        bytes += GPUMemoryTracker::estimateTextureBytes(pooledTexture.desc.internalFormat, pooledTexture.desc.width, pooledTexture.desc.height, 1, 1, pooledTexture.desc.samples);
+    }
+    return bytes;
+}
+
+// Borrow A Pooled Texture (Creating One if No Free Texture Fits)
+void RenderGraph::acquireTexture(ResourceStruct &target) {
+    // Reuse The Smallest Free Texture With The Same Format That Fits - Textures Up to Twice The Headroom Larger Still Fit
+    // so A Window Being Dragged Smaller Keeps Using The Same Textures
+    const RenderTargetDescStruct &desc = target.desc;
+    const float maxOversize{(1.0f + this->sizeHeadroom) * (1.0f + this->sizeHeadroom)};
+    PooledTextureStruct *bestTexture{nullptr};
+    for(PooledTextureStruct &pooledTexture : this->texturePool) {
+        const RenderTargetDescStruct &pooledDesc = pooledTexture.desc;
+        if(pooledTexture.inUse || pooledDesc.internalFormat != desc.internalFormat || pooledDesc.samples != desc.samples) continue;
+        if(pooledDesc.width < desc.width || pooledDesc.height < desc.height) continue;
+        if(pooledDesc.width > desc.width * maxOversize || pooledDesc.height > desc.height * maxOversize) continue;
+        if(bestTexture == nullptr || pooledDesc.width * pooledDesc.height < bestTexture->desc.width * bestTexture->desc.height) bestTexture = &pooledTexture;
+    }
+
+    // Create An Immutable Texture With Headroom so A Window Being Dragged Larger Doesn't Reallocate Every Frame
+    if(bestTexture == nullptr) {
+        PooledTextureStruct pooledTexture;
+        pooledTexture.desc = desc;
+        pooledTexture.desc.width = (unsigned int)std::ceil(desc.width * (1.0f + this->sizeHeadroom));
+        pooledTexture.desc.height = (unsigned int)std::ceil(desc.height * (1.0f + this->sizeHeadroom));
+        glGenTextures(1, &pooledTexture.texture);
+        if(desc.samples > 0) {
+            glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, pooledTexture.texture);
+            glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, desc.samples, desc.internalFormat, pooledTexture.desc.width, pooledTexture.desc.height, GL_TRUE);
+            glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+        } else {
+            glBindTexture(GL_TEXTURE_2D, pooledTexture.texture);
+            glTexStorage2D(GL_TEXTURE_2D, 1, desc.internalFormat, pooledTexture.desc.width, pooledTexture.desc.height);
+
+            // Texture Parameters
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+        GPUMemoryTracker::trackTexture(pooledTexture.texture, GPU_MEMORY_RENDER_TARGET, desc.internalFormat, pooledTexture.desc.width, pooledTexture.desc.height, 1, 1, desc.samples, "Render Graph");
+        this->texturePool.push_back(pooledTexture);
+        this->allocatedTextureCount++;
+        bestTexture = &this->texturePool.back();
+    }
+
+    // Hand Texture to The Resource
+    bestTexture->inUse = true;
+    bestTexture->lastUsedFrame = this->frameIndex;
+    target.texture = bestTexture->texture;
+    target.textureWidth = bestTexture->desc.width;
+    target.textureHeight = bestTexture->desc.height;
+}
+
+// Return A Texture to The Pool
+void RenderGraph::releaseTexture(const GLuint &texture) {
+    for(PooledTextureStruct &pooledTexture : this->texturePool) {
+        if(pooledTexture.texture == texture) pooledTexture.inUse = false;
+    }
+}
+
+// Free Pooled Textures Unused For Too Long (And Framebuffer Objects They Are Attached to)
+void RenderGraph::evictUnusedTextures(void) {
+    for(unsigned int i = 0; i < this->texturePool.size();) {
+        const PooledTextureStruct &pooledTexture = this->texturePool[i];
+        if(this->frameIndex - pooledTexture.lastUsedFrame <= this->maxUnusedFrames) {
+            i++;
+            continue;
+        }
+
+        // Delete Framebuffer Objects The Texture is Attached to
+        for(auto cachedFramebuffer = this->framebufferCache.begin(); cachedFramebuffer != this->framebufferCache.end();) {
+            const std::vector<GLuint> &attachedTextures = cachedFramebuffer->first;
+            if(std::find(attachedTextures.begin(), attachedTextures.end(), pooledTexture.texture) == attachedTextures.end()) {
+                cachedFramebuffer++;
+                continue;
+            }
+            glDeleteFramebuffers(1, &cachedFramebuffer->second);
+            cachedFramebuffer = this->framebufferCache.erase(cachedFramebuffer);
+        }
+
+        // Delete Texture
+        GPUMemoryTracker::untrack(GL_TEXTURE, pooledTexture.texture);
+        glDeleteTextures(1, &pooledTexture.texture);
+        this->texturePool.erase(this->texturePool.begin() + i);
+    }
+}
+
+// Get (or Create) The Framebuffer Object With A Pass's Written Targets Attached
+GLuint RenderGraph::getPassFramebuffer(const PassStruct &pass) {
+    // Passes Writing The Default Framebuffer or One Imported Target Render Into It Directly
+    const std::span<const RenderGraphResource> writes{this->getWrites(pass)};
+    for(const RenderGraphResource &resource : writes) {
+        if(this->resources[resource].kind == RESOURCE_BACKBUFFER) return this->resources[resource].framebuffer;
+    }
+    if(writes.size() == 1 && this->resources[writes[0]].kind == RESOURCE_IMPORTED) return this->resources[writes[0]].framebuffer;
+
+    // Assign Attachment Points - Depth Formats Go to The Depth (Stencil) Attachment, Everything Else to Consecutive Color Attachments
+    // (Into Lists Kept Between Calls - Only A New Framebuffer Object Copies Them)
+    this->attachedTextures.clear();
+    this->drawBuffers.clear();
+    for(const RenderGraphResource &resource : writes) {
+        ResourceStruct &target = this->resources[resource];
+        if(isDepthFormat(target.desc.internalFormat)) {
+            target.attachment = isDepthStencilFormat(target.desc.internalFormat) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        } else {
+            target.attachment = GL_COLOR_ATTACHMENT0 + this->drawBuffers.size();
+            this->drawBuffers.push_back(target.attachment);
+        }
+        this->attachedTextures.push_back(target.texture);
+    }
+
+    // Reuse A Cached Framebuffer Object With The Same Textures Attached
+    const auto cachedFramebuffer = this->framebufferCache.find(this->attachedTextures);
+    if(cachedFramebuffer != this->framebufferCache.end()) return cachedFramebuffer->second;
+
+    // Create A New Framebuffer Object
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    for(const RenderGraphResource &resource : writes) {
+        const ResourceStruct &target = this->resources[resource];
+        glFramebufferTexture2D(GL_FRAMEBUFFER, target.attachment, target.desc.samples > 0 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D, target.texture, 0);
+    }
+    this->drawBuffers.empty() ? glDrawBuffer(GL_NONE) : glDrawBuffers(this->drawBuffers.size(), this->drawBuffers.data());
+
+    // Check if Framebuffer Object is Complete
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) std::cerr << "Render Graph Framebuffer For Pass \"" << pass.name << "\" is Not Complete!\n";
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    this->framebufferCache[this->attachedTextures] = framebuffer;
+    return framebuffer;
+}
+
+// Check if An Internal Format is A Depth (Stencil) Format
+bool RenderGraph::isDepthFormat(const GLenum &internalFormat) {
+    switch(internalFormat) {
+        case GL_DEPTH_COMPONENT16:
+        case GL_DEPTH_COMPONENT24:
+        case GL_DEPTH_COMPONENT32:
+        case GL_DEPTH_COMPONENT32F:
+        case GL_DEPTH24_STENCIL8:
+        case GL_DEPTH32F_STENCIL8:
+            return true;
+        default:
+            return false;
+    }
+}
+bool RenderGraph::isDepthStencilFormat(const GLenum &internalFormat) {
+    return internalFormat == GL_DEPTH24_STENCIL8 || internalFormat == GL_DEPTH32F_STENCIL8;
+}
+
+// Destroy Pooled Textures and Framebuffer Objects
+void RenderGraph::destroy(void) {
+    for(const PooledTextureStruct &pooledTexture : this->texturePool) {
+        GPUMemoryTracker::untrack(GL_TEXTURE, pooledTexture.texture);
+        glDeleteTextures(1, &pooledTexture.texture);
+    }
+    for(const auto &[attachedTextures, framebuffer] : this->framebufferCache) glDeleteFramebuffers(1, &framebuffer);
+    this->texturePool.clear();
+    this->framebufferCache.clear();
+    this->passes.clear();
+    this->passResources.clear();
+    this->callbackStorage.clear();
+    this->resources.clear();
+}
@@ -0,0 +1,167 @@
+#include"UploadThread.hpp"
+
+// Standard Headers
+#include<future>
+#include<sstream>
+#include<iomanip>
+#include<iostream>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+
+// Constructor - Start The Thread and Wait Until it Knows Whether it Has A Context
+UploadThread::UploadThread(const std::function<bool(void)> &makeContextCurrent, const std::function<void(void)> &releaseContext) {
+    std::promise<bool> contextPromise;
+    std::future<bool> contextFuture{contextPromise.get_future()};
+    this->thread = std::thread([this, makeContextCurrent, releaseContext, &contextPromise](void) {
+        CPU_PROFILE_THREAD_NAME("Upload Thread");
+        const bool contextCurrent{makeContextCurrent()};
+        contextPromise.set_value(contextCurrent);
+        if(!contextCurrent) return;
+
+        // Upload Tasks Until Destroyed (Queued Tasks Are Finished First)
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while(true) {
+            this->taskCondition.wait(lock, [this](void) {return !this->running || !this->tasks.empty();});
+            if(this->tasks.empty()) break;
+            TaskStruct task{std::move(this->tasks.front())};
+            this->tasks.pop_front();
+            this->busy = true;
+            lock.unlock();
+            this->upload(task);
+            lock.lock();
+            this->busy = false;
+            this->idleCondition.notify_all();
+        }
+        lock.unlock();
+        releaseContext();
+    });
+    this->contextCurrent = contextFuture.get();
+    if(!this->contextCurrent) std::cerr << "Upload Thread Has No Shared Context! Uploading on The Render Thread Instead.\n";
+}
+
+// Queue An Upload
+void UploadThread::submit(const std::function<void(void)> &upload, const std::function<void(void)> &onComplete, const char *name) {
+    TaskStruct task{upload, onComplete, name, std::chrono::steady_clock::now()};
+    if(!this->contextCurrent) {
+        this->upload(task);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->tasks.push_back(std::move(task));
+    }
+    this->taskCondition.notify_one();
+}
+
+// Upload A Task Then Fence it
+void UploadThread::upload(TaskStruct &task) {
+    CPU_PROFILE_SCOPE(task.name);
+    const std::chrono::steady_clock::time_point startTime{std::chrono::steady_clock::now()};
+    task.upload();
+
+    // Fence The Upload and Flush so The Fence Reaches The GPU (Another Context Waiting on An Unflushed Fence Could Wait Forever)
+    const GLsync fence{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)};
+    glFlush();
+    const float uploadMs{std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count()};
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->fencedTasks.push_back({std::move(task.onComplete), fence, task.submitTime});
+    this->lastUploadMs = uploadMs;
+    this->maxUploadMs = std::max(this->maxUploadMs, uploadMs);
+}
+
+// Run The Oldest Fenced Task's onComplete() if its Fence Has Signalled (Fences Signal in Order so Only The Oldest Needs Checking)
+// Only One Thread Completes Tasks so The Oldest Task Can't Change While Its Fence is Waited on Without The Lock
+bool UploadThread::complete(const GLuint64 &timeout) {
+    GLsync fence{nullptr};
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if(this->fencedTasks.empty()) return false;
+        fence = this->fencedTasks.front().fence;
+    }
+    const GLenum waitResult{glClientWaitSync(fence, 0, timeout)};
+    if(waitResult == GL_TIMEOUT_EXPIRED) return false;
+
+    // A Failed Wait (Usually A Lost or Invalid Fence) Says Nothing About The Upload - Fall Back to glFinish() (The Upload Was Flushed Before it Was Fenced) so The Task Still Completes
+    if(waitResult == GL_WAIT_FAILED) {
+        std::cerr << "Upload Fence Wait Failed (OpenGL Error " << glGetError() << "), Finishing Every GPU Command Instead\n";
+        glFinish();
+    }
+    FencedTaskStruct fencedTask;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        fencedTask = std::move(this->fencedTasks.front());
+        this->fencedTasks.pop_front();
+    }
+    glDeleteSync(fencedTask.fence);
+    if(fencedTask.onComplete) fencedTask.onComplete();
+
+    // Statistics
+    const float latencyMs{std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - fencedTask.submitTime).count()};
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->completedTaskCount++;
+    this->lastLatencyMs = latencyMs;
+    this->maxLatencyMs = std::max(this->maxLatencyMs, latencyMs);
+    return true;
+}
+
+// Run onComplete() of Every Upload The GPU Has Finished
+void UploadThread::update(void) {
+    CPU_PROFILE_SCOPE("UploadThread::update");
+    while(this->complete(0));
+}
+
+// Wait Until Every Queued Upload Has Finished and Run Their onComplete()
+void UploadThread::finish(void) {
+    CPU_PROFILE_SCOPE("UploadThread::finish");
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->idleCondition.wait(lock, [this](void) {return this->tasks.empty() && !this->busy;});
+    }
+    while(true) {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if(this->fencedTasks.empty()) break;
+        }
+        this->complete(1000000000);
+    }
+}
+
+// Get Statistics
+UploadThreadStatsStruct UploadThread::getStats(void) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    UploadThreadStatsStruct stats;
+    stats.queuedTaskCount = this->tasks.size() + (this->busy ? 1 : 0);
+    stats.inFlightTaskCount = this->fencedTasks.size();
+    stats.completedTaskCount = this->completedTaskCount;
+    stats.lastUploadMs = this->lastUploadMs;
+    stats.maxUploadMs = this->maxUploadMs;
+    stats.lastLatencyMs = this->lastLatencyMs;
+    stats.maxLatencyMs = this->maxLatencyMs;
+    return stats;
+}
+
+// Get Statistics as A Single Line Report
+std::string UploadThread::getStatsReport(void) {
+    const UploadThreadStatsStruct stats{this->getStats()};
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2);
+    report << stats.queuedTaskCount << " Queued, " << stats.inFlightTaskCount << " Waiting on Fences, " << stats.completedTaskCount << " Completed"
+           << " | Upload: " << stats.lastUploadMs << "ms (Max " << stats.maxUploadMs << "ms)"
+           << " | Submit to Ready: " << stats.lastLatencyMs << "ms (Max " << stats.maxLatencyMs << "ms)";
+    return report.str();
+}
+
+// Destroy
+void UploadThread::destroy(void) {
+    if(this->thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->running = false;
+        }
+        this->taskCondition.notify_all();
+        this->thread.join();
+    }
+    this->finish();
+}
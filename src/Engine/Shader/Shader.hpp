@@ -3,6 +3,9 @@
 // Standard Headers
 #include<iostream>
 #include<fstream>
+#include<string>
+#include<vector>
+#include<unordered_set>
 
 // GLAD OpenGL Loader
 #include<glad/glad.h>
@@ -17,59 +20,70 @@ class Shader {
         Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath);
         Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string geometryShaderSourceFilePath);
 
+        // Constructor - Create Shaders With Preprocessor Defines (An Empty Geometry Shader File Path Drops The Geometry Stage)
+        Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string &geometryShaderSourceFilePath, const std::vector<std::string> &shaderDefines);
+
         // Use Shaders
         void use(void) {glUseProgram(this->shaderProgram);}
 
-        // Uniform Variable Setters
+        // Uniform Variable Setters (Names Are C Strings so Literals Don't Build A std::string Every Call - Use FrameArena::format() For Generated Names)
         // Boolean
-        void setBool(const std::string &uniformVariableName, const bool &value) {
-            glUniform1i(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), (int)value);
+        void setBool(const char *uniformVariableName, const bool &value) {
+            glUniform1i(glGetUniformLocation(this->shaderProgram, uniformVariableName), (int)value);
         }
 
         // Integer
-        void setInt(const std::string &uniformVariableName, const int &value) {
-            glUniform1i(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), value);
+        void setInt(const char *uniformVariableName, const int &value) {
+            glUniform1i(glGetUniformLocation(this->shaderProgram, uniformVariableName), value);
         }
 
         // Float
-        void setFloat(const std::string &uniformVariableName, const float &value) {
-            glUniform1f(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), value);
+        void setFloat(const char *uniformVariableName, const float &value) {
+            glUniform1f(glGetUniformLocation(this->shaderProgram, uniformVariableName), value);
         }
 
         // Double
-        void setDouble(const std::string &uniformVariableName, const double &value) {
-            glUniform1d(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), value);
+        void setDouble(const char *uniformVariableName, const double &value) {
+            glUniform1d(glGetUniformLocation(this->shaderProgram, uniformVariableName), value);
         }
 
         // Vec2
-        void setVec2(const std::string &uniformVariableName, const glm::vec2 &value) {
-            glUniform2fv(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), 1, &value[0]);
+        void setVec2(const char *uniformVariableName, const glm::vec2 &value) {
+            glUniform2fv(glGetUniformLocation(this->shaderProgram, uniformVariableName), 1, &value[0]);
         }
-        void setVec2(const std::string &uniformVariableName, const float &a, const float &b) {
-            glUniform2f(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), a, b);
+        void setVec2(const char *uniformVariableName, const float &a, const float &b) {
+            glUniform2f(glGetUniformLocation(this->shaderProgram, uniformVariableName), a, b);
         }
 
         // Vec3
-        void setVec3(const std::string &uniformVariableName, const glm::vec3 &value) {
-            glUniform3fv(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), 1, &value[0]);
+        void setVec3(const char *uniformVariableName, const glm::vec3 &value) {
+            glUniform3fv(glGetUniformLocation(this->shaderProgram, uniformVariableName), 1, &value[0]);
+        }
+        void setVec3(const char *uniformVariableName, const float &a, const float &b, const float &c) {
+            glUniform3f(glGetUniformLocation(this->shaderProgram, uniformVariableName), a, b, c);
         }
-        void setVec3(const std::string &uniformVariableName, const float &a, const float &b, const float &c) {
-            glUniform3f(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), a, b, c);
+
+        // IVec3
+        void setIVec3(const char *uniformVariableName, const glm::ivec3 &value) {
+            glUniform3iv(glGetUniformLocation(this->shaderProgram, uniformVariableName), 1, &value[0]);
         }
 
         // Vec4
-        void setVec4(const std::string &uniformVariableName, const glm::vec4 &value) {
-            glUniform4fv(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), 1, &value[0]);
+        void setVec4(const char *uniformVariableName, const glm::vec4 &value) {
+            glUniform4fv(glGetUniformLocation(this->shaderProgram, uniformVariableName), 1, &value[0]);
         }
-        void setVec4(const std::string &uniformVariableName, const float &a, const float &b, const float &c, const float &d) {
-            glUniform4f(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), a, b, c, d);
+        void setVec4(const char *uniformVariableName, const float &a, const float &b, const float &c, const float &d) {
+            glUniform4f(glGetUniformLocation(this->shaderProgram, uniformVariableName), a, b, c, d);
         }
 
         // Mat4
-        void setMat4(const std::string &uniformVariableName, const glm::mat4 &value) {
-            glUniformMatrix4fv(glGetUniformLocation(this->shaderProgram, uniformVariableName.c_str()), 1, GL_FALSE, &value[0][0]);
+        void setMat4(const char *uniformVariableName, const glm::mat4 &value) {
+            glUniformMatrix4fv(glGetUniformLocation(this->shaderProgram, uniformVariableName), 1, GL_FALSE, &value[0][0]);
         }
 
+        // Getters
+        GLuint getShaderProgram(void) {return this->shaderProgram;}
+
         // Delete Shaders
         void destroy(void) {glDeleteProgram(this->shaderProgram);}
     private:
@@ -77,5 +91,8 @@ class Shader {
         GLuint shaderProgram{};
 
         // Create A Shader Using A Shader Source File
-        GLuint readShaderSrcFile(const std::string &shaderSourceFilePath, GLenum shaderType);
+        GLuint readShaderSrcFile(const std::string &shaderSourceFilePath, GLenum shaderType, const std::vector<std::string> &shaderDefines);
+
+        // Read A Shader Source File and Expand Its #include Directives (Every File is Only Included Once)
+        std::string readShaderSource(const std::string &shaderSourceFilePath, std::unordered_set<std::string> &includedFilePaths);
 };
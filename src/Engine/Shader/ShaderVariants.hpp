@@ -0,0 +1,54 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<unordered_map>
+
+// Custom Engine Headers
+#include"Shader.hpp"
+
+// Shader Keywords - Each Keyword Becomes A #define in The Shader Variants That Enable it
+enum ShaderKeyword : unsigned int {
+    SHADER_KEYWORD_NONE = 0,
+    SHADER_KEYWORD_USE_GS = 1 << 0,
+    SHADER_KEYWORD_LIGHT_DIRECTIONAL = 1 << 1,
+    SHADER_KEYWORD_LIGHT_POINT = 1 << 2,
+    SHADER_KEYWORD_LIGHT_SPOT = 1 << 3,
+    SHADER_KEYWORD_HAS_SPECULAR_MAP = 1 << 4,
+    SHADER_KEYWORD_LIGHT_CLUSTERED = 1 << 5,
+    SHADER_KEYWORD_USE_FXAA = 1 << 6,
+    SHADER_KEYWORD_SHADOWS_CASCADED = 1 << 7,
+    SHADER_KEYWORD_SHADOWS_ATLAS = 1 << 8,
+    SHADER_KEYWORD_SHADOWS_POINT = 1 << 9,
+};
+
+// Shader Variants Class - Lazily Compiles and Caches One Shader Program Per Keyword Combination
+class ShaderVariants {
+    public:
+        // Constructor - Set Shader Source Files and The Keywords The Shaders Understand
+        ShaderVariants(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string &geometryShaderSourceFilePath, const unsigned int &supportedKeywords);
+
+        // Get The Shader Variant For A Keyword Combination (Compiled on First Use)
+        // Keywords The Shaders Don't Support Are Ignored so They Don't Create Duplicate Variants
+        Shader &get(const unsigned int &keywords);
+
+        // Getters
+        unsigned int getSupportedKeywords(void) {return this->supportedKeywords;}
+        std::size_t getVariantCount(void) {return this->variants.size();}
+
+        // Delete All Compiled Shader Variants
+        void destroy(void);
+    private:
+        // Shader Source Files
+        std::string vertexShaderSourceFilePath, fragmentShaderSourceFilePath, geometryShaderSourceFilePath;
+
+        // Keywords The Shaders Understand
+        unsigned int supportedKeywords;
+
+        // Compiled Shader Variants (Keyed by Keyword Combination)
+        std::unordered_map<unsigned int, Shader> variants;
+
+        // Convert A Keyword Combination Into Preprocessor Defines
+        static std::vector<std::string> getShaderDefines(const unsigned int &keywords);
+};
@@ -1,47 +1,32 @@
 #include "Shader.hpp"
 
-// Constructor - Create Shaders
-Shader::Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath) {
-    // Shaders
-    GLuint vertexShader{this->readShaderSrcFile(vertexShaderSourceFilePath, GL_VERTEX_SHADER)};
-    GLuint fragmentShader{this->readShaderSrcFile(fragmentShaderSourceFilePath, GL_FRAGMENT_SHADER)};
-
-    // Attach Shaders to Shader Program and Link Shader Program
-    this->shaderProgram = glCreateProgram();
-    glAttachShader(this->shaderProgram, vertexShader);
-    glAttachShader(this->shaderProgram, fragmentShader);
-    glLinkProgram(this->shaderProgram);
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+#include"../Assets/VirtualFileSystem.hpp"
 
-    // Check For Shader Program Link Errors
-    int success;
-    char infoLog[1024];
-    glGetProgramiv(this->shaderProgram, GL_LINK_STATUS, &success);
-    if(!success) {
-        // Get Shader Program Info Log
-        glGetProgramInfoLog(this->shaderProgram, 1024, nullptr, infoLog);
+// Constructor - Create Shaders
+Shader::Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath)
+    : Shader(vertexShaderSourceFilePath, fragmentShaderSourceFilePath, "", {}) {}
+Shader::Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string geometryShaderSourceFilePath)
+    : Shader(vertexShaderSourceFilePath, fragmentShaderSourceFilePath, geometryShaderSourceFilePath, {}) {}
 
-        // Display Error Message and Info Log
-        std::cerr << "Shader Program Link Error!\n";
-        std::cerr << "Shader Program Info Log: " << infoLog << "\n\n";
-    }
+// Constructor - Create Shaders With Preprocessor Defines (An Empty Geometry Shader File Path Drops The Geometry Stage)
+Shader::Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string &geometryShaderSourceFilePath, const std::vector<std::string> &shaderDefines) {
+    CPU_PROFILE_SCOPE("Shader::Shader");
 
-    // Detach Shaders From Shader Program and Delete Them
-    glDetachShader(this->shaderProgram, vertexShader);
-    glDetachShader(this->shaderProgram, fragmentShader);
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-}
-Shader::Shader(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string geometryShaderSourceFilePath) {
     // Shaders
-    GLuint vertexShader{this->readShaderSrcFile(vertexShaderSourceFilePath, GL_VERTEX_SHADER)};
-    GLuint fragmentShader{this->readShaderSrcFile(fragmentShaderSourceFilePath, GL_FRAGMENT_SHADER)};
-    GLuint geometryShader{this->readShaderSrcFile(geometryShaderSourceFilePath, GL_GEOMETRY_SHADER)};
+    std::vector<GLuint> shaders;
+    shaders.push_back(this->readShaderSrcFile(vertexShaderSourceFilePath, GL_VERTEX_SHADER, shaderDefines));
+    shaders.push_back(this->readShaderSrcFile(fragmentShaderSourceFilePath, GL_FRAGMENT_SHADER, shaderDefines));
+    if(!geometryShaderSourceFilePath.empty()) {
+        shaders.push_back(this->readShaderSrcFile(geometryShaderSourceFilePath, GL_GEOMETRY_SHADER, shaderDefines));
+    }
 
     // Attach Shaders to Shader Program and Link Shader Program
     this->shaderProgram = glCreateProgram();
-    glAttachShader(this->shaderProgram, vertexShader);
-    glAttachShader(this->shaderProgram, fragmentShader);
-    glAttachShader(this->shaderProgram, geometryShader);
+    for(GLuint shader : shaders) {
+        glAttachShader(this->shaderProgram, shader);
+    }
     glLinkProgram(this->shaderProgram);
 
     // Check For Shader Program Link Errors
@@ -58,40 +43,31 @@ Shader::Shader(const std::string &vertexShaderSourceFilePath, const std::string
     }
 
     // Detach Shaders From Shader Program and Delete Them
-    glDetachShader(this->shaderProgram, vertexShader);
-    glDetachShader(this->shaderProgram, fragmentShader);
-    glDetachShader(this->shaderProgram, geometryShader);
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-    glDeleteShader(geometryShader);
+    for(GLuint shader : shaders) {
+        glDetachShader(this->shaderProgram, shader);
+        glDeleteShader(shader);
+    }
 }
 
 // Create A Shader Using A Shader Source File
-GLuint Shader::readShaderSrcFile(const std::string &shaderSourceFilePath, GLenum shaderType) {
-    // Variables
-    std::ifstream shaderSourceFile;
-    std::string shaderCppSource;
-
-    // Set Shader Source File Exceptions
-    shaderSourceFile.exceptions(std::ifstream::badbit | std::ifstream::failbit);
-
-    // Open and Read A Shader Source File - Catch Any File Exceptions
-    try {
-        // Open Shader Source File
-        shaderSourceFile.open(shaderSourceFilePath, std::ios::in | std::ios::binary);
-
-        // Read Shader Source File Into C++ String
-        shaderSourceFile.seekg(0, std::ios::end);
-        shaderCppSource.resize(shaderSourceFile.tellg());
-        shaderSourceFile.seekg(0, std::ios::beg);
-        shaderSourceFile.read(&shaderCppSource[0], shaderCppSource.size());
-
-        // Close Shader Source File
-        shaderSourceFile.close();
-    } catch(std::ifstream::failure &error) {
-        std::cerr << "Failed to Open and Read Shader Source File!\n";
-        std::cerr << "Error Message: " << error.what() << "\n\n";
+GLuint Shader::readShaderSrcFile(const std::string &shaderSourceFilePath, GLenum shaderType, const std::vector<std::string> &shaderDefines) {
+    // Read Shader Source File and Expand Its Includes
+    std::unordered_set<std::string> includedFilePaths;
+    std::string shaderCppSource{this->readShaderSource(shaderSourceFilePath, includedFilePaths)};
+
+    // Insert Preprocessor Defines Right After The #version Directive (It Has to Stay The First Directive)
+    std::string defineLines;
+    for(const std::string &shaderDefine : shaderDefines) {
+        defineLines += "#define " + shaderDefine + "\n";
     }
+    std::size_t insertPos{0};
+    const std::size_t versionPos{shaderCppSource.find("#version")};
+    if(versionPos != std::string::npos) {
+        const std::size_t versionLineEnd{shaderCppSource.find('\n', versionPos)};
+        if(versionLineEnd == std::string::npos) shaderCppSource += '\n';
+        insertPos = (versionLineEnd == std::string::npos) ? shaderCppSource.size() : versionLineEnd + 1;
+    }
+    shaderCppSource.insert(insertPos, defineLines);
 
     // Convert Shader Source in C++ String to C String
     const char* shaderSource = shaderCppSource.c_str();
@@ -111,9 +87,60 @@ GLuint Shader::readShaderSrcFile(const std::string &shaderSourceFilePath, GLenum
 
         // Display Error Message and Shader Info Log
         std::cerr << "Failed to Compile Shader!\n";
+        std::cerr << "Shader Source File: " << shaderSourceFilePath << "\n";
         std::cerr << "Shader Info Log: " << infoLog << "\n\n";
     }
 
     // Return Shader
     return shader;
 }
+
+// Read A Shader Source File and Expand Its #include Directives (Every File is Only Included Once)
+std::string Shader::readShaderSource(const std::string &shaderSourceFilePath, std::unordered_set<std::string> &includedFilePaths) {
+    // Skip Files That Have Already Been Included (Under Any Spelling of Their Path, "lighting/../common.glsl" is "common.glsl")
+    if(!includedFilePaths.insert(VirtualFileSystem::normalizePath(shaderSourceFilePath)).second) return "";
+
+    // Read Shader Source File Into C++ String (From A Mounted Asset Archive or A Loose File)
+    FileDataStruct shaderSourceFile;
+    if(!VirtualFileSystem::readFile(shaderSourceFilePath, shaderSourceFile)) {
+        std::cerr << "Failed to Open and Read Shader Source File!\n";
+        std::cerr << "Shader Source File: " << shaderSourceFilePath << "\n\n";
+        return "";
+    }
+    const std::string shaderCppSource((const char*)shaderSourceFile.data, shaderSourceFile.size);
+
+    // Included Files Are Resolved Relative to The Including File's Directory
+    const std::size_t lastSlash{shaderSourceFilePath.find_last_of('/')};
+    const std::string directory{lastSlash == std::string::npos ? "" : shaderSourceFilePath.substr(0, lastSlash + 1)};
+
+    // Expand #include "file" Directives Line by Line
+    std::string expandedSource;
+    std::size_t lineStart{0};
+    while(lineStart < shaderCppSource.size()) {
+        // Current Line (Including Its Newline Character)
+        std::size_t lineEnd{shaderCppSource.find('\n', lineStart)};
+        lineEnd = (lineEnd == std::string::npos) ? shaderCppSource.size() : lineEnd + 1;
+        const std::string line{shaderCppSource.substr(lineStart, lineEnd - lineStart)};
+        lineStart = lineEnd;
+
+        // Copy Regular Lines As They Are
+        const std::size_t directivePos{line.find_first_not_of(" \t")};
+        if(directivePos == std::string::npos || line.compare(directivePos, 8, "#include") != 0) {
+            expandedSource += line;
+            continue;
+        }
+
+        // Replace #include Lines With The Included File's Source
+        const std::size_t pathStart{line.find('"', directivePos)};
+        const std::size_t pathEnd{pathStart == std::string::npos ? std::string::npos : line.find('"', pathStart + 1)};
+        if(pathEnd == std::string::npos) {
+            std::cerr << "Malformed #include Directive in Shader Source File: " << shaderSourceFilePath << "\n\n";
+            continue;
+        }
+        expandedSource += this->readShaderSource(directory + line.substr(pathStart + 1, pathEnd - pathStart - 1), includedFilePaths);
+        expandedSource += '\n';
+    }
+
+    // Return Expanded Shader Source
+    return expandedSource;
+}
@@ -0,0 +1,61 @@
+#include"ShaderVariants.hpp"
+
+// Shader Keyword Names (Used As Preprocessor Define Names)
+static const std::vector<std::pair<ShaderKeyword, std::string>> shaderKeywordNames{
+    {SHADER_KEYWORD_USE_GS, "USE_GS"},
+    {SHADER_KEYWORD_LIGHT_DIRECTIONAL, "LIGHT_DIRECTIONAL"},
+    {SHADER_KEYWORD_LIGHT_POINT, "LIGHT_POINT"},
+    {SHADER_KEYWORD_LIGHT_SPOT, "LIGHT_SPOT"},
+    {SHADER_KEYWORD_HAS_SPECULAR_MAP, "HAS_SPECULAR_MAP"},
+    {SHADER_KEYWORD_LIGHT_CLUSTERED, "LIGHT_CLUSTERED"},
+    {SHADER_KEYWORD_USE_FXAA, "USE_FXAA"},
+    {SHADER_KEYWORD_SHADOWS_CASCADED, "SHADOWS_CASCADED"},
+    {SHADER_KEYWORD_SHADOWS_ATLAS, "SHADOWS_ATLAS"},
+    {SHADER_KEYWORD_SHADOWS_POINT, "SHADOWS_POINT"},
+};
+
+// Constructor - Set Shader Source Files and The Keywords The Shaders Understand
+ShaderVariants::ShaderVariants(const std::string &vertexShaderSourceFilePath, const std::string &fragmentShaderSourceFilePath, const std::string &geometryShaderSourceFilePath, const unsigned int &supportedKeywords) {
+    // Set Shader Source Files
+    this->vertexShaderSourceFilePath = vertexShaderSourceFilePath;
+    this->fragmentShaderSourceFilePath = fragmentShaderSourceFilePath;
+    this->geometryShaderSourceFilePath = geometryShaderSourceFilePath;
+
+    // Set Supported Keywords
+    this->supportedKeywords = supportedKeywords;
+}
+
+// Get The Shader Variant For A Keyword Combination (Compiled on First Use)
+Shader &ShaderVariants::get(const unsigned int &keywords) {
+    // Ignore Keywords The Shaders Don't Support
+    const unsigned int variantKeywords{keywords & this->supportedKeywords};
+
+    // Return Cached Shader Variant (If Any)
+    auto variant = this->variants.find(variantKeywords);
+    if(variant != this->variants.end()) return variant->second;
+
+    // Drop The Optional Geometry Stage Unless The Variant Asks For it
+    const std::string geometryShaderSourceFilePath{(variantKeywords & SHADER_KEYWORD_USE_GS) ? this->geometryShaderSourceFilePath : ""};
+
+    // Compile and Cache New Shader Variant
+    return this->variants.try_emplace(variantKeywords, this->vertexShaderSourceFilePath, this->fragmentShaderSourceFilePath, geometryShaderSourceFilePath, getShaderDefines(variantKeywords)).first->second;
+}
+
+// Delete All Compiled Shader Variants
+void ShaderVariants::destroy(void) {
+    for(auto &variant : this->variants) {
+        variant.second.destroy();
+    }
+    this->variants.clear();
+}
+
+// Convert A Keyword Combination Into Preprocessor Defines
+std::vector<std::string> ShaderVariants::getShaderDefines(const unsigned int &keywords) {
+    std::vector<std::string> shaderDefines;
+    for(const auto &shaderKeywordName : shaderKeywordNames) {
+        if(keywords & shaderKeywordName.first) {
+            shaderDefines.push_back(shaderKeywordName.second);
+        }
+    }
+    return shaderDefines;
+}
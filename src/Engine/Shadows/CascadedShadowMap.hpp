@@ -0,0 +1,77 @@
+#pragma once
+
+// Standard Headers
+#include<vector>
+#include<cstdint>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+#include<glm/gtc/matrix_transform.hpp>
+
+// Custom Engine Headers
+#include"ShadowCaster.hpp"
+#include"../Shader/Shader.hpp"
+#include"../Framebuffer/Framebuffer.hpp"
+#include"../Culling/Culling.hpp"
+#include"../Memory/FrameArena.hpp"
+
+// Cascaded Shadow Map Class - Directional Light Shadows Split Into Depth Cascades Stored in A Texture Array
+class CascadedShadowMap {
+    public:
+        // Maximum Number of Cascades (Must Match The Shader's Uniform Array Sizes)
+        static constexpr unsigned int maxCascadeCount{4};
+
+        // Constructor - Create Shadow Map Arrays (Live Maps and Static Caster Cache)
+        CascadedShadowMap(const unsigned int &resolution, const unsigned int &cascadeCount, const float &splitLambda, const float &shadowDistance);
+
+        // Calculate Cascade Splits and Texel Snapped Light Matrices For The Current Camera
+        void update(const glm::mat4 &viewMatrix, const float &camFOV, const float &aspectRatio, const float &zNear, const glm::vec3 &lightDirection);
+
+        // Render Shadow Casters Into The Cascades That Need it (Static Casters Are Cached Per Cascade)
+        void render(const std::vector<ShadowCasterStruct> &shadowCasters, Shader &depthShader);
+
+        // Bind Shadow Map Array to A Texture Unit and Send Cascade Properties to A Shader
+        void setUniforms(Shader &shader, const unsigned int &textureUnit);
+
+        // Getters
+        unsigned int getCascadeCount(void) {return this->cascadeCount;}
+        unsigned int getRenderedCascadeCount(void) {return this->renderedCascadeCount;}
+        unsigned int getShadowDrawCount(void) {return this->shadowDrawCount;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Cascade Settings
+        unsigned int resolution, cascadeCount;
+        float splitLambda, shadowDistance;
+
+        // Live Shadow Maps (Static + Dynamic Casters) and Static Caster Cache
+        Framebuffer shadowMaps, staticShadowMaps;
+
+        // Per Cascade Data
+        struct CascadeStruct {
+            // Far Split Distance (View Space Depth) and Light Projection View Matrix
+            float splitDepth{0.0f};
+            glm::mat4 lightPV{1.0f};
+
+            // Light Projection View Matrix and Static Caster State The Static Cache Was Rendered With
+            glm::mat4 cachedLightPV{0.0f};
+            std::uint64_t cachedStaticCasterHash{0};
+
+            // Whether Dynamic Casters Were Rendered Into The Live Shadow Map Last Frame
+            bool hadDynamicCasters{false};
+        };
+        CascadeStruct cascades[maxCascadeCount];
+
+        // Camera View Matrix The Cascades Were Built For
+        glm::mat4 viewMatrix{1.0f};
+
+        // Statistics of The Last Render
+        unsigned int renderedCascadeCount{0}, shadowDrawCount{0};
+
+        // Render Shadow Casters Into A Bound Shadow Map Layer
+        void renderCasters(const FrameVector<const ShadowCasterStruct*> &shadowCasters, const glm::mat4 &lightPV, Shader &depthShader);
+};
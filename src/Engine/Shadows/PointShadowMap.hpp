@@ -0,0 +1,62 @@
+#pragma once
+
+// Standard Headers
+#include<string>
+#include<vector>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+#include<glm/gtc/matrix_transform.hpp>
+
+// Custom Engine Headers
+#include"ShadowCaster.hpp"
+#include"../Shader/Shader.hpp"
+#include"../Framebuffer/Framebuffer.hpp"
+#include"../Culling/Culling.hpp"
+#include"../Lighting/ClusteredLighting.hpp"
+#include"../Memory/FrameArena.hpp"
+
+// Point Shadow Map Class - Omnidirectional Point Light Shadows Stored in A Depth Cubemap Array
+// All Six Faces of A Light Are Rendered in One Layered Pass - Each Caster is Submitted Once and The Geometry Shader
+// Instances it Only Into The Faces The CPU Found it in
+class PointShadowMap {
+    public:
+        // Maximum Number of Shadowed Point Lights (Must Match The Shader's Uniform Array Size)
+        static constexpr unsigned int maxLightCount{8};
+
+        // Constructor - Create Shadow Cubemap Array and Layered Depth Shaders
+        PointShadowMap(const unsigned int &resolution, const std::string &shaderDirectoryPath);
+
+        // Render Shadow Cubemaps of Point Lights (Light i Gets Shadow Index i)
+        void render(const FrameVector<const LightStruct*> &lights, const std::vector<ShadowCasterStruct> &shadowCasters);
+
+        // Bind Shadow Cubemap Array to A Texture Unit and Send Shadow Far Planes to A Shader
+        void setUniforms(Shader &shader, const unsigned int &textureUnit);
+
+        // Getters
+        unsigned int getLightCount(void) {return this->lightCount;}
+        unsigned int getShadowDrawCount(void) {return this->shadowDrawCount;}
+        unsigned int getRenderedFaceCount(void) {return this->renderedFaceCount;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Cubemap Face Resolution
+        unsigned int resolution;
+
+        // Shadow Cubemap Array
+        Framebuffer shadowCubemaps;
+
+        // Layered Depth Shaders (Geometry Shader Routes Triangles to Cube Faces)
+        Shader depthShaders;
+
+        // Shadow Far Plane (Light Range) of Every Rendered Light
+        float farPlanes[maxLightCount]{};
+        unsigned int lightCount{0};
+
+        // Statistics of The Last Render
+        unsigned int shadowDrawCount{0}, renderedFaceCount{0};
+};
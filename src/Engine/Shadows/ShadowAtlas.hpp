@@ -0,0 +1,111 @@
+#pragma once
+
+// Standard Headers
+#include<vector>
+#include<cstdint>
+
+// GLAD OpenGL Loader
+#include<glad/glad.h>
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+#include<glm/gtc/matrix_transform.hpp>
+
+// Custom Engine Headers
+#include"ShadowCaster.hpp"
+#include"../Shader/Shader.hpp"
+#include"../Framebuffer/Framebuffer.hpp"
+#include"../Culling/Culling.hpp"
+#include"../Lighting/ClusteredLighting.hpp"
+#include"../Memory/FrameArena.hpp"
+
+// Shadow Atlas Statistics (Of The Last Frame)
+struct ShadowAtlasStatsStruct {
+    // Lights With A Tile and Tiles Allocated in The Atlas
+    unsigned int shadowedLightCount{0}, allocatedTileCount{0};
+
+    // Fraction of Atlas Texels Allocated to Tiles
+    float occupancy{0.0f};
+
+    // Tiles Rendered This Frame and Dirty Tiles Pushed to Later Frames by The Update Budget
+    unsigned int updatedTileCount{0}, deferredTileCount{0};
+
+    // Shadow Caster Draw Calls This Frame and GPU Time of The Shadow Pass (Milliseconds, A Few Frames Old)
+    unsigned int shadowDrawCount{0};
+    double gpuTimeMs{0.0};
+};
+
+// Shadow Atlas Class - Spot and Point Light Shadow Maps Packed Into One Depth Texture
+// Tile Resolution Follows Each Light's Screen Space Importance and Only Lights That (Or Whose Casters) Moved Are Re-Rendered
+class ShadowAtlas {
+    public:
+        // Constructor - Create Atlas Depth Texture (Tile Resolutions Are Powers of Two Between minTileResolution and maxTileResolution)
+        ShadowAtlas(const unsigned int &resolution, const unsigned int &minTileResolution, const unsigned int &maxTileResolution, const unsigned int &maxTileUpdatesPerFrame, const float &distantLightImportance);
+
+        // Allocate Tiles by Light Importance, Re-Render Dirty Tiles Within The Update Budget and Write Each Light's Shadow Index
+        void update(std::vector<LightStruct> &lights, const std::vector<ShadowCasterStruct> &shadowCasters, Shader &depthShader, const glm::mat4 &viewMatrix, const glm::mat4 &projectionMatrix, const unsigned int &screenHeight);
+
+        // Bind Atlas to A Texture Unit and The Tile Buffer to Its Storage Buffer Binding
+        void setUniforms(Shader &shader, const unsigned int &textureUnit);
+
+        // Getters
+        const ShadowAtlasStatsStruct &getStats(void) {return this->stats;}
+
+        // Destroy
+        void destroy(void);
+    private:
+        // Atlas Settings
+        unsigned int resolution, minTileResolution, maxTileResolution, maxTileUpdatesPerFrame;
+        float distantLightImportance;
+
+        // Atlas Depth Texture
+        Framebuffer atlas;
+
+        // Tile Allocator - Free Quadtree Nodes Per Level (Level 0 is The Whole Atlas, Each Level Halves The Tile Size)
+        std::vector<std::vector<glm::uvec2>> freeTiles;
+
+        // Per Light Shadow State (Indexed Like The Light List)
+        struct ShadowedLightStruct {
+            // Allocated Tiles (One Per Spotlight, Six Cube Faces Per Point Light) and The Level Asked For When They Were Allocated
+            int tileLevel{-1}, requestedLevel{-1};
+            unsigned int tileCount{0};
+            glm::uvec2 tiles[6];
+
+            // Light Projection View Matrix of Each Tile and Tangent of Half Its Field of View
+            glm::mat4 lightPV[6];
+            float tanHalfFOV{1.0f};
+
+            // Screen Space Importance (Projected Size of The Light's Range)
+            float importance{0.0f};
+
+            // Light and Nearby Caster State The Tiles Were Rendered With
+            std::uint64_t lightHash{0}, casterHash{0};
+            bool rendered{false};
+        };
+        std::vector<ShadowedLightStruct> shadowedLights;
+
+        // Round Robin Cursor For Distant Light Updates
+        std::size_t distantLightCursor{0};
+
+        // Shadow Tile Storage Buffer Object (Light Matrix and Atlas Rectangle of Every Tile)
+        GLuint shadowTileSSBO;
+
+        // Double Buffered GPU Timer Queries (Read A Frame Later so The CPU Never Waits)
+        GLuint timerQueries[2];
+        bool timerQueryPending[2]{false, false};
+        unsigned int frameIndex{0};
+
+        // Statistics of The Last Frame
+        ShadowAtlasStatsStruct stats;
+
+        // Quadtree Tile Allocation
+        bool allocateTile(const int &level, glm::uvec2 &tile);
+        void freeTile(int level, glm::uvec2 tile);
+        void freeLightTiles(ShadowedLightStruct &shadowedLight);
+
+        // Tile Size in Texels at A Quadtree Level
+        unsigned int getTileResolution(const int &level) {return this->resolution >> level;}
+
+        // Render Shadow Casters Into One Tile
+        void renderTile(const ShadowedLightStruct &shadowedLight, const unsigned int &tile, const FrameVector<const ShadowCasterStruct*> &shadowCasters, Shader &depthShader);
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+// OpenGL Mathematics (GLM)
+#include<glm/glm.hpp>
+
+// Custom Engine Headers
+#include"../Model/Model.hpp"
+#include"../Culling/Culling.hpp"
+
+// Shadow Caster Struct
+struct ShadowCasterStruct {
+    // Model and Its Model Matrix
+    Model* model;
+    glm::mat4 modelMatrix{1.0f};
+
+    // Static Casters Never Move so Shadow Maps Containing Only Static Casters Can Be Cached
+    bool isStatic{true};
+
+    // World Space Bounding Box (Set by The Scene Whenever The Caster Moves)
+    BoundingBox worldBoundingBox;
+};
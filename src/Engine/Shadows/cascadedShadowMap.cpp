@@ -0,0 +1,172 @@
+#include"CascadedShadowMap.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<string>
+#include<algorithm>
+#include<functional>
+
+// Constructor - Create Shadow Map Arrays (Live Maps and Static Caster Cache)
+CascadedShadowMap::CascadedShadowMap(const unsigned int &resolution, const unsigned int &cascadeCount, const float &splitLambda, const float &shadowDistance)
+    : shadowMaps(resolution, resolution, false, 0, "Cascaded Shadow Maps"), staticShadowMaps(resolution, resolution, false, 0, "Static Cascaded Shadow Maps") {
+    // Set Cascade Settings
+    this->resolution = resolution;
+    this->cascadeCount = std::clamp(cascadeCount, 1u, maxCascadeCount);
+    this->splitLambda = splitLambda;
+    this->shadowDistance = shadowDistance;
+
+    // Create Shadow Map Arrays
+    this->shadowMaps.createShadowMapArray(this->cascadeCount);
+    this->staticShadowMaps.createShadowMapArray(this->cascadeCount);
+}
+
+// Calculate Cascade Splits and Texel Snapped Light Matrices For The Current Camera
+void CascadedShadowMap::update(const glm::mat4 &viewMatrix, const float &camFOV, const float &aspectRatio, const float &zNear, const glm::vec3 &lightDirection) {
+    this->viewMatrix = viewMatrix;
+
+    // Light View Rotation is Fixed so Snapping in Light Space Keeps Cascades Stable
+    const glm::vec3 lightDir{glm::normalize(lightDirection)};
+    const glm::vec3 lightUp{std::abs(lightDir.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f)};
+    const glm::mat4 lightView{glm::lookAt(glm::vec3(0.0f), lightDir, lightUp)};
+
+    // Camera Frustum Properties
+    const glm::mat4 inverseViewMatrix{glm::inverse(viewMatrix)};
+    const float tanHalfFOV{std::tan(glm::radians(camFOV) * 0.5f)};
+
+    float splitNear{zNear};
+    for(unsigned int i = 0; i < this->cascadeCount; i++) {
+        // Practical Split Scheme - Blend of Logarithmic and Uniform Splits
+        const float splitRatio{(float)(i + 1) / this->cascadeCount};
+        const float logSplit{zNear * std::pow(this->shadowDistance / zNear, splitRatio)};
+        const float uniformSplit{zNear + (this->shadowDistance - zNear) * splitRatio};
+        const float splitFar{this->splitLambda * logSplit + (1.0f - this->splitLambda) * uniformSplit};
+
+        // World Space Corners of The Cascade's Slice of The Camera Frustum
+        glm::vec3 corners[8];
+        unsigned int cornerIndex{0};
+        for(const float depth : {splitNear, splitFar}) {
+            for(const glm::vec2 &corner : {glm::vec2(-1.0f, -1.0f), glm::vec2(1.0f, -1.0f), glm::vec2(-1.0f, 1.0f), glm::vec2(1.0f, 1.0f)}) {
+                corners[cornerIndex++] = glm::vec3(inverseViewMatrix * glm::vec4(corner.x * tanHalfFOV * aspectRatio * depth, corner.y * tanHalfFOV * depth, -depth, 1.0f));
+            }
+        }
+
+        // Bounding Sphere of The Slice - Its Size Doesn't Change When The Camera Rotates
+        glm::vec3 center{0.0f};
+        for(const glm::vec3 &corner : corners) {
+            center += corner / 8.0f;
+        }
+        float radius{0.0f};
+        for(const glm::vec3 &corner : corners) {
+            radius = std::max(radius, glm::length(corner - center));
+        }
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        // Snap The Sphere Center to Whole Shadow Map Texels in Light Space so Shadows Don't Shimmer
+        const float texelSize{2.0f * radius / this->resolution};
+        glm::vec3 lightSpaceCenter{lightView * glm::vec4(center, 1.0f)};
+        lightSpaceCenter = glm::floor(lightSpaceCenter / texelSize) * texelSize;
+
+        // Orthographic Light Projection Around The Snapped Sphere (Casters in Front of The Near Plane Are Depth Clamped)
+        const glm::mat4 lightProjection{glm::ortho(lightSpaceCenter.x - radius, lightSpaceCenter.x + radius, lightSpaceCenter.y - radius, lightSpaceCenter.y + radius, -lightSpaceCenter.z - radius - texelSize, -lightSpaceCenter.z + radius + texelSize)};
+        this->cascades[i].lightPV = lightProjection * lightView;
+        this->cascades[i].splitDepth = splitFar;
+        splitNear = splitFar;
+    }
+}
+
+// Render Shadow Casters Into The Cascades That Need it (Static Casters Are Cached Per Cascade)
+void CascadedShadowMap::render(const std::vector<ShadowCasterStruct> &shadowCasters, Shader &depthShader) {
+    // Hash Static Casters so Static Geometry Changes Invalidate The Static Cache
+    std::uint64_t staticCasterHash{14695981039346656037ull};
+    for(const ShadowCasterStruct &shadowCaster : shadowCasters) {
+        if(!shadowCaster.isStatic) continue;
+        const float* matrixValues{&shadowCaster.modelMatrix[0][0]};
+        staticCasterHash = (staticCasterHash ^ (std::uint64_t)(std::uintptr_t)shadowCaster.model) * 1099511628211ull;
+        for(unsigned int i = 0; i < 16; i++) {
+            staticCasterHash = (staticCasterHash ^ (std::uint64_t)std::hash<float>{}(matrixValues[i])) * 1099511628211ull;
+        }
+    }
+
+    // Depth Only Render State - Depth Clamping Keeps Casters Between The Light and The Near Plane, Slope Scaled Bias Fights Acne
+    glViewport(0, 0, this->resolution, this->resolution);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_DEPTH_CLAMP);
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(2.0f, 4.0f);
+    depthShader.use();
+
+    // Render Every Cascade
+    this->renderedCascadeCount = 0;
+    this->shadowDrawCount = 0;
+    FrameVector<const ShadowCasterStruct*> staticCasters, dynamicCasters;
+    for(unsigned int i = 0; i < this->cascadeCount; i++) {
+        CascadeStruct &cascade = this->cascades[i];
+
+        // Cull Casters Against The Cascade's Light Frustum
+        const Frustum lightFrustum{Culling::extractFrustum(cascade.lightPV)};
+        staticCasters.clear();
+        dynamicCasters.clear();
+        for(const ShadowCasterStruct &shadowCaster : shadowCasters) {
+            if(!Culling::boxIntersectsFrustum(shadowCaster.worldBoundingBox, lightFrustum, true)) continue;
+            (shadowCaster.isStatic ? staticCasters : dynamicCasters).push_back(&shadowCaster);
+        }
+
+        // Re-Render Static Cache Only When The Cascade Moved, The Light Changed or Static Geometry Changed
+        const bool staticCacheDirty{cascade.cachedLightPV != cascade.lightPV || cascade.cachedStaticCasterHash != staticCasterHash};
+        if(staticCacheDirty) {
+            this->staticShadowMaps.attachShadowMapLayer(i);
+            glClear(GL_DEPTH_BUFFER_BIT);
+            this->renderCasters(staticCasters, cascade.lightPV, depthShader);
+            cascade.cachedLightPV = cascade.lightPV;
+            cascade.cachedStaticCasterHash = staticCasterHash;
+        }
+
+        // Live Shadow Map = Static Cache + Dynamic Casters (Untouched if Nothing Changed)
+        if(staticCacheDirty || !dynamicCasters.empty() || cascade.hadDynamicCasters) {
+            glCopyImageSubData(this->staticShadowMaps.getDepthBufferTexture(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, this->shadowMaps.getDepthBufferTexture(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, this->resolution, this->resolution, 1);
+            if(!dynamicCasters.empty()) {
+                this->shadowMaps.attachShadowMapLayer(i);
+                this->renderCasters(dynamicCasters, cascade.lightPV, depthShader);
+            }
+            cascade.hadDynamicCasters = !dynamicCasters.empty();
+            this->renderedCascadeCount++;
+        }
+    }
+
+    // Restore Render State
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glDisable(GL_DEPTH_CLAMP);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Render Shadow Casters Into A Bound Shadow Map Layer
+void CascadedShadowMap::renderCasters(const FrameVector<const ShadowCasterStruct*> &shadowCasters, const glm::mat4 &lightPV, Shader &depthShader) {
+    for(const ShadowCasterStruct* shadowCaster : shadowCasters) {
+        depthShader.setMat4("lightPVM", lightPV * shadowCaster->modelMatrix);
+        shadowCaster->model->renderDepth();
+        this->shadowDrawCount++;
+    }
+}
+
+// Bind Shadow Map Array to A Texture Unit and Send Cascade Properties to A Shader
+void CascadedShadowMap::setUniforms(Shader &shader, const unsigned int &textureUnit) {
+    // Bind Shadow Map Array
+    glActiveTexture(GL_TEXTURE0 + textureUnit);
+    this->shadowMaps.bindShadowMapArray();
+    glActiveTexture(GL_TEXTURE0);
+    shader.setInt("cascadeShadowMap", textureUnit);
+
+    // Send Cascade Properties
+    shader.setInt("cascadeCount", this->cascadeCount);
+    shader.setMat4("cascadeViewMatrix", this->viewMatrix);
+    for(unsigned int i = 0; i < this->cascadeCount; i++) {
+        shader.setMat4(FrameArena::format("cascadeLightPV[%u]", i), this->cascades[i].lightPV);
+        shader.setFloat(FrameArena::format("cascadeSplits[%u]", i), this->cascades[i].splitDepth);
+    }
+}
+
+// Destroy
+void CascadedShadowMap::destroy(void) {
+    this->shadowMaps.destroy(false);
+    this->staticShadowMaps.destroy(false);
+}
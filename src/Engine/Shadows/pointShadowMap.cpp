@@ -0,0 +1,95 @@
+#include"PointShadowMap.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<string>
+#include<algorithm>
+
+// Cube Face Look Directions and Up Vectors (Same Order as GL_TEXTURE_CUBE_MAP_POSITIVE_X + i)
+static const glm::vec3 cubeFaceDirections[6]{{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+static const glm::vec3 cubeFaceUps[6]{{0.0f, -1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}};
+
+// Constructor - Create Shadow Cubemap Array and Layered Depth Shaders
+PointShadowMap::PointShadowMap(const unsigned int &resolution, const std::string &shaderDirectoryPath)
+    : shadowCubemaps(resolution, resolution, false, 0, "Point Shadow Maps"),
+      depthShaders(shaderDirectoryPath + "pointShadowMapShaders/vertexShader.glsl", shaderDirectoryPath + "pointShadowMapShaders/fragmentShader.glsl", shaderDirectoryPath + "pointShadowMapShaders/geometryShader.glsl") {
+    // Set Cubemap Face Resolution
+    this->resolution = resolution;
+
+    // Create Shadow Cubemap Array
+    this->shadowCubemaps.createShadowCubemapArray(maxLightCount);
+}
+
+// Render Shadow Cubemaps of Point Lights (Light i Gets Shadow Index i)
+void PointShadowMap::render(const FrameVector<const LightStruct*> &lights, const std::vector<ShadowCasterStruct> &shadowCasters) {
+    // Bind Every Cubemap Face at Once and Clear Them All
+    glBindFramebuffer(GL_FRAMEBUFFER, this->shadowCubemaps.getFramebufferObject());
+    glViewport(0, 0, this->resolution, this->resolution);
+    glEnable(GL_DEPTH_TEST);
+    glClear(GL_DEPTH_BUFFER_BIT);
+    this->depthShaders.use();
+
+    // Render Every Light
+    this->lightCount = std::min<std::size_t>(lights.size(), maxLightCount);
+    this->shadowDrawCount = 0;
+    this->renderedFaceCount = 0;
+    for(unsigned int i = 0; i < this->lightCount; i++) {
+        const LightStruct &light = *lights[i];
+
+        // Light Range Doubles as The Far Plane so Stored Depth is Distance / Range
+        const float range{ClusteredLighting::calculateLightRange(light)};
+        this->farPlanes[i] = std::isinf(range) ? 1000.0f : std::max(range, 0.1f);
+        const glm::mat4 faceProjection{glm::perspective(glm::radians(90.0f), 1.0f, 0.05f, this->farPlanes[i])};
+
+        // Face Matrices and Frustums
+        Frustum faceFrustums[6];
+        for(unsigned int face = 0; face < 6; face++) {
+            const glm::mat4 faceLightPV{faceProjection * glm::lookAt(light.position, light.position + cubeFaceDirections[face], cubeFaceUps[face])};
+            this->depthShaders.setMat4(FrameArena::format("faceLightPV[%u]", face), faceLightPV);
+            faceFrustums[face] = Culling::extractFrustum(faceLightPV);
+        }
+        this->depthShaders.setVec3("lightPos", light.position);
+        this->depthShaders.setFloat("farPlane", this->farPlanes[i]);
+        this->depthShaders.setInt("layerOffset", i * 6);
+
+        // Submit Every Caster Once With A Mask of The Faces it Touches (Casters Touching No Face Aren't Submitted)
+        for(const ShadowCasterStruct &shadowCaster : shadowCasters) {
+            if(!Culling::sphereIntersectsBox(light.position, this->farPlanes[i], shadowCaster.worldBoundingBox)) continue;
+            int faceMask{0};
+            for(unsigned int face = 0; face < 6; face++) {
+                if(Culling::boxIntersectsFrustum(shadowCaster.worldBoundingBox, faceFrustums[face])) {
+                    faceMask |= 1 << face;
+                    this->renderedFaceCount++;
+                }
+            }
+            if(faceMask == 0) continue;
+            this->depthShaders.setInt("faceMask", faceMask);
+            this->depthShaders.setMat4("modelMatrix", shadowCaster.modelMatrix);
+            shadowCaster.model->renderDepth();
+            this->shadowDrawCount++;
+        }
+    }
+
+    // Unbind Framebuffer Object
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// Bind Shadow Cubemap Array to A Texture Unit and Send Shadow Far Planes to A Shader
+void PointShadowMap::setUniforms(Shader &shader, const unsigned int &textureUnit) {
+    // Bind Shadow Cubemap Array
+    glActiveTexture(GL_TEXTURE0 + textureUnit);
+    this->shadowCubemaps.bindShadowCubemapArray();
+    glActiveTexture(GL_TEXTURE0);
+    shader.setInt("pointShadowMaps", textureUnit);
+
+    // Send Shadow Far Planes
+    for(unsigned int i = 0; i < this->lightCount; i++) {
+        shader.setFloat(FrameArena::format("pointShadowFarPlanes[%u]", i), this->farPlanes[i]);
+    }
+}
+
+// Destroy
+void PointShadowMap::destroy(void) {
+    this->shadowCubemaps.destroy(false);
+    this->depthShaders.destroy();
+}
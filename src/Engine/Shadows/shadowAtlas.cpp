@@ -0,0 +1,372 @@
+#include"ShadowAtlas.hpp"
+
+// Standard Headers
+#include<cmath>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../Memory/FrameArena.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
+
+// GPU Shadow Tile Struct (Matches The std430 Layout of The Shadow Tile Buffer in lighting.glsl)
+struct GPUShadowTileStruct {
+    glm::mat4 lightPV;
+    glm::vec4 atlasRect;
+    glm::vec4 texelSize;
+};
+
+// Cube Face Look Directions and Up Vectors (Same Order as GL_TEXTURE_CUBE_MAP_POSITIVE_X + i)
+static const glm::vec3 cubeFaceDirections[6]{{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+static const glm::vec3 cubeFaceUps[6]{{0.0f, -1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}};
+
+// FNV-1a Hash of Raw Bytes (Used to Detect Light and Caster Changes)
+static std::uint64_t hashBytes(std::uint64_t hash, const void* data, const std::size_t &size) {
+    const unsigned char* bytes{(const unsigned char*)data};
+    for(std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// Constructor - Create Atlas Depth Texture (Tile Resolutions Are Powers of Two Between minTileResolution and maxTileResolution)
+ShadowAtlas::ShadowAtlas(const unsigned int &resolution, const unsigned int &minTileResolution, const unsigned int &maxTileResolution, const unsigned int &maxTileUpdatesPerFrame, const float &distantLightImportance)
+    : atlas(resolution, resolution, false, 0, "Shadow Atlas") {
+    // Set Atlas Settings
+    this->resolution = resolution;
+    this->minTileResolution = std::min(minTileResolution, resolution);
+    this->maxTileResolution = std::clamp(maxTileResolution, this->minTileResolution, resolution);
+    this->maxTileUpdatesPerFrame = std::max(maxTileUpdatesPerFrame, 6u);
+    this->distantLightImportance = distantLightImportance;
+
+    // Create Atlas Depth Texture
+    this->atlas.createShadowMap();
+
+    // The Whole Atlas Starts as One Free Tile
+    int levelCount{1};
+    while((resolution >> (levelCount - 1)) > this->minTileResolution) levelCount++;
+    this->freeTiles.resize(levelCount);
+    this->freeTiles[0].push_back(glm::uvec2(0));
+
+    // Create Shadow Tile Storage Buffer and GPU Timer Queries
+    glGenBuffers(1, &this->shadowTileSSBO);
+    glGenQueries(2, this->timerQueries);
+}
+
+// Allocate A Free Tile at A Quadtree Level (Splitting A Larger Free Tile if Needed)
+bool ShadowAtlas::allocateTile(const int &level, glm::uvec2 &tile) {
+    // Find The Smallest Free Tile That Is At Least As Large
+    int freeLevel{level};
+    while(freeLevel >= 0 && this->freeTiles[freeLevel].empty()) freeLevel--;
+    if(freeLevel < 0) return false;
+    tile = this->freeTiles[freeLevel].back();
+    this->freeTiles[freeLevel].pop_back();
+
+    // Split it Down to The Requested Level, Keeping The First Child and Freeing The Other Three
+    for(; freeLevel < level; freeLevel++) {
+        tile *= 2u;
+        this->freeTiles[freeLevel + 1].push_back(tile + glm::uvec2(1, 0));
+        this->freeTiles[freeLevel + 1].push_back(tile + glm::uvec2(0, 1));
+        this->freeTiles[freeLevel + 1].push_back(tile + glm::uvec2(1, 1));
+    }
+    return true;
+}
+
+// Free A Tile and Merge it With Its Siblings When All Four Are Free
+void ShadowAtlas::freeTile(int level, glm::uvec2 tile) {
+    while(level > 0) {
+        // Find The Three Siblings in The Free List
+        std::vector<glm::uvec2> &freeTiles = this->freeTiles[level];
+        const glm::uvec2 firstSibling{tile & ~1u};
+        std::vector<std::size_t> siblingIndices;
+        for(std::size_t i = 0; i < freeTiles.size(); i++) {
+            if(freeTiles[i] != tile && (freeTiles[i] & ~1u) == firstSibling) siblingIndices.push_back(i);
+        }
+        if(siblingIndices.size() != 3) break;
+
+        // Merge Into The Parent Tile (Erase From The Back so Indices Stay Valid)
+        for(auto siblingIndex = siblingIndices.rbegin(); siblingIndex != siblingIndices.rend(); siblingIndex++) {
+            freeTiles.erase(freeTiles.begin() + *siblingIndex);
+        }
+        tile /= 2u;
+        level--;
+    }
+    this->freeTiles[level].push_back(tile);
+}
+void ShadowAtlas::freeLightTiles(ShadowedLightStruct &shadowedLight) {
+    for(unsigned int i = 0; i < shadowedLight.tileCount; i++) {
+        this->freeTile(shadowedLight.tileLevel, shadowedLight.tiles[i]);
+    }
+    shadowedLight.tileLevel = -1;
+    shadowedLight.tileCount = 0;
+    shadowedLight.rendered = false;
+}
+
+// Allocate Tiles by Light Importance, Re-Render Dirty Tiles Within The Update Budget and Write Each Light's Shadow Index
+void ShadowAtlas::update(std::vector<LightStruct> &lights, const std::vector<ShadowCasterStruct> &shadowCasters, Shader &depthShader, const glm::mat4 &viewMatrix, const glm::mat4 &projectionMatrix, const unsigned int &screenHeight) {
+    // Reset Statistics (GPU Time Arrives Frames Later so it's Kept)
+    const double gpuTimeMs{this->stats.gpuTimeMs};
+    this->stats = ShadowAtlasStatsStruct{};
+    this->stats.gpuTimeMs = gpuTimeMs;
+
+    // Free Tiles of Lights That No Longer Exist
+    for(std::size_t i = lights.size(); i < this->shadowedLights.size(); i++) {
+        this->freeLightTiles(this->shadowedLights[i]);
+    }
+    this->shadowedLights.resize(lights.size());
+
+    // Quadtree Levels of The Largest and Smallest Tiles
+    int minLevel{0}, maxLevel{(int)this->freeTiles.size() - 1};
+    while(this->getTileResolution(minLevel) > this->maxTileResolution) minLevel++;
+
+    // Pick A Tile Level For Every Light From Its Screen Space Importance
+    const Frustum cameraFrustum{Culling::extractFrustum(projectionMatrix * viewMatrix)};
+    const float tanHalfFOV{1.0f / projectionMatrix[1][1]};
+    FrameVector<int> desiredLevels(lights.size(), -1);
+    FrameVector<float> lightRanges(lights.size(), 0.0f);
+    for(std::size_t i = 0; i < lights.size(); i++) {
+        ShadowedLightStruct &shadowedLight = this->shadowedLights[i];
+        const LightStruct &light = lights[i];
+        shadowedLight.importance = 0.0f;
+
+        // Only Visible Shadow Casting Lights Get A Tile
+        const float range{ClusteredLighting::calculateLightRange(light)};
+        lightRanges[i] = range;
+        if(!light.castsShadows || range <= 0.0f || std::isinf(range)) continue;
+        if(!Culling::boxIntersectsFrustum({light.position - range, light.position + range}, cameraFrustum)) continue;
+
+        // Importance = Projected Size of The Light's Range as A Fraction of The Screen Height
+        const float distance{glm::length(glm::vec3(viewMatrix * glm::vec4(light.position, 1.0f)))};
+        shadowedLight.importance = distance <= range ? 1.0f : std::min(range / (distance * tanHalfFOV), 1.0f);
+
+        // Smallest Tile Covering The Light's Screen Footprint (Kept if Close to The Current Tile to Avoid Reallocating Every Frame)
+        const float idealLevel{std::log2((float)this->resolution / std::max(shadowedLight.importance * screenHeight, 1.0f))};
+        desiredLevels[i] = std::clamp((int)std::floor(idealLevel), minLevel, maxLevel);
+        if(shadowedLight.tileLevel >= 0 && idealLevel > shadowedLight.tileLevel - 0.25f && idealLevel < shadowedLight.tileLevel + 1.25f) desiredLevels[i] = shadowedLight.tileLevel;
+
+        // Lights Stuck With A Smaller Fallback Tile Keep it Until They Want A Different Size (Otherwise They'd Retry and Re-Render Every Frame)
+        if(shadowedLight.tileLevel >= 0 && desiredLevels[i] == shadowedLight.requestedLevel) desiredLevels[i] = shadowedLight.tileLevel;
+    }
+
+    // Free Tiles of Lights That Lost Their Shadow or Changed Tile Size
+    for(std::size_t i = 0; i < lights.size(); i++) {
+        if(this->shadowedLights[i].tileLevel >= 0 && this->shadowedLights[i].tileLevel != desiredLevels[i]) this->freeLightTiles(this->shadowedLights[i]);
+    }
+
+    // Allocate Missing Tiles, Most Important Lights First (Falling Back to Smaller Tiles When The Atlas is Full)
+    FrameVector<std::size_t> lightOrder;
+    for(std::size_t i = 0; i < lights.size(); i++) {
+        if(desiredLevels[i] >= 0) lightOrder.push_back(i);
+    }
+    std::sort(lightOrder.begin(), lightOrder.end(), [&](const std::size_t &a, const std::size_t &b) {return this->shadowedLights[a].importance > this->shadowedLights[b].importance;});
+    for(const std::size_t &i : lightOrder) {
+        ShadowedLightStruct &shadowedLight = this->shadowedLights[i];
+        if(shadowedLight.tileLevel >= 0) continue;
+        const unsigned int tileCount{lights[i].type == LIGHT_TYPE_POINT ? 6u : 1u};
+        for(int level = desiredLevels[i]; level <= maxLevel && shadowedLight.tileLevel < 0; level++) {
+            unsigned int allocatedTileCount{0};
+            while(allocatedTileCount < tileCount && this->allocateTile(level, shadowedLight.tiles[allocatedTileCount])) allocatedTileCount++;
+            if(allocatedTileCount == tileCount) {
+                shadowedLight.tileLevel = level;
+                shadowedLight.requestedLevel = desiredLevels[i];
+                shadowedLight.tileCount = tileCount;
+                shadowedLight.rendered = false;
+            } else {
+                for(unsigned int tile = 0; tile < allocatedTileCount; tile++) this->freeTile(level, shadowedLight.tiles[tile]);
+            }
+        }
+    }
+
+    // Build Light Matrices and Find Dirty Lights (Light Moved, Casters Near it Moved or Tiles Never Rendered)
+    FrameVector<FrameVector<const ShadowCasterStruct*>> lightCasters(lights.size());
+    FrameVector<std::uint64_t> lightHashes(lights.size()), casterHashes(lights.size());
+    FrameVector<std::size_t> nearDirtyLights, distantDirtyLights;
+    for(const std::size_t &i : lightOrder) {
+        ShadowedLightStruct &shadowedLight = this->shadowedLights[i];
+        if(shadowedLight.tileLevel < 0) continue;
+        const LightStruct &light = lights[i];
+        const float range{lightRanges[i]}, nearPlane{std::max(0.05f, range * 0.002f)};
+
+        // Spotlights Look Along Their Cone, Point Lights Render Six 90 Degree Cube Faces
+        if(light.type == LIGHT_TYPE_SPOT) {
+            const glm::vec3 spotDirection{-glm::normalize(light.direction)};
+            const glm::vec3 up{std::abs(spotDirection.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f)};
+            const float coneFOV{std::min(2.0f * std::acos(std::clamp(light.outerCutOff, -1.0f, 1.0f)) + glm::radians(2.0f), glm::radians(170.0f))};
+            shadowedLight.lightPV[0] = glm::perspective(coneFOV, 1.0f, nearPlane, range) * glm::lookAt(light.position, light.position + spotDirection, up);
+            shadowedLight.tanHalfFOV = std::tan(coneFOV * 0.5f);
+        } else {
+            const glm::mat4 faceProjection{glm::perspective(glm::radians(90.0f), 1.0f, nearPlane, range)};
+            for(unsigned int face = 0; face < 6; face++) {
+                shadowedLight.lightPV[face] = faceProjection * glm::lookAt(light.position, light.position + cubeFaceDirections[face], cubeFaceUps[face]);
+            }
+            shadowedLight.tanHalfFOV = 1.0f;
+        }
+
+        // Hash Light and Tile State
+        std::uint64_t lightHash{14695981039346656037ull};
+        lightHash = hashBytes(lightHash, &shadowedLight.tileLevel, sizeof(shadowedLight.tileLevel));
+        lightHash = hashBytes(lightHash, shadowedLight.lightPV, sizeof(glm::mat4) * shadowedLight.tileCount);
+
+        // Gather and Hash Casters Inside The Light's Range
+        const BoundingBox lightBounds{light.position - range, light.position + range};
+        std::uint64_t casterHash{14695981039346656037ull};
+        for(const ShadowCasterStruct &shadowCaster : shadowCasters) {
+            if(glm::any(glm::lessThan(shadowCaster.worldBoundingBox.max, lightBounds.min)) || glm::any(glm::greaterThan(shadowCaster.worldBoundingBox.min, lightBounds.max))) continue;
+            lightCasters[i].push_back(&shadowCaster);
+            casterHash = hashBytes(casterHash, &shadowCaster.model, sizeof(shadowCaster.model));
+            casterHash = hashBytes(casterHash, &shadowCaster.modelMatrix, sizeof(shadowCaster.modelMatrix));
+        }
+        lightHashes[i] = lightHash;
+        casterHashes[i] = casterHash;
+
+        // Queue Dirty Lights - Important Lights Update by Importance, Distant Lights Take Turns
+        if(shadowedLight.rendered && shadowedLight.lightHash == lightHash && shadowedLight.casterHash == casterHash) continue;
+        (shadowedLight.importance >= this->distantLightImportance ? nearDirtyLights : distantDirtyLights).push_back(i);
+    }
+    std::sort(distantDirtyLights.begin(), distantDirtyLights.end());
+    std::rotate(distantDirtyLights.begin(), std::lower_bound(distantDirtyLights.begin(), distantDirtyLights.end(), this->distantLightCursor), distantDirtyLights.end());
+
+    // Spend The Per Frame Tile Update Budget (Lights That Don't Fit Keep Their Old Tiles Until A Later Frame)
+    FrameVector<std::size_t> scheduledLights;
+    unsigned int tileBudget{this->maxTileUpdatesPerFrame};
+    for(const std::size_t &i : nearDirtyLights) {
+        if(this->shadowedLights[i].tileCount > tileBudget) {
+            this->stats.deferredTileCount += this->shadowedLights[i].tileCount;
+            continue;
+        }
+        tileBudget -= this->shadowedLights[i].tileCount;
+        scheduledLights.push_back(i);
+    }
+    for(std::size_t j = 0; j < distantDirtyLights.size(); j++) {
+        const std::size_t i{distantDirtyLights[j]};
+        if(this->shadowedLights[i].tileCount > tileBudget) {
+            // Next Frame Continues The Round Robin From Here
+            this->distantLightCursor = i;
+            for(; j < distantDirtyLights.size(); j++) this->stats.deferredTileCount += this->shadowedLights[distantDirtyLights[j]].tileCount;
+            break;
+        }
+        tileBudget -= this->shadowedLights[i].tileCount;
+        scheduledLights.push_back(i);
+        this->distantLightCursor = i + 1;
+    }
+
+    // Read Back The Shadow Pass GPU Time From An Earlier Frame (Only Once The Result is Available)
+    const unsigned int queryIndex{this->frameIndex++ % 2};
+    if(this->timerQueryPending[queryIndex]) {
+        GLint resultAvailable{0};
+        glGetQueryObjectiv(this->timerQueries[queryIndex], GL_QUERY_RESULT_AVAILABLE, &resultAvailable);
+        if(resultAvailable) {
+            GLuint64 elapsedTime{0};
+            glGetQueryObjectui64v(this->timerQueries[queryIndex], GL_QUERY_RESULT, &elapsedTime);
+            this->stats.gpuTimeMs = elapsedTime / 1000000.0;
+            this->timerQueryPending[queryIndex] = false;
+        }
+    }
+    if(!this->timerQueryPending[0] && !this->timerQueryPending[1] && scheduledLights.empty()) this->stats.gpuTimeMs = 0.0;
+
+    // Render Scheduled Tiles
+    if(!scheduledLights.empty()) {
+        // Depth Only Render State - Scissor Keeps Tile Clears Inside The Tile, Slope Scaled Bias Fights Acne
+        const bool timeShadowPass{!this->timerQueryPending[queryIndex]};
+        if(timeShadowPass) glBeginQuery(GL_TIME_ELAPSED, this->timerQueries[queryIndex]);
+        glBindFramebuffer(GL_FRAMEBUFFER, this->atlas.getFramebufferObject());
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_SCISSOR_TEST);
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(2.0f, 4.0f);
+        depthShader.use();
+
+        // Render Every Tile of Every Scheduled Light
+        for(const std::size_t &i : scheduledLights) {
+            ShadowedLightStruct &shadowedLight = this->shadowedLights[i];
+            for(unsigned int tile = 0; tile < shadowedLight.tileCount; tile++) {
+                this->renderTile(shadowedLight, tile, lightCasters[i], depthShader);
+            }
+            shadowedLight.lightHash = lightHashes[i];
+            shadowedLight.casterHash = casterHashes[i];
+            shadowedLight.rendered = true;
+            this->stats.updatedTileCount += shadowedLight.tileCount;
+        }
+
+        // Restore Render State
+        glDisable(GL_POLYGON_OFFSET_FILL);
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if(timeShadowPass) {
+            glEndQuery(GL_TIME_ELAPSED);
+            this->timerQueryPending[queryIndex] = true;
+        }
+    }
+
+    // Give Every Light With Rendered Tiles A Shadow Index and Upload The Tiles
+    FrameVector<GPUShadowTileStruct> gpuShadowTiles;
+    std::uint64_t allocatedTexels{0};
+    for(std::size_t i = 0; i < lights.size(); i++) {
+        const ShadowedLightStruct &shadowedLight = this->shadowedLights[i];
+        lights[i].shadowIndex = -1;
+        if(shadowedLight.tileLevel < 0) continue;
+
+        // Statistics
+        const unsigned int tileResolution{this->getTileResolution(shadowedLight.tileLevel)};
+        allocatedTexels += (std::uint64_t)tileResolution * tileResolution * shadowedLight.tileCount;
+        this->stats.allocatedTileCount += shadowedLight.tileCount;
+
+        // Tiles That Were Never Rendered Can't Be Sampled Yet
+        if(!shadowedLight.rendered) continue;
+        lights[i].shadowIndex = (int)gpuShadowTiles.size();
+        this->stats.shadowedLightCount++;
+
+        // Atlas Rectangle (Offset and Scale in Texture Coordinates) and World Space Texel Size Per Unit of Distance
+        const float tileScale{(float)tileResolution / this->resolution};
+        const float texelSize{2.0f * shadowedLight.tanHalfFOV / tileResolution};
+        for(unsigned int tile = 0; tile < shadowedLight.tileCount; tile++) {
+            const glm::mat4 &lightPV = shadowedLight.lightPV[tile];
+            gpuShadowTiles.push_back({lightPV, glm::vec4(glm::vec2(shadowedLight.tiles[tile]) * tileScale, tileScale, tileScale), glm::vec4(texelSize, 0.0f, 0.0f, 0.0f)});
+        }
+    }
+    this->stats.occupancy = (float)((double)allocatedTexels / ((double)this->resolution * this->resolution));
+
+    // Upload Shadow Tiles (Orphaning The Old Buffer so The GPU Can Keep Reading Last Frame's Tiles)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->shadowTileSSBO);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, std::max<std::size_t>(gpuShadowTiles.size(), 1) * sizeof(GPUShadowTileStruct), gpuShadowTiles.empty() ? nullptr : gpuShadowTiles.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    GPUMemoryTracker::trackBuffer(this->shadowTileSSBO, std::max<std::size_t>(gpuShadowTiles.size(), 1) * sizeof(GPUShadowTileStruct), "Shadow Atlas Tiles");
+}
+
+// Render Shadow Casters Into One Tile
+void ShadowAtlas::renderTile(const ShadowedLightStruct &shadowedLight, const unsigned int &tile, const FrameVector<const ShadowCasterStruct*> &shadowCasters, Shader &depthShader) {
+    // Restrict Rendering and Clearing to The Tile
+    const unsigned int tileResolution{this->getTileResolution(shadowedLight.tileLevel)};
+    const glm::uvec2 tileOffset{shadowedLight.tiles[tile] * tileResolution};
+    glViewport(tileOffset.x, tileOffset.y, tileResolution, tileResolution);
+    glScissor(tileOffset.x, tileOffset.y, tileResolution, tileResolution);
+    glClear(GL_DEPTH_BUFFER_BIT);
+
+    // Render Casters Inside The Tile's Light Frustum
+    const Frustum lightFrustum{Culling::extractFrustum(shadowedLight.lightPV[tile])};
+    for(const ShadowCasterStruct* shadowCaster : shadowCasters) {
+        if(!Culling::boxIntersectsFrustum(shadowCaster->worldBoundingBox, lightFrustum)) continue;
+        depthShader.setMat4("lightPVM", shadowedLight.lightPV[tile] * shadowCaster->modelMatrix);
+        shadowCaster->model->renderDepth();
+        this->stats.shadowDrawCount++;
+    }
+}
+
+// Bind Atlas to A Texture Unit and The Tile Buffer to Its Storage Buffer Binding
+void ShadowAtlas::setUniforms(Shader &shader, const unsigned int &textureUnit) {
+    // Bind Atlas Depth Texture
+    glActiveTexture(GL_TEXTURE0 + textureUnit);
+    this->atlas.bindShadowMap();
+    glActiveTexture(GL_TEXTURE0);
+    shader.setInt("shadowAtlas", textureUnit);
+
+    // Bind Shadow Tile Storage Buffer Object to The Binding Point Used in lighting.glsl
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, this->shadowTileSSBO);
+}
+
+// Destroy
+void ShadowAtlas::destroy(void) {
+    this->atlas.destroy(false);
+    GPUMemoryTracker::untrack(GL_BUFFER, this->shadowTileSSBO);
+    glDeleteBuffers(1, &this->shadowTileSSBO);
+    glDeleteQueries(2, this->timerQueries);
+}
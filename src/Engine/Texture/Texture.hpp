@@ -10,14 +10,41 @@
 // STB Image
 #include<stb_image.h>
 
+// Custom Engine Headers
+#include"../Memory/GPUMemoryTracker.hpp"
+
+// Decoded Texture Image (Pixels Belong to stb_image, Free Them With Texture::freeImage)
+// Baked Images Are Already Block Compressed - Their Pixels Hold Every Mip Level's Blocks From The Largest Level (compressedFormat is 0 For Uncompressed Images)
+// Baked Images Stored Uncompressed in A Mounted Asset Archive Point Straight Into The Mapped Archive Instead (ownsPixels is false, Freeing Only Resets The Image)
+struct TextureImageStruct {
+    unsigned char* pixels{nullptr};
+    int width{0}, height{0}, channelCount{0};
+    GLenum compressedFormat{0};
+    unsigned int mipLevelCount{1};
+    bool ownsPixels{true};
+};
+
 // Texture Class
 class Texture {
     public:
-        // Create 2D Image Texture
-        void create2DTexture(const std::string textureImageFilePath);
+        // Decode An Image File Read Through The Virtual File System - Safe on Any Thread (The Flip Setting Only Applies to The Calling Thread)
+        // Baked Textures (.btex) Are Read as They Were Baked, Already Flipped or Not
+        static bool loadImage(const std::string &imageFilePath, const bool &flipVertically, TextureImageStruct &image);
+        static void freeImage(TextureImageStruct &image);
+
+        // Create 2D Image Texture (owner Names Who Its Memory is Tracked Under)
+        void create2DTexture(const std::string textureImageFilePath, const char *owner = "Textures");
+
+        // Create 2D Image Texture From A Decoded Image
+        void create2DTexture(const TextureImageStruct &image, const char *owner = "Textures");
+
+        // Create A 2D Texture's Storage (With A Full Mip Chain) Then Upload its Image A Few Rows at A Time so Big Textures Can Be Spread Over Several Frames
+        // Mipmaps Are Generated Once The Last Rows Are Uploaded (Compressed Images Upload Their Baked Mip Levels Instead, Rows Are Rounded Out to Whole Blocks)
+        void allocate2DTexture(const TextureImageStruct &image, const char *owner = "Textures");
+        void upload2DTextureRows(const TextureImageStruct &image, const unsigned int &firstRow, const unsigned int &rowCount);
 
         // Create A Cubemap
-        void createCubemap(const std::vector<std::string> textureImagesFilePaths);
+        void createCubemap(const std::vector<std::string> textureImagesFilePaths, const char *owner = "Textures");
 
         // Getters
         GLuint getTextureObject(void) {return this->texture;}
@@ -27,8 +54,14 @@ class Texture {
         void bindCubemap(void) {glBindTexture(GL_TEXTURE_CUBE_MAP, this->texture);}
 
         // Delete Texture Object
-        void destroy(void) {glDeleteTextures(1, &this->texture);}
+        void destroy(void) {
+            GPUMemoryTracker::untrack(GL_TEXTURE, this->texture);
+            glDeleteTextures(1, &this->texture);
+        }
     private:
         // Texture Object
-        GLuint texture;
+        GLuint texture{0};
+
+        // Upload Rows of A Compressed 2D Texture's Image
+        void uploadCompressed2DTextureRows(const TextureImageStruct &image, const unsigned int &firstRow, const unsigned int &rowCount);
 };
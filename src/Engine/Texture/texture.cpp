@@ -1,62 +1,145 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include"Texture.hpp"
 
-// Create 2D Image Texture
-void Texture::create2DTexture(const std::string textureImageFilePath) {
-    // Create A 2D Texture Object
-    glGenTextures(1, &this->texture);
-    glBindTexture(GL_TEXTURE_2D, this->texture);
-
-    // Flip Texture Images Vertically Upon Loading Them
-    stbi_set_flip_vertically_on_load(true);
-
-    // Load Texture Image File
-    int textureWidth, textureHeight, textureNrChannels;
-    unsigned char* textureImage = stbi_load(textureImageFilePath.c_str(), &textureWidth, &textureHeight, &textureNrChannels, 0);
-    if(textureImage) {
-        // Figure Out Texture Image File Format
-        GLenum textureFormat{};
-        switch(textureNrChannels) {
-            case 3:
-                textureFormat = GL_RGB;
-                break;
-            case 4:
-                textureFormat = GL_RGBA;
-                break;
-        }
+// Standard Headers
+#include<cmath>
+#include<cstdlib>
+#include<algorithm>
 
-        // Load Texture Image Data Into 2D Texture Object
-        glTexImage2D(GL_TEXTURE_2D, 0, textureFormat, textureWidth, textureHeight, 0, textureFormat, GL_UNSIGNED_BYTE, textureImage);
+// Custom Engine Headers
+#include"../Profiler/CPUProfiler.hpp"
+#include"../Jobs/JobSystem.hpp"
+#include"../Memory/GPUMemoryTracker.hpp"
+#include"../Assets/BakedAssets.hpp"
+#include"../Assets/BlockCompression.hpp"
+#include"../Assets/VirtualFileSystem.hpp"
 
-        // Generate Texture Mipmaps
-        glGenerateMipmap(GL_TEXTURE_2D);
+// Pixel Format and Sized Internal Format of An Image With channelCount Channels
+static void getImageFormats(const int &channelCount, GLenum &format, GLenum &internalFormat) {
+    switch(channelCount) {
+        case 1:
+            format = GL_RED;
+            internalFormat = GL_R8;
+            break;
+        case 2:
+            format = GL_RG;
+            internalFormat = GL_RG8;
+            break;
+        case 3:
+            format = GL_RGB;
+            internalFormat = GL_RGB8;
+            break;
+        default:
+            format = GL_RGBA;
+            internalFormat = GL_RGBA8;
+            break;
+    }
+}
+
+// Decode An Image File
+bool Texture::loadImage(const std::string &imageFilePath, const bool &flipVertically, TextureImageStruct &image) {
+    if(BakedAssets::isBakedTexture(imageFilePath)) return BakedAssets::readTexture(imageFilePath, image);
+    FileDataStruct imageFile;
+    if(!VirtualFileSystem::readFile(imageFilePath, imageFile)) return false;
+    CPU_PROFILE_SCOPE("stb_image Decode");
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
+    image.pixels = stbi_load_from_memory(imageFile.data, (int)imageFile.size, &image.width, &image.height, &image.channelCount, 0);
+    return image.pixels != nullptr;
+}
+
+// Free A Decoded Image's Pixels
+void Texture::freeImage(TextureImageStruct &image) {
+    if(image.ownsPixels) image.compressedFormat != 0 ? std::free(image.pixels) : stbi_image_free(image.pixels);
+    image = TextureImageStruct{};
+}
+
+// Create 2D Image Texture
+void Texture::create2DTexture(const std::string textureImageFilePath, const char *owner) {
+    CPU_PROFILE_SCOPE("Texture::create2DTexture");
+
+    // Load Texture Image File (Flipped Vertically)
+    TextureImageStruct image;
+    if(loadImage(textureImageFilePath, true, image)) {
+        this->create2DTexture(image, owner);
     } else {
-        // Delete Texture Object and Display Error Message
-        glDeleteTextures(1, &this->texture);
+        // Display Error Message
         std::cerr << "Failed to Load Texture Image File! Check File Path and Try Again.\n";
     }
 
     // Free Texture Image Data From Memory
-    stbi_image_free(textureImage);
+    freeImage(image);
+}
 
-    // Unbind 2D Texture Object
-    glBindTexture(GL_TEXTURE_2D, 0);
+// Create 2D Image Texture From A Decoded Image
+void Texture::create2DTexture(const TextureImageStruct &image, const char *owner) {
+    this->allocate2DTexture(image, owner);
+    this->upload2DTextureRows(image, 0, image.height);
+}
+
+// Create A 2D Texture's Storage
+void Texture::allocate2DTexture(const TextureImageStruct &image, const char *owner) {
+    GLenum format, internalFormat;
+    getImageFormats(image.channelCount, format, internalFormat);
+    unsigned int mipLevelCount{(unsigned int)std::floor(std::log2(std::max(std::max(image.width, image.height), 1))) + 1};
+    if(image.compressedFormat != 0) {
+        internalFormat = image.compressedFormat;
+        mipLevelCount = image.mipLevelCount;
+    }
+    glCreateTextures(GL_TEXTURE_2D, 1, &this->texture);
+    glTextureStorage2D(this->texture, mipLevelCount, internalFormat, image.width, image.height);
+    GPUMemoryTracker::trackTexture(this->texture, GPU_MEMORY_TEXTURE, internalFormat, image.width, image.height, 1, mipLevelCount, 1, owner);
+}
+
+// Upload Rows of A 2D Texture's Image (Generating Mipmaps Once The Last Rows Are In)
+void Texture::upload2DTextureRows(const TextureImageStruct &image, const unsigned int &firstRow, const unsigned int &rowCount) {
+    if(image.compressedFormat != 0) {
+        this->uploadCompressed2DTextureRows(image, firstRow, rowCount);
+        return;
+    }
+
+    // Rows Are Tightly Packed (RGB Rows Aren't Always A Multiple of 4 Bytes)
+    GLenum format, internalFormat;
+    getImageFormats(image.channelCount, format, internalFormat);
+    const std::size_t rowSize{(std::size_t)image.width * image.channelCount};
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTextureSubImage2D(this->texture, 0, 0, firstRow, image.width, rowCount, format, GL_UNSIGNED_BYTE, image.pixels + firstRow * rowSize);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if(firstRow + rowCount >= (unsigned int)image.height) glGenerateTextureMipmap(this->texture);
+}
+
+// Upload Rows of A Compressed 2D Texture's Top Mip Level (Whole Rows of Blocks Covering The Rows, Then The Smaller Levels Once The Last Rows Are In)
+void Texture::uploadCompressed2DTextureRows(const TextureImageStruct &image, const unsigned int &firstRow, const unsigned int &rowCount) {
+    const std::size_t blockRowBytes{BlockCompression::getMipLevelBytes(image.compressedFormat, image.width, 4, 0)};
+    const unsigned int firstBlockRow{firstRow / 4}, lastRow{std::min((firstRow + rowCount + 3) / 4 * 4, (unsigned int)image.height)};
+    glCompressedTextureSubImage2D(this->texture, 0, 0, firstBlockRow * 4, image.width, lastRow - firstBlockRow * 4, image.compressedFormat, (lastRow - firstBlockRow * 4 + 3) / 4 * blockRowBytes, image.pixels + firstBlockRow * blockRowBytes);
+    if(lastRow < (unsigned int)image.height) return;
+    std::size_t offset{BlockCompression::getMipLevelBytes(image.compressedFormat, image.width, image.height, 0)};
+    for(unsigned int mipLevel = 1; mipLevel < image.mipLevelCount; mipLevel++) {
+        const std::size_t levelBytes{BlockCompression::getMipLevelBytes(image.compressedFormat, image.width, image.height, mipLevel)};
+        glCompressedTextureSubImage2D(this->texture, mipLevel, 0, 0, std::max(image.width >> mipLevel, 1), std::max(image.height >> mipLevel, 1), image.compressedFormat, levelBytes, image.pixels + offset);
+        offset += levelBytes;
+    }
 }
 
 // Create A Cubemap
-void Texture::createCubemap(const std::vector<std::string> textureImagesFilePaths) {
+void Texture::createCubemap(const std::vector<std::string> textureImagesFilePaths, const char *owner) {
+    CPU_PROFILE_SCOPE("Texture::createCubemap");
+
     // Create A Cubemap Texture Object
     glGenTextures(1, &this->texture);
     glBindTexture(GL_TEXTURE_CUBE_MAP, this->texture);
 
-    // Don't Flip Texture Images Vertically Upon Loading Them
-    stbi_set_flip_vertically_on_load(false);
+    // Decode Every Cubemap Texture File in Parallel (Not Flipped Vertically)
+    std::vector<TextureImageStruct> faces(textureImagesFilePaths.size());
+    JobSystem::parallelFor(faces.size(), 1, [&](const std::size_t firstFace, const std::size_t lastFace) {
+        for(std::size_t i = firstFace; i < lastFace; i++) loadImage(textureImagesFilePaths[i], false, faces[i]);
+    }, "Cubemap Decode");
 
     // Load Cubemap Texture Files
-    int textureWidth, textureHeight, textureNrChannels;
     for(unsigned int i = 0; i < textureImagesFilePaths.size(); i++) {
-        // Open Cubemap Texture File
-        unsigned char* textureImage = stbi_load(textureImagesFilePaths[i].c_str(), &textureWidth, &textureHeight, &textureNrChannels, 0);
+        // Decoded Cubemap Texture File
+        unsigned char* textureImage{faces[i].pixels};
+        const int textureWidth{faces[i].width}, textureHeight{faces[i].height}, textureNrChannels{faces[i].channelCount};
 
         // Check if Texture Image File Was Loaded Successfully or Not
         if(textureImage) {
@@ -71,16 +154,25 @@ void Texture::createCubemap(const std::vector<std::string> textureImagesFilePath
                     break;
             }
 
-            // Load Texture Image Data Into Cubemap Texture Object
-            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, textureFormat, textureWidth, textureHeight, 0, textureFormat, GL_UNSIGNED_BYTE, textureImage);
+            // Load Texture Image Data Into Cubemap Texture Object (Baked Faces Upload Their Compressed Top Level)
+            if(faces[i].compressedFormat != 0) {
+                textureFormat = faces[i].compressedFormat;
+                glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, textureFormat, textureWidth, textureHeight, 0, BlockCompression::getMipLevelBytes(textureFormat, textureWidth, textureHeight, 0), textureImage);
+            } else {
+                glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, textureFormat, textureWidth, textureHeight, 0, textureFormat, GL_UNSIGNED_BYTE, textureImage);
+            }
+
+            // Track Texture Memory (Every Face Has The Same Size, Tracking Again Just Replaces The Estimate)
+            GPUMemoryTracker::trackTexture(this->texture, GPU_MEMORY_TEXTURE, textureFormat, textureWidth, textureHeight, 6, 1, 1, owner);
         } else {
             // Display Error Message and Delete Cubemap Texture Object
+            GPUMemoryTracker::untrack(GL_TEXTURE, this->texture);
             glDeleteTextures(1, &this->texture);
             std::cerr << "Failed to Load All Cubemap Texture Images! Check Filepaths and Try Again.\n";
         }
         
         // Free Texture Image Data From Memory
-        stbi_image_free(textureImage);
+        freeImage(faces[i]);
     }
 
     // Unbind Cubemap Texture Object
@@ -1,6 +1,11 @@
 // Standard Headers
 #include<iostream>
 #include<cstdlib>
+#include<memory>
+#include<cstdio>
+#include<chrono>
+#include<thread>
+#include<cassert>
 
 // GLAD OpenGL Loader
 #include<glad/glad.h>
@@ -19,24 +24,52 @@
 
 // Custom Engine Headers
 #include"Engine/Shader/Shader.hpp"
+#include"Engine/Shader/ShaderVariants.hpp"
 #include"Engine/Camera/Camera.hpp"
+#include"Engine/Input/InputQueue.hpp"
+#include"Engine/Input/CameraController.hpp"
 #include"Engine/Texture/Texture.hpp"
 #include"Engine/Framebuffer/Framebuffer.hpp"
 #include"Engine/Model/Model.hpp"
+#include"Engine/Model/ModelStreamer.hpp"
+#include"Engine/Lighting/ClusteredLighting.hpp"
+#include"Engine/Renderer/DeferredRenderer.hpp"
+#include"Engine/Renderer/DepthPrePass.hpp"
+#include"Engine/Renderer/RenderGraph.hpp"
+#include"Engine/Renderer/DynamicResolution.hpp"
+#include"Engine/Renderer/FramePacer.hpp"
+#include"Engine/Renderer/FrameMailbox.hpp"
+#include"Engine/Renderer/FrameSnapshot.hpp"
+#include"Engine/Renderer/UploadThread.hpp"
+#include"Engine/Culling/Culling.hpp"
+#include"Engine/Shadows/CascadedShadowMap.hpp"
+#include"Engine/Shadows/ShadowAtlas.hpp"
+#include"Engine/Shadows/PointShadowMap.hpp"
+#include"Engine/Profiler/GPUProfiler.hpp"
+#include"Engine/Profiler/CPUProfiler.hpp"
+#include"Engine/Platform/HeadlessContext.hpp"
+#include"Engine/Jobs/JobSystem.hpp"
+#include"Engine/Memory/FrameArena.hpp"
+#include"Engine/Memory/GPUMemoryTracker.hpp"
+#include"Engine/Assets/BakedAssets.hpp"
+#include"Engine/Assets/VirtualFileSystem.hpp"
+#include"Engine/Benchmark/Benchmark.hpp"
+#include"Engine/Benchmark/CameraPath.hpp"
 
 // Function Prototypes
 // Process User Input
 void processInput(GLFWwindow* win);
 
+// Path to Load An Asset From (Relative to The Asset Directory)
+std::string getAssetPath(const std::string &relativePath);
+
 // GLFW Callbacks
 void ErrorCallback(int errorCode, const char* errorDesc) {
     // Display GLFW Error Code and Description
     std::cerr << "GLFW Error " << errorCode << ": " << errorDesc << "\n";
 }
-void FramebufferSizeCallback(GLFWwindow*, int newWindowWidth, int newWindowHeight) {
-    // Resize OpenGL Render Viewport Whenever Main Window is Resized
-    glViewport(0, 0, newWindowWidth, newWindowHeight);
-}
+void FramebufferSizeCallback(GLFWwindow*, int newWindowWidth, int newWindowHeight);
+void KeyCallback(GLFWwindow*, int key, int scanCode, int action, int mods);
 void MouseCallback(GLFWwindow*, double xPos, double yPos);
 void ScrollCallback(GLFWwindow*, double xPos, double yPos);
 
@@ -51,8 +84,86 @@ const std::string windowTitle = "LearningOpenGL";
 unsigned int windowWidth{800}, windowHeight{600};
 const bool windowFullscreen{true};
 
-// Delta Time
-float lastTime, currentTime, deltaTime;
+// Headless Config (Renders Into An Offscreen Framebuffer Through EGL Instead of A Window, Also Enabled With --headless)
+// Every headlessFrameDumpInterval'th Frame is Written as A PPM Image (0 Disables)
+bool headlessEnabled{false};
+unsigned int headlessFrameCount{600}, headlessFrameDumpInterval{0};
+const unsigned int headlessWidth{1280}, headlessHeight{720};
+const std::string headlessFrameDumpPath{"frame"};
+
+// Benchmark Config (--benchmark Flies The Camera Along A Scripted Path and Writes Frame Time Percentiles, Draw Counts and Memory as JSON)
+// --camera-path <File> Replaces The Built in Path, --benchmark-output <File> Sets The Report Path, Dynamic Resolution and Vsync Are Off While Benchmarking
+bool benchmarkEnabled{false};
+const unsigned int benchmarkWarmupFrameCount{120}, benchmarkFrameCount{1200};
+std::string benchmarkOutputFilePath{"benchmark.json"}, benchmarkCameraPathFilePath{""};
+const std::vector<CameraKeyframeStruct> benchmarkCameraKeyframes{
+    {0.0f, glm::vec3(0.0f, 0.0f, 5.0f), -90.0f, 0.0f},
+    {5.0f, glm::vec3(5.0f, 1.0f, 0.0f), -180.0f, -10.0f},
+    {10.0f, glm::vec3(0.0f, 2.0f, -5.0f), -270.0f, -15.0f},
+    {15.0f, glm::vec3(-5.0f, 1.0f, 0.0f), -360.0f, -10.0f},
+    {20.0f, glm::vec3(0.0f, 0.0f, 5.0f), -450.0f, 0.0f},
+};
+
+// Headless and Benchmark Frames Advance A Fixed Time Step so Runs Are Reproducible
+const float fixedFrameTime{1.0f / 60.0f};
+
+// Render Target Pool Config (Targets Are Allocated With Headroom so Dragging The Window Edge Doesn't Reallocate Every Frame)
+const unsigned int renderTargetMaxUnusedFrames{60};
+const float renderTargetSizeHeadroom{0.125f};
+
+// Dynamic Resolution Config (The Scene Renders Into A Scaled Region of Its Targets, Sized to Keep GPU Frame Time Under The Target, and is Upscaled by The Quad Pass)
+const bool dynamicResolutionEnabled{true};
+const float dynamicResolutionTargetFrameTimeMs{14.0f}, dynamicResolutionMinScale{0.5f}, dynamicResolutionMaxScale{1.0f};
+
+// Frame Pacing Config (Queued Frames Trade Latency For Throughput - 1 Waits For The GPU Every Frame, 3 Keeps it Busiest, Also Set With --queued-frames)
+// The Frame Rate Limit Only Applies Without Vsync (0 = Unlimited, Also Set With --fps-limit), The Limiter Spins For The Last spinTime Before Each Deadline
+unsigned int queuedFrameCount{2};
+float frameRateLimit{0.0f};
+const float frameLimiterSpinTimeMs{1.5f};
+const unsigned int framePacingStatsWindow{120};
+const bool framePacingStatsLoggingEnabled{true};
+
+// Render Thread Config (The Main Thread Builds Frame Snapshots While The Render Thread Draws The Previous One, 2 = Double Buffered, 3 = Triple Buffered)
+// While Waiting For A Free Snapshot The Main Thread Keeps Polling Window Events Every inputPollInterval so Input Timestamps Stay Accurate
+const unsigned int frameSnapshotBufferCount{2};
+const float inputPollIntervalMs{1.0f};
+
+// Job System Config (0 Workers = One Per Core Besides The Main and Render Threads)
+const unsigned int jobWorkerCount{0};
+const bool jobSystemStatsLoggingEnabled{true};
+
+// Frame Arena Config (Per Thread Bump Allocators For Data That Only Lives For A Frame - Uniform Names, Draw Lists and Sort Buffers, Two Buffers of This Size Per Thread, Light Clustering Alone Needs About 2MB)
+// Builds With The HEAP_TRACKING CMake Option Count Heap Allocations and Assert That Render Frames Make None From beginRead to Present Once Warmed Up (Streaming, Trace Captures, Frame Dumps and Stats Logging Aside)
+const std::size_t frameArenaCapacity{4 * 1024 * 1024};
+const unsigned int heapTrackingWarmupFrames{60};
+
+// GPU Memory Config (Buffers, Textures and Render Targets Are Tracked by Category and Owner, Logged With What The Driver Reports Where it Can - Objects Never Deleted Are Listed at Exit)
+const bool gpuMemoryStatsLoggingEnabled{true};
+
+// Baked Assets Config (Models and Textures Load From Their Baked Files When The assetBaker Tool Has Baked Them - See The bakeAssets CMake Target - Otherwise From The Source Files)
+const bool bakedAssetsEnabled{true};
+const std::string sourceAssetDirectory{"../assets/"}, bakedAssetDirectory{"../bakedAssets/"};
+
+// Asset Archive Config (When The Archive Exists it is Mounted at The Mount Path - See The packAssets CMake Target - and Assets and Shaders Under it Load From The Mapped Archive, Loose Files Otherwise)
+const bool assetArchiveEnabled{true};
+const std::string assetArchiveFilePath{"../game.pak"}, assetArchiveMountPath{"../"};
+
+// Model Streaming Config (Models Import on Job Workers While A Placeholder Box Stands in For Them, Then The Upload Thread Fills Their Buffers and Textures on A Shared Context)
+// Without The Upload Thread The Render Thread Uploads Them Within A Per Frame Budget, Benchmark Runs Finish Streaming Before The First Frame so Every Run Measures The Same Scene
+const bool uploadThreadEnabled{true};
+const std::size_t modelUploadBudgetBytes{4 * 1024 * 1024};
+const float modelUploadBudgetMs{2.0f};
+const bool modelStreamingStatsLoggingEnabled{true};
+
+// Input Config (Camera Movement is Simulated at A Fixed Rate and The Rendered Camera is Interpolated Between Steps)
+const float simulationStepTime{1.0f / 120.0f};
+const unsigned int maxSimulationStepsPerFrame{8};
+
+// Input Queue (Window Callbacks Push Timestamped Events, The Camera Controller Consumes Them)
+InputQueue inputQueue;
+
+// Perspective Camera Near and Far Clipping Planes
+const float camNearPlane{0.1f}, camFarPlane{100.0f};
 
 // Perspective Camera
 Camera perspectiveCamera(glm::vec3(0.0f, 0.0f, 5.0f), moveSpeed, mouseSensitivity, 70.0f, 0.1f, 120.0f);
@@ -65,76 +176,188 @@ const float lightInnerCutOff{15.0f}, lightOuterCutOff{17.0f};
 const glm::vec3 lightAmbientIntensity{glm::vec3(0.2f)}, lightDiffusionIntensity{glm::vec3(0.5f)}, lightSpecularIntensity{glm::vec3(1.0f)};
 const float lightAttenuationConstant{1.0f}, lightAttenuationLinear{0.045f}, lightAttenuationQuadratic{0.0075f};
 
-// Depth Map (For Shadows) Config
-const unsigned int shadowMapWidth{1024}, shadowMapHeight{1024};
+// Clustered Lighting Config
+const bool clusteredLightingEnabled{true};
+const unsigned int clusterCountX{16}, clusterCountY{9}, clusterCountZ{24}, maxLightsPerCluster{128};
 
-// Main
-int main(void) {
-    // Set GLFW Error Callback
-    glfwSetErrorCallback(ErrorCallback);
+// Deferred Shading Config (Uses The Clustered Light Lists and FXAA Instead of MSAA)
+const bool deferredShadingEnabled{false};
 
-    // Initialize GLFW
-    if(!glfwInit()) return EXIT_FAILURE;
+// Depth Pre-Pass Config (Auto Keeps it on While Measured Overdraw is High, Forward Path Only)
+const DepthPrePassMode depthPrePassMode{DEPTH_PRE_PASS_AUTO};
+const float depthPrePassEnableOverdraw{1.5f}, depthPrePassDisableOverdraw{1.2f};
+const unsigned int depthPrePassProbeInterval{120};
 
-    // Set GLFW Window Hints
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+// Demo Point Lights Config (Orbiting The Test Object)
+const unsigned int demoPointLightCount{256};
+const glm::vec3 demoPointLightIntensity{glm::vec3(0.3f)};
+const float demoPointLightAttenuationConstant{1.0f}, demoPointLightAttenuationLinear{0.7f}, demoPointLightAttenuationQuadratic{1.8f};
 
-    // Main Window
-    GLFWwindow* win = nullptr;
-    switch(windowFullscreen) {
-        case true:
-            // Set Window Dimensions to Primary Monitor's Max Dimensions
-            windowWidth = glfwGetVideoMode(glfwGetPrimaryMonitor())->width;
-            windowHeight = glfwGetVideoMode(glfwGetPrimaryMonitor())->height;
-
-            // Create Main Window (Borderless Fullscreen)
-            win = glfwCreateWindow(windowWidth, windowHeight, windowTitle.c_str(), glfwGetPrimaryMonitor(), nullptr);
-
-            // Break
-            break;
-        default:
-            // Create Main Window (Bordered Windowed)
-            win = glfwCreateWindow(windowWidth, windowHeight, windowTitle.c_str(), nullptr, nullptr);
-
-            // Break
-            break;
-    }
+// Directional Light (Sun) Config
+const glm::vec3 sunDirection{-0.4f, -1.0f, -0.3f};
+const glm::vec3 sunAmbientIntensity{glm::vec3(0.05f)}, sunDiffusionIntensity{glm::vec3(0.4f)}, sunSpecularIntensity{glm::vec3(0.5f)};
 
-    // Check if Main Window Was Created Successfully or Not
-    if(win == nullptr) {
-        // Terminate GLFW and Return Error Exit Code
-        glfwTerminate();
-        return EXIT_FAILURE;
-    }
+// Cascaded Shadow Map (Sun Shadows) Config
+const bool shadowsEnabled{true};
+const unsigned int shadowMapResolution{2048}, shadowCascadeCount{4}, shadowMapTextureUnit{8};
+const float shadowCascadeSplitLambda{0.75f}, shadowDistance{40.0f};
 
-    // Set Current OpenGL Render Context
-    glfwMakeContextCurrent(win);
+// Shadow Atlas (Spot and Point Light Shadows, Needs Clustered Lighting) Config
+const bool localLightShadowsEnabled{true}, shadowAtlasStatsLoggingEnabled{true};
+const unsigned int shadowAtlasResolution{4096}, shadowAtlasMinTileResolution{64}, shadowAtlasMaxTileResolution{1024}, shadowAtlasTextureUnit{9};
+const unsigned int maxShadowTileUpdatesPerFrame{24}, shadowCastingDemoPointLightCount{8};
+const float distantShadowLightImportance{0.1f};
 
-    // Initialize GLAD OpenGL Loader
-    if(!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        // Display Error Message
-        std::cerr << "Failed to Initialize GLAD OpenGL Loader!\n";
+// Point Light Shadows (Forward Path Without Clustered Lighting Lights The Test Object With The First Demo Point Light) Config
+const bool pointLightShadowsEnabled{true};
+const unsigned int pointShadowMapResolution{1024}, pointShadowMapTextureUnit{10};
 
-        // Destroy Main Window and Terminate GLFW
-        glfwDestroyWindow(win);
-        glfwTerminate();
+// GPU Profiler Config (Per Pass GPU Times, F12 Captures A Chrome Trace / Perfetto JSON)
+const bool gpuProfilerEnabled{true}, gpuProfilerStatsLoggingEnabled{true};
+const unsigned int gpuProfilerFrameLatency{4}, gpuProfilerMaxScopesPerFrame{64}, gpuProfilerStatsWindow{120}, gpuTraceFrameCount{120};
+const std::string gpuTraceFilePath{"gpuTrace.json"};
 
-        // Return Error Exit Code
-        return EXIT_FAILURE;
-    }
+// CPU Profiler Config (Zones Only Record When Built With The CPU_PROFILER CMake Option, F11 Writes The Last Few Thousand Zones of Every Thread)
+const bool cpuStartupTraceEnabled{true};
+const std::string cpuStartupTraceFilePath{"cpuStartupTrace.json"}, cpuTraceFilePath{"cpuTrace.json"};
 
-    // Set GLFW Callbacks
-    glfwSetFramebufferSizeCallback(win, FramebufferSizeCallback);
-    glfwSetCursorPosCallback(win, MouseCallback);
-    glfwSetScrollCallback(win, ScrollCallback);
+// Main
+int main(int argc, char* argv[]) {
+    CPU_PROFILE_THREAD_NAME("Main Thread");
+
+    // Command Line Arguments (--headless, --frames <Count>, --dump-interval <Frames>, --benchmark, --benchmark-output <File>, --camera-path <File>,
+    // --queued-frames <1-3>, --fps-limit <Frames Per Second>)
+    for(int i = 1; i < argc; i++) {
+        const std::string argument{argv[i]};
+        if(argument == "--headless") headlessEnabled = true;
+        else if(argument == "--frames" && i + 1 < argc) headlessFrameCount = std::strtoul(argv[++i], nullptr, 10);
+        else if(argument == "--dump-interval" && i + 1 < argc) headlessFrameDumpInterval = std::strtoul(argv[++i], nullptr, 10);
+        else if(argument == "--benchmark") benchmarkEnabled = true;
+        else if(argument == "--benchmark-output" && i + 1 < argc) benchmarkOutputFilePath = argv[++i];
+        else if(argument == "--camera-path" && i + 1 < argc) benchmarkCameraPathFilePath = argv[++i];
+        else if(argument == "--queued-frames" && i + 1 < argc) queuedFrameCount = std::strtoul(argv[++i], nullptr, 10);
+        else if(argument == "--fps-limit" && i + 1 < argc) frameRateLimit = std::strtof(argv[++i], nullptr);
+        else std::cerr << "Unknown Argument: " << argument << "\n";
+    }
+    // Main Window or Headless Context
+    GLFWwindow* win = nullptr;
+    HeadlessContext headlessContext(headlessWidth, headlessHeight);
+    if(headlessEnabled) {
+        // Create Headless OpenGL Render Context
+        if(!headlessContext.create()) return EXIT_FAILURE;
+
+        // Initialize GLAD OpenGL Loader and Create The Offscreen Framebuffer Frames Are Rendered Into
+        if(!gladLoadGLLoader((GLADloadproc)HeadlessContext::getProcAddress) || !headlessContext.createFramebuffer()) {
+            // Display Error Message
+            std::cerr << "Failed to Initialize Headless Rendering!\n";
+
+            // Destroy Headless Context and Return Error Exit Code
+            headlessContext.destroy();
+            return EXIT_FAILURE;
+        }
+        windowWidth = headlessWidth;
+        windowHeight = headlessHeight;
+        glViewport(0, 0, windowWidth, windowHeight);
+    } else {
+        // Set GLFW Error Callback
+        glfwSetErrorCallback(ErrorCallback);
+
+        // Initialize GLFW
+        if(!glfwInit()) return EXIT_FAILURE;
+
+        // Set GLFW Window Hints
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+
+        // Main Window
+        switch(windowFullscreen) {
+            case true:
+                // Set Window Dimensions to Primary Monitor's Max Dimensions
+                windowWidth = glfwGetVideoMode(glfwGetPrimaryMonitor())->width;
+                windowHeight = glfwGetVideoMode(glfwGetPrimaryMonitor())->height;
+
+                // Create Main Window (Borderless Fullscreen)
+                win = glfwCreateWindow(windowWidth, windowHeight, windowTitle.c_str(), glfwGetPrimaryMonitor(), nullptr);
+
+                // Break
+                break;
+            default:
+                // Create Main Window (Bordered Windowed)
+                win = glfwCreateWindow(windowWidth, windowHeight, windowTitle.c_str(), nullptr, nullptr);
+
+                // Break
+                break;
+        }
+
+        // Check if Main Window Was Created Successfully or Not
+        if(win == nullptr) {
+            // Terminate GLFW and Return Error Exit Code
+            glfwTerminate();
+            return EXIT_FAILURE;
+        }
+
+        // Set Current OpenGL Render Context
+        glfwMakeContextCurrent(win);
+
+        // Initialize GLAD OpenGL Loader
+        if(!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+            // Display Error Message
+            std::cerr << "Failed to Initialize GLAD OpenGL Loader!\n";
+
+            // Destroy Main Window and Terminate GLFW
+            glfwDestroyWindow(win);
+            glfwTerminate();
+
+            // Return Error Exit Code
+            return EXIT_FAILURE;
+        }
+
+        // Set GLFW Callbacks
+        glfwSetFramebufferSizeCallback(win, FramebufferSizeCallback);
+        glfwSetKeyCallback(win, KeyCallback);
+        glfwSetCursorPosCallback(win, MouseCallback);
+        glfwSetScrollCallback(win, ScrollCallback);
     
-    // Set GLFW Input Mode
-    glfwSetInputMode(win, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+        // Set GLFW Input Mode
+        glfwSetInputMode(win, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+
+        // Enable Vertical Synchronization (Vsync)
+        vsyncEnabled && !benchmarkEnabled ? glfwSwapInterval(1) : glfwSwapInterval(0);
+    }
 
-    // Enable Vertical Synchronization (Vsync)
-    vsyncEnabled ? glfwSwapInterval(1) : glfwSwapInterval(0);
+    // Start The Job System's Workers (Model and Texture Loading Already Use Them)
+    JobSystem::initialize(jobWorkerCount);
+
+    // Mount The Asset Archive Before Anything Loads
+    if(assetArchiveEnabled && VirtualFileSystem::exists(assetArchiveFilePath)) {
+        if(VirtualFileSystem::mountArchive(assetArchiveFilePath, assetArchiveMountPath)) std::cout << "Asset Archive Mounted: " << assetArchiveFilePath << "\n";
+    }
+
+    // Upload Thread - Creates and Fills Buffers and Textures on A Second Context Sharing Objects With The Render Context (A Hidden Window With GLFW)
+    GLFWwindow* uploadWindow = nullptr;
+    std::unique_ptr<UploadThread> uploadThread;
+    if(uploadThreadEnabled) {
+        bool sharedContextCreated{false};
+        if(headlessEnabled) {
+            sharedContextCreated = headlessContext.createSharedContext();
+        } else {
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+            uploadWindow = glfwCreateWindow(1, 1, "Upload Context", nullptr, win);
+            glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+            sharedContextCreated = uploadWindow != nullptr;
+        }
+        if(sharedContextCreated) {
+            uploadThread = std::make_unique<UploadThread>([&](void) -> bool {
+                if(headlessEnabled) return headlessContext.makeSharedContextCurrent();
+                glfwMakeContextCurrent(uploadWindow);
+                return true;
+            }, [&](void) {
+                if(headlessEnabled) headlessContext.releaseCurrent();
+                else glfwMakeContextCurrent(nullptr);
+            });
+        }
+    }
 
     // Enable/Disable OpenGL Functions
     glEnable(GL_DEPTH_TEST);
@@ -180,42 +403,64 @@ int main(void) {
     glEnableVertexAttribArray(1);
     glBindVertexArray(0);
 
-    // Framebuffers
-    // Multisampled Framebuffer
-    Framebuffer msaaFramebuffer(windowWidth, windowHeight, true, 4);
-    msaaFramebuffer.createColorBufferTexture();
-    msaaFramebuffer.createRenderbuffer(GL_DEPTH24_STENCIL8);
+    // Render Graph (Owns Every Screen Sized Render Target - Scene Color/Depth, Their MSAA Versions and The G-Buffer)
+    // Targets Follow The Window Size, Pooled Textures Only Get Reallocated Once A Resize Leaves Their Headroom
+    RenderGraph renderGraph(renderTargetMaxUnusedFrames, renderTargetSizeHeadroom);
+
+    // Dynamic Resolution (GPU Frame Time Controller)
+    DynamicResolution dynamicResolution(dynamicResolutionTargetFrameTimeMs, dynamicResolutionMinScale, dynamicResolutionMaxScale);
+    dynamicResolution.setEnabled(dynamicResolutionEnabled && !benchmarkEnabled);
+
+    // Benchmark and Its Camera Path
+    Benchmark benchmark(benchmarkWarmupFrameCount, benchmarkFrameCount);
+    CameraPath benchmarkCameraPath(benchmarkCameraKeyframes);
+    if(benchmarkEnabled && !benchmarkCameraPathFilePath.empty() && !benchmarkCameraPath.loadFromFile(benchmarkCameraPathFilePath)) benchmarkEnabled = false;
 
-    // Post-Processing Framebuffer
-    Framebuffer postProcessingFramebuffer(windowWidth, windowHeight, false, 0);
-    postProcessingFramebuffer.createColorBufferTexture();
+    // GPU Profiler (Every Render Graph Pass is Timed as A Scope)
+    GPUProfiler gpuProfiler(gpuProfilerFrameLatency, gpuProfilerMaxScopesPerFrame, gpuProfilerStatsWindow);
+    gpuProfiler.setEnabled(gpuProfilerEnabled);
+    renderGraph.setProfiler(&gpuProfiler);
+    float gpuProfilerStatsTime{0.0f};
+    bool gpuTraceKeyHeld{false};
 
-    // Depth Map (For Shadows)
-    Framebuffer depthMap(shadowMapWidth, shadowMapHeight, false, 0);
-    depthMap.createShadowMap();
+    // Frame Pacer (The Frame Rate Limit is Off With Vsync, Headless and While Benchmarking)
+    const bool frameRateLimitEnabled{!vsyncEnabled && !headlessEnabled && !benchmarkEnabled};
+    FramePacer framePacer(queuedFrameCount, frameRateLimitEnabled ? frameRateLimit : 0.0f, frameLimiterSpinTimeMs, framePacingStatsWindow);
+    float framePacingStatsTime{0.0f}, jobSystemStatsTime{0.0f}, modelStreamingStatsTime{0.0f}, gpuMemoryStatsTime{0.0f};
 
-    // Models
-    Model testObject("../assets/models/survivalBackpack/backpack.obj", aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph);
-    Model cubeObject("../assets/models/cube.obj", aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph);
+    // Cascaded Shadow Map (Sun Shadows)
+    CascadedShadowMap cascadedShadowMap(shadowMapResolution, shadowCascadeCount, shadowCascadeSplitLambda, shadowDistance);
+
+    // Shadow Atlas (Spot and Point Light Shadows)
+    ShadowAtlas shadowAtlas(shadowAtlasResolution, shadowAtlasMinTileResolution, shadowAtlasMaxTileResolution, maxShadowTileUpdatesPerFrame, distantShadowLightImportance);
+
+    // Point Shadow Cubemaps (All Six Faces of A Light Rendered in One Layered Pass)
+    PointShadowMap pointShadowMap(pointShadowMapResolution, "../src/shaders/");
+
+    // Models (The Test Object Streams in While Everything Else Loads and The First Frames Render)
+    ModelStreamer modelStreamer(modelUploadBudgetBytes, modelUploadBudgetMs, uploadThread.get());
+    const ModelHandle testObject{modelStreamer.load(getAssetPath("models/survivalBackpack/backpack.obj"), aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph)};
+    Model cubeObject(getAssetPath("models/cube.obj"), aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph);
 
     // Shaders
-    Shader framebufferShaders("../src/shaders/framebufferShaders/vertexShader.glsl", "../src/shaders/framebufferShaders/fragmentShader.glsl");
+    ShaderVariants framebufferShaders("../src/shaders/framebufferShaders/vertexShader.glsl", "../src/shaders/framebufferShaders/fragmentShader.glsl", "", SHADER_KEYWORD_USE_FXAA);
     Shader shadowMapShaders("../src/shaders/shadowMapShaders/vertexShader.glsl", "../src/shaders/shadowMapShaders/fragmentShader.glsl");
     Shader skyboxShaders("../src/shaders/skyboxShaders/vertexShader.glsl", "../src/shaders/skyboxShaders/fragmentShader.glsl");
-    Shader testShaders("../src/shaders/testShaders/vertexShader.glsl", "../src/shaders/testShaders/fragmentShader.glsl", "../src/shaders/testShaders/geometryShader.glsl");
+    ShaderVariants testShaders("../src/shaders/testShaders/vertexShader.glsl", "../src/shaders/testShaders/fragmentShader.glsl", "../src/shaders/testShaders/geometryShader.glsl",
+        SHADER_KEYWORD_USE_GS | SHADER_KEYWORD_LIGHT_DIRECTIONAL | SHADER_KEYWORD_LIGHT_POINT | SHADER_KEYWORD_LIGHT_SPOT | SHADER_KEYWORD_LIGHT_CLUSTERED | SHADER_KEYWORD_HAS_SPECULAR_MAP | SHADER_KEYWORD_SHADOWS_CASCADED | SHADER_KEYWORD_SHADOWS_ATLAS | SHADER_KEYWORD_SHADOWS_POINT);
 
     // Textures
     // Skybox Texture
     const std::vector<std::string> skyboxTextureFilePaths{
-        "../assets/textures/skybox/right.jpg",
-        "../assets/textures/skybox/left.jpg",
-        "../assets/textures/skybox/top.jpg",
-        "../assets/textures/skybox/bottom.jpg",
-        "../assets/textures/skybox/front.jpg",
-        "../assets/textures/skybox/back.jpg",
+        getAssetPath("textures/skybox/right.jpg"),
+        getAssetPath("textures/skybox/left.jpg"),
+        getAssetPath("textures/skybox/top.jpg"),
+        getAssetPath("textures/skybox/bottom.jpg"),
+        getAssetPath("textures/skybox/front.jpg"),
+        getAssetPath("textures/skybox/back.jpg"),
     };
     Texture skyboxTexture;
-    skyboxTexture.createCubemap(skyboxTextureFilePaths);
+    skyboxTexture.createCubemap(skyboxTextureFilePaths, "Skybox");
     skyboxTexture.bindCubemap();
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -224,128 +469,556 @@ int main(void) {
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 
-    // Model and Projection Matrices
-    glm::mat4 modelMatrix, projectionMatrix;
-
-    // Main Loop
-    while(!glfwWindowShouldClose(win)) {
-        // Swap Buffers
-        glfwSwapBuffers(win);
-
-        // Projection Matrix
-        projectionMatrix = glm::mat4(1.0f);
-        projectionMatrix = glm::perspective(glm::radians(perspectiveCamera.getCamFOV()), (float)windowWidth / (float)windowHeight, 0.1f, 100.0f);
-
-        // Enable Depth Testing
-        glEnable(GL_DEPTH_TEST);
-
-        // Bind Depth Map
-        glViewport(0, 0, shadowMapWidth, shadowMapHeight);
-        glBindFramebuffer(GL_FRAMEBUFFER, depthMap.getFramebufferObject());
-
-        // Clear Depth Buffer Bit
-        glClear(GL_DEPTH_BUFFER_BIT);
-
-        // Send Light Model, View and Projection Matrices to Vertex Shader
-
-        // Unbind Framebuffer Object
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-        // Bind Multisampled Framebuffer Object
-        glViewport(0, 0, windowWidth, windowHeight);
-        glBindFramebuffer(GL_FRAMEBUFFER, msaaFramebuffer.getFramebufferObject());
-
-        // Clear Screen
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        // Prepare to Render Test Object
-        testShaders.use();
-
-        // Test Object's Model Matrix
-        modelMatrix = glm::mat4(1.0f);
-
-        // Send Model Matrix and Product of Projection, View and Model Matrix (In Respective Order) to Vertex Shader
-        testShaders.setMat4("modelMatrix", modelMatrix);
-        testShaders.setMat4("pvm", projectionMatrix * perspectiveCamera.getViewMatrix() * modelMatrix);
-
-        // Send Test Object's Material Properties to Fragment Shader
-        testShaders.setFloat("material.shininess", 256.0f);
-
-        // Send Spotlight Properties to Test Object's Fragment Shader
-        // Position and Direction
-        testShaders.setVec3("light.position", perspectiveCamera.getCamPos());
-        testShaders.setVec3("light.direction", -perspectiveCamera.getCamFront());
-
-        // Inner and Outer Cut Off (Light Radius/Size)
-        testShaders.setFloat("light.innerCutOff", glm::cos(glm::radians(lightInnerCutOff)));
-        testShaders.setFloat("light.outerCutOff", glm::cos(glm::radians(lightOuterCutOff)));
-
-        // Intensity Values
-        testShaders.setVec3("light.ambientIntensity", lightAmbientIntensity);
-        testShaders.setVec3("light.diffusionIntensity", lightDiffusionIntensity);
-        testShaders.setVec3("light.specularIntensity", lightSpecularIntensity);
-
-        // Light Attenuation Properties
-        testShaders.setFloat("light.attenuationConstant", lightAttenuationConstant);
-        testShaders.setFloat("light.attenuationLinear", lightAttenuationLinear);
-        testShaders.setFloat("light.attenuationQuadratic", lightAttenuationQuadratic);
-
-        // Render Test Object
-        testObject.render(testShaders);
-
-        // Prepare to Render Skybox Using Cube Object
-        glDepthFunc(GL_LEQUAL);
-        skyboxShaders.use();
-
-        // Set Skybox Object Texture
-        glActiveTexture(GL_TEXTURE0);
-        skyboxTexture.bindCubemap();
+    // Deferred Renderer (Only Created When Deferred Shading is Enabled)
+    std::unique_ptr<DeferredRenderer> deferredRenderer;
+    if(deferredShadingEnabled) deferredRenderer = std::make_unique<DeferredRenderer>("../src/shaders/");
+
+    // Depth Pre-Pass
+    DepthPrePass depthPrePass(depthPrePassMode, depthPrePassEnableOverdraw, depthPrePassDisableOverdraw, depthPrePassProbeInterval, "../src/shaders/");
+
+    // Clustered Lighting
+    ClusteredLighting clusteredLighting(clusterCountX, clusterCountY, clusterCountZ, maxLightsPerCluster);
+
+    // Scene Lights - Camera Spotlight Followed by The Demo Point Lights
+    std::vector<LightStruct> sceneLights(1 + demoPointLightCount);
+    LightStruct &cameraSpotLight = sceneLights[0];
+    cameraSpotLight.type = LIGHT_TYPE_SPOT;
+    cameraSpotLight.innerCutOff = glm::cos(glm::radians(lightInnerCutOff));
+    cameraSpotLight.outerCutOff = glm::cos(glm::radians(lightOuterCutOff));
+    cameraSpotLight.ambientIntensity = lightAmbientIntensity;
+    cameraSpotLight.diffusionIntensity = lightDiffusionIntensity;
+    cameraSpotLight.specularIntensity = lightSpecularIntensity;
+    cameraSpotLight.attenuationConstant = lightAttenuationConstant;
+    cameraSpotLight.attenuationLinear = lightAttenuationLinear;
+    cameraSpotLight.attenuationQuadratic = lightAttenuationQuadratic;
+    for(unsigned int i = 1; i < sceneLights.size(); i++) {
+        // Give Every Demo Point Light A Different Hue
+        const float hue{(float)i / demoPointLightCount};
+        const glm::vec3 lightColor{glm::clamp(glm::abs(glm::mod(hue * 6.0f + glm::vec3(0.0f, 4.0f, 2.0f), 6.0f) - 3.0f) - 1.0f, 0.0f, 1.0f)};
+        sceneLights[i].diffusionIntensity = lightColor * demoPointLightIntensity;
+        sceneLights[i].specularIntensity = lightColor * demoPointLightIntensity;
+        sceneLights[i].attenuationConstant = demoPointLightAttenuationConstant;
+        sceneLights[i].attenuationLinear = demoPointLightAttenuationLinear;
+        sceneLights[i].attenuationQuadratic = demoPointLightAttenuationQuadratic;
+        sceneLights[i].castsShadows = localLightShadowsEnabled && i <= shadowCastingDemoPointLightCount;
+    }
 
-        // Send Product of Projection and View Matrices to Vertex Shader (In Respective Order)
-        skyboxShaders.setMat4("pv", projectionMatrix * glm::mat4(glm::mat3(perspectiveCamera.getViewMatrix())));
+    // Send Sun Properties (and Its Cascaded Shadow Map) to A Shader
+    auto setSunUniforms = [&](Shader &shader) {
+        shader.setVec3("directionalLight.direction", glm::normalize(sunDirection));
+        shader.setVec3("directionalLight.ambientIntensity", sunAmbientIntensity);
+        shader.setVec3("directionalLight.diffusionIntensity", sunDiffusionIntensity);
+        shader.setVec3("directionalLight.specularIntensity", sunSpecularIntensity);
+        if(shadowsEnabled) cascadedShadowMap.setUniforms(shader, shadowMapTextureUnit);
+    };
+    const unsigned int sunKeywords{SHADER_KEYWORD_LIGHT_DIRECTIONAL | (shadowsEnabled ? SHADER_KEYWORD_SHADOWS_CASCADED : SHADER_KEYWORD_NONE)};
 
-        // Render Skybox Texture Object
-        cubeObject.render(skyboxShaders);
-        glDepthFunc(GL_LESS);
+    // Clustered Lights Sample The Shadow Atlas
+    const unsigned int clusteredLightKeywords{SHADER_KEYWORD_LIGHT_CLUSTERED | (localLightShadowsEnabled ? SHADER_KEYWORD_SHADOWS_ATLAS : SHADER_KEYWORD_NONE)};
+    float shadowAtlasStatsTime{0.0f};
 
-        // Copy Everything From MSAA Framebuffer to Intermediary Framebuffer (Downscale)
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, msaaFramebuffer.getFramebufferObject());
-        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, postProcessingFramebuffer.getFramebufferObject());
-        glBlitFramebuffer(0, 0, windowWidth, windowHeight, 0, 0, windowWidth, windowHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    // Without Clustered Lighting The Forward Path Uses The Camera Spotlight and One Point Light
+    const unsigned int forwardLightKeywords{SHADER_KEYWORD_LIGHT_SPOT | SHADER_KEYWORD_LIGHT_POINT | (pointLightShadowsEnabled ? SHADER_KEYWORD_SHADOWS_POINT : SHADER_KEYWORD_NONE)};
 
-        // Unbind Framebuffer Object and Disable Depth Testing
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glDisable(GL_DEPTH_TEST);
+    // Scene Objects (Every Object Casts Shadows, Only Those Inside The Camera Frustum Are Rendered)
+    // The Test Object Never Moves so its Shadows Are Cached
+    struct SceneObjectStruct {
+        ModelHandle model;
+        glm::mat4 modelMatrix{1.0f};
+        bool isStatic{true};
+    };
+    const std::vector<SceneObjectStruct> sceneObjects{
+        {testObject, glm::mat4(1.0f), true},
+    };
 
-        // Clear Default Framebuffer
-        glClear(GL_COLOR_BUFFER_BIT);
+#ifdef CPU_PROFILER_ENABLED
+    // Write A CPU Trace of Startup (Model, Texture and Shader Loading)
+    if(cpuStartupTraceEnabled) CPUProfiler::writeTrace(cpuStartupTraceFilePath);
+    bool cpuTraceKeyHeld{false};
+#endif
 
-        // Prepare to Render Quad Object
-        glBindVertexArray(quadObject);
-        framebufferShaders.use();
+    // Startup File Reads (Streamed Models May Still Be Loading)
+    std::cout << "Virtual File System: " << VirtualFileSystem::getStatsReport() << "\n";
 
-        // Bind Screen Texture to Quad Object
-        glActiveTexture(GL_TEXTURE0);
-        postProcessingFramebuffer.bindColorBufferTexture();
+    // Camera Controller (Fixed Time Step Camera Movement)
+    CameraController cameraController(perspectiveCamera, simulationStepTime, maxSimulationStepsPerFrame);
 
-        // Render Quad Object
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    // Frame Mailbox (Frame Snapshots Built by The Main Thread, Drawn by The Render Thread)
+    FrameMailbox<FrameSnapshotStruct> frameMailbox(frameSnapshotBufferCount);
+    const std::chrono::microseconds inputPollInterval{(long long)(inputPollIntervalMs * 1000.0f)};
 
-        // Unbind Vertex Array Object
-        glBindVertexArray(0);
+    // Current Time in Seconds (Headless and Benchmark Runs Use The Fixed Frame Time Step)
+    unsigned int frameIndex{0};
+    const auto getTime = [&](void) -> double {return headlessEnabled || benchmarkEnabled ? frameIndex * fixedFrameTime : glfwGetTime();};
 
-        // Calculate Delta Time
-        currentTime = glfwGetTime();
-        deltaTime = currentTime - lastTime;
-        lastTime = currentTime;
+    // Keep Running Until The Window Closes, The Headless Frame Count is Reached or The Benchmark Finishes (The Render Thread Closes The Mailbox)
+    const auto isRunning = [&](void) -> bool {
+        if(benchmarkEnabled) return !frameMailbox.isClosed() && (headlessEnabled || !glfwWindowShouldClose(win));
+        return headlessEnabled ? frameIndex < headlessFrameCount : !glfwWindowShouldClose(win);
+    };
 
-        // Process User Input
-        processInput(win);
+    // Render Thread - Owns The OpenGL Context Until Shutdown and Draws Every Published Snapshot in Order
+    unsigned int renderedFrameCount{0};
+    auto renderFrames = [&](void) {
+        CPU_PROFILE_THREAD_NAME("Render Thread");
+        if(headlessEnabled) headlessContext.makeCurrent();
+        else glfwMakeContextCurrent(win);
+        FrameArena::initializeThread(frameArenaCapacity);
+        while(FrameSnapshotStruct *frame = frameMailbox.beginRead()) {
+            // Count This Frame's Heap Allocations From Here Until it is Presented (Work That Hands Over Whole Models or Builds Strings Pauses Counting)
+            const std::uint64_t frameStartHeapAllocationCount{HeapTracker::getThreadAllocationCount()};
+            CPU_PROFILE_SCOPE("Render Frame");
+            FrameArena::beginFrame();
+
+            // This Frame's Camera, Window Size and Lights
+            const glm::mat4 &viewMatrix = frame->camera.viewMatrix, &projectionMatrix = frame->camera.projectionMatrix;
+            const unsigned int windowWidth{frame->windowWidth}, windowHeight{frame->windowHeight};
+            std::vector<LightStruct> &sceneLights = frame->lights;
+            const std::vector<ShadowCasterStruct> &shadowCasters = frame->shadowCasters;
+
+            // Start Measuring This Frame
+            DrawStats::reset();
+            if(benchmarkEnabled) benchmark.beginFrame();
+
+            // Start Timing This Frame on The GPU and Pick The Scene's Render Scale From Earlier Frames' Timings
+            // (Trace Events Are Collected and Written as Frames Are Read Back Here, Which Isn't Counted)
+            const bool gpuTraceCapturing{(gpuProfilerEnabled && frame->gpuTraceRequested) || gpuProfiler.isCapturingTrace()};
+            if(gpuTraceCapturing) HeapTracker::pause();
+            if(gpuProfilerEnabled && frame->gpuTraceRequested) gpuProfiler.captureTrace(gpuTraceFilePath, gpuTraceFrameCount);
+            gpuProfiler.beginFrame();
+            if(gpuTraceCapturing) HeapTracker::resume();
+            dynamicResolution.beginFrame();
+            const float renderScale{dynamicResolution.getScale()};
+            const unsigned int renderWidth{RenderGraph::scaleRenderSize(windowWidth, renderScale)}, renderHeight{RenderGraph::scaleRenderSize(windowHeight, renderScale)};
+
+            // Pick Up Uploads The GPU Has Finished, Then Start Uploading Newly Imported Models (Finished Models Replace Their Placeholders From The Next Snapshot on)
+            {
+                CPU_PROFILE_SCOPE("Model Streaming");
+                GPUProfilerScope modelStreamingScope(gpuProfiler, "Model Uploads");
+                HeapTrackerPauseScope modelStreamingHeapTrackerPause;
+                if(uploadThread) uploadThread->update();
+                modelStreamer.update();
+            }
+
+            // Update Local Light Shadows and Assign Lights to Clusters
+            if(clusteredLightingEnabled || deferredShadingEnabled) {
+
+                // Re-Render Shadow Atlas Tiles of Lights That (Or Whose Casters) Moved, Within The Per Frame Budget
+                // Runs Before Cluster Assignment so Every Light Carries Its Shadow Index to The GPU
+                if(localLightShadowsEnabled) {
+                    CPU_PROFILE_SCOPE("Shadow Atlas");
+                    GPUProfilerScope shadowAtlasScope(gpuProfiler, "Shadow Atlas");
+                    shadowAtlas.update(sceneLights, shadowCasters, shadowMapShaders, viewMatrix, projectionMatrix, windowHeight);
+
+                    // Log Atlas Occupancy and Shadow Cost About Once A Second
+                    if(shadowAtlasStatsLoggingEnabled && frame->time - shadowAtlasStatsTime >= 1.0f) {
+                        HeapTrackerPauseScope statsLoggingHeapTrackerPause;
+                        const ShadowAtlasStatsStruct &stats = shadowAtlas.getStats();
+                        std::cout << "Shadow Atlas: " << stats.shadowedLightCount << " Lights, " << stats.allocatedTileCount << " Tiles, " << stats.occupancy * 100.0f << "% Occupied, "
+                                  << stats.updatedTileCount << " Tiles Updated (" << stats.deferredTileCount << " Deferred), " << stats.shadowDrawCount << " Draws, " << stats.gpuTimeMs << "ms GPU" << std::endl;
+                        shadowAtlasStatsTime = frame->time;
+                    }
+                }
+                CPU_PROFILE_SCOPE("Light Clustering");
+                GPUProfilerScope lightClusteringScope(gpuProfiler, "Light Clustering");
+                clusteredLighting.update(sceneLights, viewMatrix, frame->camera.fov, renderWidth, renderHeight, camNearPlane, camFarPlane);
+            }
+
+            // Enable Depth Testing
+            glEnable(GL_DEPTH_TEST);
+
+            // Build This Frame's Render Graph - Passes Nothing Reads Are Culled and Transient Targets Share Pooled Textures
+            renderGraph.reset();
+            const RenderGraphResource backbuffer{renderGraph.importBackbuffer(windowWidth, windowHeight, headlessContext.getFramebuffer())};
+            RenderGraphResource sceneColor;
+
+            // Render Sun Shadow Cascades (Cascades That Didn't Move Reuse Their Cached Static Shadows)
+            if(shadowsEnabled) {
+                cascadedShadowMap.update(viewMatrix, frame->camera.fov, (float)windowWidth / (float)windowHeight, camNearPlane, sunDirection);
+                renderGraph.addPass("Sun Shadows", {}, {}, [&](RenderGraph&) {
+                    cascadedShadowMap.render(shadowCasters, shadowMapShaders);
+                }, true);
+            }
+
+            // Render Skybox Behind Everything The Scene Pass Drew
+            auto renderSkybox = [&](void) {
+                GPUProfilerScope skyboxScope(gpuProfiler, "Skybox");
+
+                // Prepare to Render Skybox Using Cube Object
+                glDepthFunc(GL_LEQUAL);
+                skyboxShaders.use();
+
+                // Set Skybox Object Texture
+                glActiveTexture(GL_TEXTURE0);
+                skyboxTexture.bindCubemap();
+
+                // Send Product of Projection and View Matrices to Vertex Shader (In Respective Order)
+                skyboxShaders.setMat4("pv", projectionMatrix * glm::mat4(glm::mat3(viewMatrix)));
+
+                // Render Skybox Texture Object
+                cubeObject.render(skyboxShaders);
+                glDepthFunc(GL_LESS);
+            };
+
+            // Deferred Shading - Fill G-Buffer Then Light Every Pixel Once
+            if(deferredShadingEnabled) {
+                // Render Visible Instances Into G-Buffer
+                const RenderGraphResource gAlbedoSpecular{renderGraph.createRenderTarget("G-Buffer Albedo Specular", {windowWidth, windowHeight, DeferredRenderer::albedoSpecularFormat, 0}, renderScale)};
+                const RenderGraphResource gNormalShininess{renderGraph.createRenderTarget("G-Buffer Normal Shininess", {windowWidth, windowHeight, DeferredRenderer::normalShininessFormat, 0}, renderScale)};
+                const RenderGraphResource gDepth{renderGraph.createRenderTarget("G-Buffer Depth", {windowWidth, windowHeight, DeferredRenderer::depthFormat, 0}, renderScale)};
+                renderGraph.addPass("G-Buffer", {}, {gAlbedoSpecular, gNormalShininess, gDepth}, [&](RenderGraph&) {
+                    deferredRenderer->beginGeometryPass();
+                    for(const RenderInstanceStruct &instance : frame->visibleInstances) {
+                        instance.model->render(deferredRenderer->getGeometryShaders(), SHADER_KEYWORD_NONE, [&](Shader &shader) {
+                            shader.setMat4("pvm", projectionMatrix * viewMatrix * instance.modelMatrix);
+                            shader.setFloat("material.shininess", testObjectShininess);
+                        });
+                    }
+                });
+
+                // Light G-Buffer Into Scene Color Then Render Skybox Behind it
+                sceneColor = renderGraph.createRenderTarget("Scene Color", {windowWidth, windowHeight, GL_RGB8, 0}, renderScale);
+                const RenderGraphResource sceneDepth{renderGraph.createRenderTarget("Scene Depth", {windowWidth, windowHeight, GL_DEPTH24_STENCIL8, 0}, renderScale)};
+                renderGraph.addPass("Deferred Lighting", {gAlbedoSpecular, gNormalShininess, gDepth}, {sceneColor, sceneDepth}, [&, gAlbedoSpecular, gNormalShininess, gDepth, sceneColor](RenderGraph &graph) {
+                    const GBufferStruct gBuffer{graph.getTexture(gAlbedoSpecular), graph.getTexture(gNormalShininess), graph.getTexture(gDepth), graph.getFramebuffer(gDepth), renderWidth, renderHeight, graph.getUVScale(gDepth)};
+                    deferredRenderer->renderLightingPass(gBuffer, graph.getFramebuffer(sceneColor), clusteredLighting, projectionMatrix * viewMatrix, frame->camera.position, sunKeywords | clusteredLightKeywords, [&](Shader &shader) {
+                        setSunUniforms(shader);
+                        if(localLightShadowsEnabled) shadowAtlas.setUniforms(shader, shadowAtlasTextureUnit);
+                    });
+                    renderSkybox();
+                });
+            } else {
+                // Render The Forward Point Light's Shadow Cubemap (One Submission Per Caster For All Six Faces)
+                if(!clusteredLightingEnabled && pointLightShadowsEnabled) {
+                    renderGraph.addPass("Point Shadows", {}, {}, [&](RenderGraph&) {
+                        pointShadowMap.render({&sceneLights[1]}, shadowCasters);
+                    }, true);
+                }
+
+                // Scene Color and Depth (Multisampled While MSAA is Enabled)
+                const unsigned int sceneSamples{msaaEnabled ? msaaSamples : 0};
+                const RenderGraphResource sceneColorMS{renderGraph.createRenderTarget("Scene Color", {windowWidth, windowHeight, GL_RGB8, sceneSamples}, renderScale)};
+                const RenderGraphResource sceneDepth{renderGraph.createRenderTarget("Scene Depth", {windowWidth, windowHeight, GL_DEPTH24_STENCIL8, sceneSamples}, renderScale)};
+                renderGraph.addPass("Forward Scene", {}, {sceneColorMS, sceneDepth}, [&](RenderGraph&) {
+                    // Clear Screen
+                    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+                    // Depth Pre-Pass - Lay Down Depth First so The Lighting Shaders Only Run For Visible Fragments
+                    if(depthPrePass.beginFrame()) {
+                        GPUProfilerScope depthPrePassScope(gpuProfiler, "Depth Pre-Pass");
+                        depthPrePass.beginDepthPass();
+                        for(const RenderInstanceStruct &instance : frame->visibleInstances) {
+                            depthPrePass.getShader().setMat4("pvm", projectionMatrix * viewMatrix * instance.modelMatrix);
+                            instance.model->renderDepth();
+                        }
+                        depthPrePass.endDepthPass();
+                    }
+
+                    // Render Visible Instances - Each Mesh Uses The Cheapest Shader Variant Its Material Allows
+                    depthPrePass.beginColorPass();
+                    for(const RenderInstanceStruct &instance : frame->visibleInstances) {
+                        instance.model->render(testShaders, sunKeywords | (clusteredLightingEnabled ? clusteredLightKeywords : forwardLightKeywords), [&](Shader &shader) {
+                            // Send Model Matrix and Product of Projection, View and Model Matrix (In Respective Order) to Vertex Shader
+                            shader.setMat4("modelMatrix", instance.modelMatrix);
+                            shader.setMat4("pvm", projectionMatrix * viewMatrix * instance.modelMatrix);
+
+                            // Send Test Object's Material Properties to Fragment Shader
+                            shader.setFloat("material.shininess", testObjectShininess);
+
+                            // Send Sun Properties to Test Object's Fragment Shader
+                            shader.setVec3("viewPos", frame->camera.position);
+                            setSunUniforms(shader);
+
+                            // Clustered Lighting Reads Every Light From Storage Buffers
+                            if(clusteredLightingEnabled) {
+                                clusteredLighting.setUniforms(shader);
+                                if(localLightShadowsEnabled) shadowAtlas.setUniforms(shader, shadowAtlasTextureUnit);
+                                return;
+                            }
+
+                            // Send Spotlight Properties to Test Object's Fragment Shader
+                            // Position and Direction
+                            shader.setVec3("light.position", frame->camera.position);
+                            shader.setVec3("light.direction", -frame->camera.front);
+
+                            // Inner and Outer Cut Off (Light Radius/Size)
+                            shader.setFloat("light.innerCutOff", glm::cos(glm::radians(lightInnerCutOff)));
+                            shader.setFloat("light.outerCutOff", glm::cos(glm::radians(lightOuterCutOff)));
+
+                            // Intensity Values
+                            shader.setVec3("light.ambientIntensity", lightAmbientIntensity);
+                            shader.setVec3("light.diffusionIntensity", lightDiffusionIntensity);
+                            shader.setVec3("light.specularIntensity", lightSpecularIntensity);
+
+                            // Light Attenuation Properties
+                            shader.setFloat("light.attenuationConstant", lightAttenuationConstant);
+                            shader.setFloat("light.attenuationLinear", lightAttenuationLinear);
+                            shader.setFloat("light.attenuationQuadratic", lightAttenuationQuadratic);
+
+                            // Send Point Light Properties (First Demo Point Light) and Its Shadow Cubemap to Test Object's Fragment Shader
+                            const LightStruct &pointLight = sceneLights[1];
+                            shader.setVec3("pointLight.position", pointLight.position);
+                            shader.setVec3("pointLight.ambientIntensity", pointLight.ambientIntensity);
+                            shader.setVec3("pointLight.diffusionIntensity", pointLight.diffusionIntensity);
+                            shader.setVec3("pointLight.specularIntensity", pointLight.specularIntensity);
+                            shader.setFloat("pointLight.attenuationConstant", pointLight.attenuationConstant);
+                            shader.setFloat("pointLight.attenuationLinear", pointLight.attenuationLinear);
+                            shader.setFloat("pointLight.attenuationQuadratic", pointLight.attenuationQuadratic);
+                            if(pointLightShadowsEnabled) {
+                                shader.setInt("pointLight.shadowIndex", 0);
+                                pointShadowMap.setUniforms(shader, pointShadowMapTextureUnit);
+                            }
+                        });
+                    }
+                    depthPrePass.endColorPass();
+
+                    // Render Skybox
+                    renderSkybox();
+                });
+
+                // Resolve MSAA Scene Color (Downscale) For Post-Processing
+                sceneColor = sceneColorMS;
+                if(msaaEnabled) {
+                    sceneColor = renderGraph.createRenderTarget("Resolved Scene Color", {windowWidth, windowHeight, GL_RGB8, 0}, renderScale);
+                    renderGraph.addPass("MSAA Resolve", {sceneColorMS}, {sceneColor}, [&, sceneColorMS](RenderGraph &graph) {
+                        glBindFramebuffer(GL_READ_FRAMEBUFFER, graph.getFramebuffer(sceneColorMS));
+                        glBlitFramebuffer(0, 0, renderWidth, renderHeight, 0, 0, renderWidth, renderHeight, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+                    });
+                }
+            }
+
+            // Post-Processing - Render Scene Color to The Default Framebuffer With A Quad (Bilinear Filtering Upscales A Scaled Scene)
+            renderGraph.addPass("Post-Processing", {sceneColor}, {backbuffer}, [&, sceneColor](RenderGraph &graph) {
+                // Disable Depth Testing and Clear Default Framebuffer
+                glDisable(GL_DEPTH_TEST);
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                // Prepare to Render Quad Object
+                // Deferred Shading Has No MSAA so it Anti-Aliases in The Quad Pass With FXAA
+                glBindVertexArray(quadObject);
+                Shader &quadShader = framebufferShaders.get(deferredShadingEnabled ? SHADER_KEYWORD_USE_FXAA : SHADER_KEYWORD_NONE);
+                quadShader.use();
+
+                // Bind Screen Texture to Quad Object (Only The Rendered Region of The Pooled Texture is Sampled)
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, graph.getTexture(sceneColor));
+                quadShader.setVec2("uvScale", graph.getUVScale(sceneColor));
+
+                // Render Quad Object
+                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+                DrawStats::recordDraw(2);
+
+                // Unbind Vertex Array Object
+                glBindVertexArray(0);
+            });
+
+            // Cull Unused Passes, Assign Pooled Textures Then Execute
+            {
+                CPU_PROFILE_SCOPE("Render Graph Compile");
+                renderGraph.compile();
+            }
+            renderGraph.execute();
+
+            // Finish Measuring This Frame
+            if(benchmarkEnabled) {
+                benchmark.recordMemory("renderTargetPool", renderGraph.getPooledTextureBytes());
+                benchmark.recordMemory("trackedGPUMemory", GPUMemoryTracker::getTrackedBytes());
+                benchmark.endFrame(DrawStats::get());
+            }
+
+            // Write Headless Frames to Disk
+            if(headlessEnabled && headlessFrameDumpInterval > 0 && (frame->frameIndex + 1) % headlessFrameDumpInterval == 0) {
+                HeapTrackerPauseScope frameDumpHeapTrackerPause;
+                char frameFilePath[256];
+                std::snprintf(frameFilePath, sizeof(frameFilePath), "%s_%05u.ppm", headlessFrameDumpPath.c_str(), frame->frameIndex + 1);
+                headlessContext.writeFrame(frameFilePath);
+            }
+
+            // Stop Timing This Frame on The GPU
+            dynamicResolution.endFrame();
+            gpuProfiler.endFrame();
+
+            // Stats Logging Builds Strings and isn't Counted
+            {
+                HeapTrackerPauseScope statsLoggingHeapTrackerPause;
+
+                // Log Rolling GPU Times of Every Pass About Once A Second
+                if(gpuProfilerEnabled && gpuProfilerStatsLoggingEnabled && frame->time - gpuProfilerStatsTime >= 1.0f) {
+                    std::cout << "GPU Profiler:\n" << gpuProfiler.getStatsReport() << std::flush;
+                    gpuProfilerStatsTime = frame->time;
+                }
+
+                // Log Present Timing About Once A Second
+                if(framePacingStatsLoggingEnabled && frame->time - framePacingStatsTime >= 1.0f) {
+                    std::cout << "Frame Pacing: " << framePacer.getStatsReport() << std::endl;
+                    framePacingStatsTime = frame->time;
+                }
+
+                // Log Job Worker Utilization About Once A Second
+                if(jobSystemStatsLoggingEnabled && frame->time - jobSystemStatsTime >= 1.0f) {
+                    std::cout << "Job System: " << JobSystem::getStatsReport() << std::endl;
+                    jobSystemStatsTime = frame->time;
+                }
+
+                // Log Model Streaming Progress About Once A Second
+                if(modelStreamingStatsLoggingEnabled && frame->time - modelStreamingStatsTime >= 1.0f) {
+                    std::cout << "Model Streaming: " << modelStreamer.getStatsReport() << std::endl;
+                    if(uploadThread) std::cout << "Upload Thread: " << uploadThread->getStatsReport() << std::endl;
+                    modelStreamingStatsTime = frame->time;
+                }
+
+                // Log GPU Memory by Category and Owner About Once A Second
+                if(gpuMemoryStatsLoggingEnabled && frame->time - gpuMemoryStatsTime >= 1.0f) {
+                    std::cout << "GPU Memory: " << GPUMemoryTracker::getStatsReport() << std::flush;
+                    gpuMemoryStatsTime = frame->time;
+                }
+            }
+
+            // Hand The Snapshot Back to The Main Thread Before Presenting so it Can Start Building The Next One
+            frameMailbox.endRead();
+            renderedFrameCount++;
+
+            // Present This Frame, Then Wait Until Few Enough Frames Are Queued on The GPU and The Frame Rate Limit Allows Another
+            framePacer.present([&](void) {
+                if(headlessEnabled) return;
+                CPU_PROFILE_SCOPE("Swap Buffers");
+                glfwSwapBuffers(win);
+            });
+            {
+                CPU_PROFILE_SCOPE("Frame Pacing");
+                framePacer.waitForNextFrame();
+            }
+
+            // Steady State Frames Must Not Touch The Heap - Per Frame Data Belongs in The Frame Arena or in Containers Reused Every Frame
+            // (Only Counted in HEAP_TRACKING Builds, Warm Up Frames Are Still Growing Reused Containers and Pools)
+            if(HeapTracker::isEnabled() && renderedFrameCount > heapTrackingWarmupFrames) {
+                const std::uint64_t frameHeapAllocationCount{HeapTracker::getThreadAllocationCount() - frameStartHeapAllocationCount};
+                if(frameHeapAllocationCount > 0) std::cerr << "Render Frame " << renderedFrameCount - 1 << " Made " << frameHeapAllocationCount << " Heap Allocations!\n";
+                assert(frameHeapAllocationCount == 0);
+            }
+
+            // Stop Both Threads Once The Benchmark Has Measured Every Frame (Snapshots Still Queued Are Skipped)
+            if(benchmarkEnabled && benchmark.isFinished()) {
+                frameMailbox.close();
+                break;
+            }
+        }
+        FrameArena::shutdownThread();
+        if(headlessEnabled) headlessContext.releaseCurrent();
+        else glfwMakeContextCurrent(nullptr);
+    };
 
-        // Poll Events
-        glfwPollEvents();
+    // Benchmarks Measure The Finished Scene
+    if(benchmarkEnabled) modelStreamer.flush();
+
+    // Hand The OpenGL Context to The Render Thread
+    if(headlessEnabled) headlessContext.releaseCurrent();
+    else glfwMakeContextCurrent(nullptr);
+    std::thread renderThread(renderFrames);
+
+    // Main Loop - Poll Input, Simulate and Build A Snapshot of Every Frame While The Render Thread Draws The Previous One
+    while(isRunning()) {
+        CPU_PROFILE_SCOPE("Frame");
+
+        // Wait For A Free Snapshot, Polling Window Events Meanwhile so Input is Timestamped Close to When it Happened
+        FrameSnapshotStruct *frame{nullptr};
+        {
+            CPU_PROFILE_SCOPE("Wait For Render Thread");
+            while(frame == nullptr && !frameMailbox.isClosed()) {
+                if(!headlessEnabled) {
+                    glfwPollEvents();
+                    processInput(win);
+                }
+                frame = frameMailbox.beginWrite(inputPollInterval);
+            }
+        }
+        if(frame == nullptr) break;
+
+        // Sample Input as Late as Possible - Right Before The Camera is Placed and Its Matrices Are Built
+        if(!headlessEnabled) {
+            CPU_PROFILE_SCOPE("Poll Events");
+            glfwPollEvents();
+            processInput(win);
+        }
+
+        // This Frame's Time (Kept in Double Precision so Input Timestamps Compare Exactly)
+        const double currentTime{getTime()};
+
+        // Fly The Camera Along The Benchmark Path, or Simulate The Camera From Queued Input
+        if(benchmarkEnabled) {
+            benchmarkCameraPath.apply(perspectiveCamera, (float)currentTime);
+        } else if(!headlessEnabled) {
+            cameraController.update(inputQueue, currentTime);
+        }
+
+        // Snapshot The Frame's Time, Window Size and Camera
+        frame->frameIndex = frameIndex;
+        frame->time = currentTime;
+        frame->windowWidth = windowWidth;
+        frame->windowHeight = windowHeight;
+        frame->camera.position = perspectiveCamera.getCamPos();
+        frame->camera.front = perspectiveCamera.getCamFront();
+        frame->camera.viewMatrix = perspectiveCamera.getViewMatrix();
+        frame->camera.projectionMatrix = glm::perspective(glm::radians(perspectiveCamera.getCamFOV()), (float)windowWidth / (float)windowHeight, camNearPlane, camFarPlane);
+        frame->camera.fov = perspectiveCamera.getCamFOV();
+
+        // Camera Spotlight Follows The Camera
+        cameraSpotLight.position = frame->camera.position;
+        cameraSpotLight.direction = -frame->camera.front;
+
+        // Demo Point Lights Orbit The Test Object on Rings of Different Radii and Heights
+        for(unsigned int i = 1; i < sceneLights.size(); i++) {
+            const float orbitRadius{3.0f + (float)(i % 8)}, orbitAngle{(float)currentTime * 0.25f + (float)i * 2.399f};
+            sceneLights[i].position = glm::vec3(glm::cos(orbitAngle) * orbitRadius, -2.0f + (float)(i % 5), glm::sin(orbitAngle) * orbitRadius);
+        }
+        frame->lights = sceneLights;
+
+        // Gather Shadow Casters and Cull Scene Objects Against The Camera Frustum
+        {
+            CPU_PROFILE_SCOPE("Frustum Culling");
+            const Frustum frustum{Culling::extractFrustum(frame->camera.projectionMatrix * frame->camera.viewMatrix)};
+            frame->visibleInstances.clear();
+            frame->shadowCasters.clear();
+            for(const SceneObjectStruct &object : sceneObjects) {
+                // Objects Still Streaming Draw The Cube Fitted to Their Bounds (A Unit Cube Until They're Imported, cube.obj Spans -1 to 1)
+                RenderInstanceStruct instance{modelStreamer.getModel(object.model), object.modelMatrix};
+                if(instance.model == nullptr) {
+                    BoundingBox placeholderBounds{glm::vec3(-0.5f), glm::vec3(0.5f)};
+                    modelStreamer.getBoundingBox(object.model, placeholderBounds);
+                    instance.model = &cubeObject;
+                    instance.modelMatrix = object.modelMatrix * glm::translate(glm::mat4(1.0f), (placeholderBounds.min + placeholderBounds.max) * 0.5f) * glm::scale(glm::mat4(1.0f), (placeholderBounds.max - placeholderBounds.min) * 0.5f);
+                }
+                const BoundingBox worldBoundingBox{Culling::transformBoundingBox(instance.model->getBoundingBox(), instance.modelMatrix)};
+                frame->shadowCasters.push_back({instance.model, instance.modelMatrix, object.isStatic, worldBoundingBox});
+                if(Culling::boxIntersectsFrustum(worldBoundingBox, frustum)) frame->visibleInstances.push_back(instance);
+            }
+        }
+
+        // Capture A GPU Trace When F12 is Pressed
+        const bool gpuTraceKeyPressed{!headlessEnabled && glfwGetKey(win, GLFW_KEY_F12) == GLFW_PRESS};
+        frame->gpuTraceRequested = gpuTraceKeyPressed && !gpuTraceKeyHeld;
+        gpuTraceKeyHeld = gpuTraceKeyPressed;
+
+#ifdef CPU_PROFILER_ENABLED
+        // Write A CPU Trace When F11 is Pressed
+        const bool cpuTraceKeyPressed{!headlessEnabled && glfwGetKey(win, GLFW_KEY_F11) == GLFW_PRESS};
+        if(cpuTraceKeyPressed && !cpuTraceKeyHeld) CPUProfiler::writeTrace(cpuTraceFilePath);
+        cpuTraceKeyHeld = cpuTraceKeyPressed;
+#endif
+
+        // Hand The Snapshot to The Render Thread
+        frameMailbox.publish();
+        frameIndex++;
     }
 
+    // Let The Render Thread Draw Every Published Snapshot, Then Take The OpenGL Context Back For Cleanup
+    frameMailbox.close();
+    renderThread.join();
+    if(headlessEnabled) headlessContext.makeCurrent();
+    else glfwMakeContextCurrent(win);
+    if(headlessEnabled) std::cout << "Headless Run Finished: " << renderedFrameCount << " Frames Rendered" << std::endl;
+    if(benchmarkEnabled) benchmark.writeReport(benchmarkOutputFilePath, "Backpack", windowWidth, windowHeight);
+
     // Terminate Program
     // Delete Vertex Array Objects
     glDeleteVertexArrays(1, &quadObject);
@@ -357,46 +1030,93 @@ int main(void) {
     glDeleteBuffers(1, &quadEBO);
 
     // Delete Framebuffers
-    msaaFramebuffer.destroy(true);
-    postProcessingFramebuffer.destroy(false);
-    depthMap.destroy(false);
-
-    // Delete Models
-    testObject.destroy();
+    renderGraph.destroy();
+    dynamicResolution.destroy();
+    gpuProfiler.destroy();
+    framePacer.destroy();
+    benchmark.destroy();
+    cascadedShadowMap.destroy();
+    shadowAtlas.destroy();
+    pointShadowMap.destroy();
+
+    // Finish Uploads Still in Flight and Stop The Upload Thread, Then Delete Models
+    if(uploadThread) uploadThread->destroy();
+    modelStreamer.destroy();
     cubeObject.destroy();
 
     // Delete Shaders
     framebufferShaders.destroy();
+    shadowMapShaders.destroy();
+    depthPrePass.destroy();
     skyboxShaders.destroy();
     testShaders.destroy();
 
     // Delete Textures
     skyboxTexture.destroy();
 
-    // Destroy Main Window and Terminate GLFW
-    glfwDestroyWindow(win);
-    win = nullptr;
-    glfwTerminate();
+    // Delete Clustered Lighting Buffers
+    clusteredLighting.destroy();
+
+    // Delete Deferred Renderer
+    if(deferredRenderer) deferredRenderer->destroy();
+
+    // Destroy Headless Context or Destroy Main Window and Terminate GLFW
+    if(headlessEnabled) {
+        headlessContext.destroy();
+    } else {
+        if(uploadWindow != nullptr) glfwDestroyWindow(uploadWindow);
+        glfwDestroyWindow(win);
+        win = nullptr;
+        glfwTerminate();
+    }
+
+    // List GPU Objects That Were Created But Never Deleted
+    const GPUMemoryStatsStruct leakedGPUMemory{GPUMemoryTracker::getStats()};
+    if(leakedGPUMemory.objectCount > 0) {
+        std::cerr << leakedGPUMemory.objectCount << " GPU Objects (" << leakedGPUMemory.totalBytes << " Bytes) Were Never Deleted!\n";
+        for(const GPUMemoryOwnerStatsStruct &owner : leakedGPUMemory.owners) std::cerr << "  " << owner.owner << ": " << owner.objectCount << " Objects (" << owner.bytes << " Bytes)\n";
+    }
+
+    // Stop The Job System's Workers Then Unmap The Asset Archive (Nothing Reads From it Anymore)
+    JobSystem::shutdown();
+    VirtualFileSystem::unmountAll();
     return EXIT_SUCCESS;
 }
 
+// Path to Load An Asset From - Its Baked File if Baked Assets Are Enabled and it Was Baked, Otherwise The Source File
+std::string getAssetPath(const std::string &relativePath) {
+    return bakedAssetsEnabled ? BakedAssets::resolvePath(sourceAssetDirectory, bakedAssetDirectory, relativePath) : sourceAssetDirectory + relativePath;
+}
+
 // Process User Input
 void processInput(GLFWwindow* win) {
     // Escape Key Pressed (Quit)
     if(glfwGetKey(win, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
         glfwSetWindowShouldClose(win, true);
     }
+}
+
+// Resize Render Targets Whenever Main Window is Resized
+void FramebufferSizeCallback(GLFWwindow*, int newWindowWidth, int newWindowHeight) {
+    // Minimized Windows Report A Zero Size - Keep The Last Size so Render Targets Aren't Dropped
+    if(newWindowWidth <= 0 || newWindowHeight <= 0) return;
+
+    // The Next Frame Snapshot Carries The New Size to The Render Thread (Render Graph Passes Set Their Own Viewports)
+    windowWidth = newWindowWidth;
+    windowHeight = newWindowHeight;
+}
 
-    // Process Camera Movement
-    perspectiveCamera.processKeyboard(win, deltaTime);
+// Queue Key Presses and Releases (Camera Movement Keys Are Held Between Them)
+void KeyCallback(GLFWwindow*, int key, int, int action, int) {
+    inputQueue.push({INPUT_EVENT_KEY, key, action, 0.0, 0.0, glfwGetTime()});
 }
 
-// Process Mouse Movement
+// Queue Mouse Movement
 void MouseCallback(GLFWwindow*, double xPos, double yPos) {
-    perspectiveCamera.processMouseMovement(xPos, yPos);
+    inputQueue.push({INPUT_EVENT_MOUSE_MOVE, 0, 0, xPos, yPos, glfwGetTime()});
 }
 
-// Process Mouse Scroll
+// Queue Mouse Scroll
 void ScrollCallback(GLFWwindow*, double, double yPos) {
-    perspectiveCamera.processMouseScroll(yPos);
+    inputQueue.push({INPUT_EVENT_SCROLL, 0, 0, 0.0, yPos, glfwGetTime()});
 }
@@ -0,0 +1,61 @@
+#version 460 core
+
+// Shader Variant Keywords: LIGHT_CLUSTERED, LIGHT_DIRECTIONAL, SHADOWS_CASCADED, SHADOWS_ATLAS
+#include "../include/lighting.glsl"
+#include "../include/gBuffer.glsl"
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables
+// G-Buffer Textures
+uniform sampler2D gAlbedoSpecular, gNormalShininess, gDepth;
+
+// Fraction of The G-Buffer Textures Covered by The Rendered Region
+uniform vec2 gBufferUVScale;
+
+// Inverse of The Product of Projection and View Matrices (In Respective Order)
+uniform mat4 inversePV;
+
+// Camera Position
+uniform vec3 viewPos;
+
+#ifdef LIGHT_DIRECTIONAL
+// Directional Light
+uniform DirectionalLight directionalLight;
+#endif
+
+// Output
+out vec4 fragColor;
+
+// Main
+void main(void) {
+    // Skip Pixels No Geometry Was Rendered to (The Skybox Fills Them Later)
+    vec2 gBufferCords = texCords * gBufferUVScale;
+    float depth = texture(gDepth, gBufferCords).r;
+    if(depth >= 1.0f) discard;
+
+    // Reconstruct World Space Position From Depth
+    vec4 worldPos = inversePV * vec4(vec3(texCords, depth) * 2.0f - 1.0f, 1.0f);
+    vec3 fragPos = worldPos.xyz / worldPos.w;
+
+    // Decode G-Buffer
+    vec4 albedoSpecular = texture(gAlbedoSpecular, gBufferCords);
+    vec4 normalShininess = texture(gNormalShininess, gBufferCords);
+    vec3 normalizedNormalVector = decodeOctahedralNormal(normalShininess.xy);
+
+    // Accumulate Lighting From Every Light Caster The Variant Was Compiled With
+    vec3 specularColor = vec3(albedoSpecular.a);
+    float shininess = decodeShininess(normalShininess.z);
+    bool hasSpecular = albedoSpecular.a > 0.0f;
+    vec3 color = vec3(0.0f);
+#ifdef LIGHT_DIRECTIONAL
+    color += calculateDirectionalLightForSurface(directionalLight, albedoSpecular.rgb, specularColor, shininess, hasSpecular, normalizedNormalVector, fragPos, viewPos);
+#endif
+#ifdef LIGHT_CLUSTERED
+    color += calculateClusteredLightsForSurface(albedoSpecular.rgb, specularColor, shininess, hasSpecular, normalizedNormalVector, fragPos, viewPos);
+#endif
+
+    // Calculate and Set Final Fragment Color
+    fragColor = vec4(color, 1.0f);
+}
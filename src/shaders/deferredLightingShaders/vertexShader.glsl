@@ -0,0 +1,13 @@
+#version 460 core
+
+// Output
+out vec2 texCords;
+
+// Main
+void main(void) {
+    // Generate A Fullscreen Triangle From The Vertex ID (No Vertex Buffer Needed)
+    texCords = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+
+    // Calculate and Set Final Vertex Position
+    gl_Position = vec4(texCords * 2.0f - 1.0f, 0.0f, 1.0f);
+}
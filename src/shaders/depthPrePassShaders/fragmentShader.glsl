@@ -0,0 +1,4 @@
+#version 460 core
+
+// Main (Depth Only - Nothing to Shade)
+void main(void) {}
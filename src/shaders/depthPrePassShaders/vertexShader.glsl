@@ -0,0 +1,17 @@
+#version 460 core
+
+// Vertex Attributes (Position Only Stream)
+layout(location = 0) in vec3 vertexPos;
+
+// Uniform Variables
+// Product of Projection, View and Model Matrix (In Respective Order)
+uniform mat4 pvm;
+
+// Depth Must Match The Color Pass Exactly For GL_EQUAL Depth Testing
+invariant gl_Position;
+
+// Main
+void main(void) {
+    // Calculate and Set Final Vertex Position
+    gl_Position = pvm * vec4(vertexPos, 1.0f);
+}
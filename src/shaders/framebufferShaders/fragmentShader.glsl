@@ -1,16 +1,73 @@
 #version 460 core
 
+// Shader Variant Keywords: USE_FXAA
+
 // Input
 in vec2 texCords;
 
 // Uniform Variables
 uniform sampler2D screenTexture;
 
+// Fraction of The Screen Texture Covered by The Rendered Region
+uniform vec2 uvScale;
+
 // Output
 out vec4 fragColor;
 
+#ifdef USE_FXAA
+// Fast Approximate Anti-Aliasing (FXAA) Settings
+const float fxaaEdgeThresholdMin = 1.0f / 32.0f, fxaaEdgeThreshold = 1.0f / 8.0f;
+const float fxaaReduceMul = 1.0f / 8.0f, fxaaReduceMin = 1.0f / 128.0f, fxaaSpanMax = 8.0f;
+
+// Luminance of A Color
+float luma(vec3 color) {
+    return dot(color, vec3(0.299f, 0.587f, 0.114f));
+}
+
+// Sample The Screen Texture Without Leaving The Rendered Region
+vec3 sampleScreen(vec2 cords, vec2 texelSize) {
+    return texture(screenTexture, clamp(cords, 0.5f * texelSize, uvScale - 0.5f * texelSize)).rgb;
+}
+
+// Blur Along The Local Edge Direction Where Luminance Contrast is High
+vec3 applyFXAA(vec2 texCords) {
+    vec2 texelSize = 1.0f / vec2(textureSize(screenTexture, 0));
+
+    // Luminance of The Pixel and Its Diagonal Neighbours
+    vec3 colorM = sampleScreen(texCords, texelSize);
+    float lumaNW = luma(sampleScreen(texCords + vec2(-1.0f, 1.0f) * texelSize, texelSize));
+    float lumaNE = luma(sampleScreen(texCords + vec2(1.0f, 1.0f) * texelSize, texelSize));
+    float lumaSW = luma(sampleScreen(texCords + vec2(-1.0f, -1.0f) * texelSize, texelSize));
+    float lumaSE = luma(sampleScreen(texCords + vec2(1.0f, -1.0f) * texelSize, texelSize));
+    float lumaM = luma(colorM);
+
+    // Skip Pixels Without Enough Contrast
+    float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+    if(lumaMax - lumaMin < max(fxaaEdgeThresholdMin, lumaMax * fxaaEdgeThreshold)) return colorM;
+
+    // Edge Direction
+    vec2 dir = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)), (lumaNW + lumaSW) - (lumaNE + lumaSE));
+    float dirReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * 0.25f * fxaaReduceMul, fxaaReduceMin);
+    float rcpDirMin = 1.0f / (min(abs(dir.x), abs(dir.y)) + dirReduce);
+    dir = clamp(dir * rcpDirMin, vec2(-fxaaSpanMax), vec2(fxaaSpanMax)) * texelSize;
+
+    // Sample Along The Edge
+    vec3 colorA = 0.5f * (sampleScreen(texCords + dir * (1.0f / 3.0f - 0.5f), texelSize) + sampleScreen(texCords + dir * (2.0f / 3.0f - 0.5f), texelSize));
+    vec3 colorB = colorA * 0.5f + 0.25f * (sampleScreen(texCords - dir * 0.5f, texelSize) + sampleScreen(texCords + dir * 0.5f, texelSize));
+
+    // Fall Back to The Narrower Blur if The Wider One Left The Local Luminance Range
+    float lumaB = luma(colorB);
+    return (lumaB < lumaMin || lumaB > lumaMax) ? colorA : colorB;
+}
+#endif
+
 // Main
 void main(void) {
     // Calculate and Set Final Fragment Color
+#ifdef USE_FXAA
+    fragColor = vec4(applyFXAA(texCords), 1.0f);
+#else
     fragColor = texture(screenTexture, texCords);
+#endif
 }
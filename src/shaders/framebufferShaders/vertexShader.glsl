@@ -4,6 +4,10 @@
 layout(location = 0) in vec2 vertexPos;
 layout(location = 1) in vec2 textureCords;
 
+// Uniform Variables
+// Fraction of The Screen Texture Covered by The Rendered Region
+uniform vec2 uvScale;
+
 // Output
 out vec2 texCords;
 
@@ -13,5 +17,5 @@ void main(void) {
     gl_Position = vec4(vertexPos.x, vertexPos.y, 0.0f, 1.0f);
 
     // Send Texture Coordinates to Fragment Shader
-    texCords = textureCords;
+    texCords = textureCords * uvScale;
 }
@@ -0,0 +1,26 @@
+#version 460 core
+
+// Shader Variant Keywords: HAS_SPECULAR_MAP
+#include "../include/lighting.glsl"
+#include "../include/gBuffer.glsl"
+
+// Input
+in vec2 texCords;
+in vec3 normalVec;
+
+// Uniform Variables
+uniform Material material;
+
+// Output (G-Buffer Attachments)
+layout(location = 0) out vec4 gAlbedoSpecular;
+layout(location = 1) out vec4 gNormalShininess;
+
+// Main
+void main(void) {
+    // Albedo and Specular Intensity
+    vec3 specularColor = sampleSpecularMap(material, texCords);
+    gAlbedoSpecular = vec4(vec3(texture(material.texture_diffuse1, texCords)), dot(specularColor, vec3(1.0f / 3.0f)));
+
+    // Normal and Shininess
+    gNormalShininess = vec4(encodeOctahedralNormal(normalize(normalVec)), encodeShininess(material.shininess), 0.0f);
+}
@@ -0,0 +1,24 @@
+#version 460 core
+
+// Vertex Attributes
+layout(location = 0) in vec3 vertexPos;
+layout(location = 1) in vec3 vertexNormalVec;
+layout(location = 2) in vec2 textureCords;
+
+// Uniform Variables
+// Product of Projection, View and Model Matrix (In Respective Order)
+uniform mat4 pvm;
+
+// Output to Fragment Shader
+out vec2 texCords;
+out vec3 normalVec;
+
+// Main
+void main(void) {
+    // Calculate and Set Final Vertex Position
+    gl_Position = pvm * vec4(vertexPos, 1.0f);
+
+    // Send Texture Coordinates and Normal Vector to Fragment Shader (Position is Reconstructed From Depth)
+    texCords = textureCords;
+    normalVec = vertexNormalVec;
+}
@@ -0,0 +1,30 @@
+// G-Buffer Layout
+// Attachment 0 (RGBA8)    - Albedo (RGB) and Specular Intensity (A)
+// Attachment 1 (RGB10_A2) - Octahedral Encoded Normal (RG) and Shininess (B)
+// Depth (DEPTH24_STENCIL8) - Positions Are Reconstructed From Depth
+
+// Largest Shininess Value The G-Buffer Can Store (Stored Logarithmically)
+const float gBufferMaxShininess = 1024.0f;
+
+// Octahedral Normal Encoding - Maps A Unit Vector Onto [0, 1]^2
+vec2 encodeOctahedralNormal(vec3 normal) {
+    normal /= abs(normal.x) + abs(normal.y) + abs(normal.z);
+    vec2 encoded = normal.z >= 0.0f ? normal.xy : (1.0f - abs(normal.yx)) * vec2(normal.x >= 0.0f ? 1.0f : -1.0f, normal.y >= 0.0f ? 1.0f : -1.0f);
+    return encoded * 0.5f + 0.5f;
+}
+vec3 decodeOctahedralNormal(vec2 encoded) {
+    encoded = encoded * 2.0f - 1.0f;
+    vec3 normal = vec3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t = clamp(-normal.z, 0.0f, 1.0f);
+    normal.x += normal.x >= 0.0f ? -t : t;
+    normal.y += normal.y >= 0.0f ? -t : t;
+    return normalize(normal);
+}
+
+// Shininess Encoding (Logarithmic so Low Values Keep Their Precision)
+float encodeShininess(float shininess) {
+    return log2(clamp(shininess, 1.0f, gBufferMaxShininess)) / log2(gBufferMaxShininess);
+}
+float decodeShininess(float encoded) {
+    return exp2(encoded * log2(gBufferMaxShininess));
+}
@@ -0,0 +1,405 @@
+// Structures
+// Material
+struct Material {
+    // Lighting Maps
+    sampler2D texture_diffuse1;
+#ifdef HAS_SPECULAR_MAP
+    sampler2D texture_specular1;
+#endif
+
+    // Shininess
+    float shininess;
+};
+
+// Light Casters
+#ifdef LIGHT_DIRECTIONAL
+struct DirectionalLight {
+    // Direction The Light Travels in (From The Light Towards The Scene)
+    vec3 direction;
+
+    // Lighting Intensity Values
+    vec3 ambientIntensity, diffusionIntensity, specularIntensity;
+};
+#endif
+#ifdef LIGHT_POINT
+struct PointLight {
+    // Position
+    vec3 position;
+
+    // Lighting Intensity Values
+    vec3 ambientIntensity, diffusionIntensity, specularIntensity;
+
+    // Lighting Attenuation Values
+    float attenuationConstant, attenuationLinear, attenuationQuadratic;
+#ifdef SHADOWS_POINT
+
+    // Cubemap in The Point Shadow Cubemap Array (-1 = No Shadow)
+    int shadowIndex;
+#endif
+};
+#endif
+#ifdef LIGHT_SPOT
+struct SpotLight {
+    // Position and Direction
+    vec3 position, direction;
+
+    // Inner and Outer Cut Off
+    float innerCutOff, outerCutOff;
+
+    // Lighting Intensity Values
+    vec3 ambientIntensity, diffusionIntensity, specularIntensity;
+
+    // Lighting Attenuation Values
+    float attenuationConstant, attenuationLinear, attenuationQuadratic;
+};
+#endif
+
+// Material Sampling Functions
+vec3 sampleSpecularMap(Material material, vec2 texCords) {
+#ifdef HAS_SPECULAR_MAP
+    return vec3(texture(material.texture_specular1, texCords));
+#else
+    // Materials Without A Specular Map Have No Specular Highlights
+    return vec3(0.0f);
+#endif
+}
+
+// Lighting Calculation Functions
+#ifdef LIGHT_DIRECTIONAL
+#ifdef SHADOWS_CASCADED
+// Cascaded Shadow Map Properties (Cascade Count Must Not Exceed CascadedShadowMap::maxCascadeCount)
+uniform sampler2DArrayShadow cascadeShadowMap;
+uniform int cascadeCount;
+uniform mat4 cascadeViewMatrix;
+uniform mat4 cascadeLightPV[4];
+uniform float cascadeSplits[4];
+
+// Calculate How Much of The Directional Light Reaches A Fragment (0 = Fully Shadowed, 1 = Fully Lit)
+float calculateCascadedShadow(vec3 normalizedNormalVector, vec3 fragPos, vec3 lightDir) {
+    // Pick The First Cascade Whose Split Contains The Fragment's View Space Depth
+    float viewDepth = -(cascadeViewMatrix * vec4(fragPos, 1.0f)).z;
+    int cascade = 0;
+    while(cascade < cascadeCount && viewDepth > cascadeSplits[cascade]) cascade++;
+
+    // Fragments Beyond The Last Cascade Are Lit
+    if(cascade >= cascadeCount) return 1.0f;
+
+    // Offset The Lookup Along The Normal (More at Grazing Angles) to Avoid Shadow Acne
+    float normalOffset = 0.02f * (1.0f - max(dot(normalizedNormalVector, lightDir), 0.0f)) * (float(cascade) + 1.0f);
+    vec4 lightSpacePos = cascadeLightPV[cascade] * vec4(fragPos + normalizedNormalVector * normalOffset, 1.0f);
+    vec3 shadowCoords = lightSpacePos.xyz / lightSpacePos.w * 0.5f + 0.5f;
+
+    // 3x3 Percentage Closer Filtering on Top of Hardware 2x2 PCF
+    vec2 texelSize = 1.0f / vec2(textureSize(cascadeShadowMap, 0).xy);
+    float visibility = 0.0f;
+    for(int x = -1; x <= 1; x++) {
+        for(int y = -1; y <= 1; y++) {
+            visibility += texture(cascadeShadowMap, vec4(shadowCoords.xy + vec2(x, y) * texelSize, float(cascade), clamp(shadowCoords.z, 0.0f, 1.0f)));
+        }
+    }
+    return visibility / 9.0f;
+}
+#endif
+
+// Calculate The Lighting of A Directional Light on A Surface
+vec3 calculateDirectionalLightForSurface(DirectionalLight light, vec3 diffuseColor, vec3 specularColor, float shininess, bool hasSpecular, vec3 normalizedNormalVector, vec3 fragPos, vec3 viewPos) {
+    // Direction From The Fragment Towards The Light
+    vec3 lightDir = normalize(-light.direction);
+
+    // Ambience
+    vec3 ambience = diffuseColor * light.ambientIntensity;
+
+    // Diffusion
+    float diff = max(dot(normalizedNormalVector, lightDir), 0.0f);
+    vec3 diffusion = diffuseColor * diff * light.diffusionIntensity;
+
+    // Specular
+    vec3 specular = vec3(0.0f);
+    if(hasSpecular) {
+        vec3 viewDir = normalize(viewPos - fragPos);
+        vec3 halfwayDir = normalize(lightDir + viewDir);
+        float spec = pow(max(dot(normalizedNormalVector, halfwayDir), 0.0f), shininess);
+        specular = specularColor * spec * light.specularIntensity;
+    }
+
+    // Apply Shadows (Not to Ambience so Shadows Aren't Completely Black)
+#ifdef SHADOWS_CASCADED
+    float visibility = calculateCascadedShadow(normalizedNormalVector, fragPos, lightDir);
+    diffusion *= visibility;
+    specular *= visibility;
+#endif
+
+    // Return Final Fragment Color
+    return vec3(ambience + diffusion + specular);
+}
+vec3 calculateDirectionalLight(DirectionalLight light, Material material, vec2 texCords, vec3 normalizedNormalVector, vec3 fragPos, vec3 viewPos) {
+    vec3 diffuseColor = vec3(texture(material.texture_diffuse1, texCords));
+#ifdef HAS_SPECULAR_MAP
+    return calculateDirectionalLightForSurface(light, diffuseColor, sampleSpecularMap(material, texCords), material.shininess, true, normalizedNormalVector, fragPos, viewPos);
+#else
+    return calculateDirectionalLightForSurface(light, diffuseColor, vec3(0.0f), material.shininess, false, normalizedNormalVector, fragPos, viewPos);
+#endif
+}
+#endif
+#ifdef LIGHT_POINT
+#ifdef SHADOWS_POINT
+// Point Shadow Cubemaps (Size Must Match PointShadowMap::maxLightCount) - Depth Stores Distance to The Light / Far Plane
+uniform samplerCubeArrayShadow pointShadowMaps;
+uniform float pointShadowFarPlanes[8];
+
+// Calculate How Much of A Point Light Reaches A Fragment (0 = Fully Shadowed, 1 = Fully Lit)
+float calculatePointShadow(PointLight light, vec3 normalizedNormalVector, vec3 fragPos, vec3 lightDir) {
+    // Lights Without A Shadow Cubemap Are Unshadowed
+    if(light.shadowIndex < 0) return 1.0f;
+
+    // Offset The Lookup Along The Normal (More at Grazing Angles) to Avoid Shadow Acne
+    float farPlane = pointShadowFarPlanes[light.shadowIndex];
+    vec3 lightToFrag = fragPos + normalizedNormalVector * 0.02f * (1.0f - max(dot(normalizedNormalVector, lightDir), 0.0f)) - light.position;
+
+    // Compare Distances (Hardware 2x2 PCF)
+    return texture(pointShadowMaps, vec4(lightToFrag, float(light.shadowIndex)), clamp(length(lightToFrag) / farPlane - 0.002f, 0.0f, 1.0f));
+}
+#endif
+
+vec3 calculatePointLight(PointLight light, Material material, vec2 texCords, vec3 normalizedNormalVector, vec3 fragPos, vec3 viewPos) {
+    // Calculate Light Attenuation Value
+    float distance = length(light.position - fragPos);
+    float attenuation = 1.0f / (light.attenuationConstant + light.attenuationLinear * distance + light.attenuationQuadratic * (distance * distance));
+
+    // Ambience
+    vec3 diffuseColor = vec3(texture(material.texture_diffuse1, texCords));
+    vec3 ambience = diffuseColor * light.ambientIntensity;
+
+    // Diffusion
+    vec3 lightDir = normalize(light.position - fragPos);
+    float diff = max(dot(normalizedNormalVector, lightDir), 0.0f);
+    vec3 diffusion = diffuseColor * diff * light.diffusionIntensity;
+
+    // Specular
+    vec3 specular = vec3(0.0f);
+#ifdef HAS_SPECULAR_MAP
+    vec3 viewDir = normalize(viewPos - fragPos);
+    vec3 halfwayDir = normalize(lightDir + viewDir);
+    float spec = pow(max(dot(normalizedNormalVector, halfwayDir), 0.0f), material.shininess);
+    specular = sampleSpecularMap(material, texCords) * spec * light.specularIntensity;
+#endif
+
+    // Apply Shadows (Not to Ambience so Shadows Aren't Completely Black)
+#ifdef SHADOWS_POINT
+    float visibility = calculatePointShadow(light, normalizedNormalVector, fragPos, lightDir);
+    diffusion *= visibility;
+    specular *= visibility;
+#endif
+
+    // Apply Light Attenuation Value
+    ambience *= attenuation;
+    diffusion *= attenuation;
+    specular *= attenuation;
+
+    // Return Final Fragment Color
+    return vec3(ambience + diffusion + specular);
+}
+#endif
+#ifdef LIGHT_SPOT
+vec3 calculateSpotLight(SpotLight light, Material material, vec2 texCords, vec3 normalizedNormalVector, vec3 fragPos) {
+    // Calculate Light to Fragment Direction
+    vec3 lightDir = normalize(light.position - fragPos);
+
+    // Calculate Light Intensity Value
+    float theta = dot(lightDir, normalize(light.direction));
+    float epsilon = light.innerCutOff - light.outerCutOff;
+    float lightIntensity = clamp((theta - light.outerCutOff) / epsilon, 0.0f, 1.0f);
+
+    // Calculate Light Attenuation Value
+    float distance = length(light.position - fragPos);
+    float attenuation = 1.0f / (light.attenuationConstant + light.attenuationLinear * distance + light.attenuationQuadratic * (distance * distance));
+
+    // Ambience
+    vec3 diffuseColor = vec3(texture(material.texture_diffuse1, texCords));
+    vec3 ambience = diffuseColor * light.ambientIntensity;
+
+    // Diffusion
+    float diff = max(dot(normalizedNormalVector, lightDir), 0.0f);
+    vec3 diffusion = diffuseColor * diff * light.diffusionIntensity;
+
+    // Specular
+    vec3 specular = vec3(0.0f);
+#ifdef HAS_SPECULAR_MAP
+    vec3 viewDir = normalize(light.position - fragPos);
+    vec3 halfwayDir = normalize(lightDir + viewDir);
+    float spec = pow(max(dot(normalizedNormalVector, halfwayDir), 0.0f), material.shininess);
+    specular = sampleSpecularMap(material, texCords) * spec * light.specularIntensity;
+#endif
+
+    // Apply Light Intensity Value and Light Attenuation Value
+    // Don't Apply Light Intensity Value to Ambient Value so It's Not Completely Black
+    ambience *= attenuation;
+    diffusion *= attenuation;
+    specular *= attenuation;
+    diffusion *= lightIntensity;
+    specular *= lightIntensity;
+
+    // Return Final Fragment Color
+    return vec3(ambience + diffusion + specular);
+}
+#endif
+#ifdef LIGHT_CLUSTERED
+// Clustered Light (Matches GPULightStruct in clusteredLighting.cpp)
+struct ClusteredLight {
+    // Position (xyz) and Range (w)
+    vec4 positionRange;
+
+    // Direction Towards The Light (xyz) and Light Type (w, 0 = Point, 1 = Spot)
+    vec4 directionType;
+
+    // Lighting Intensity Values With Inner (w) and Outer (w) Cut Off Cosines and Shadow Atlas Index (w, -1 = No Shadow)
+    vec4 ambientIntensityInnerCutOff, diffusionIntensityOuterCutOff, specularIntensity;
+
+    // Lighting Attenuation Values (Constant, Linear, Quadratic)
+    vec4 attenuation;
+};
+
+// Light Storage Buffers
+layout(std430, binding = 0) readonly buffer ClusteredLightBuffer {
+    ClusteredLight clusteredLights[];
+};
+layout(std430, binding = 1) readonly buffer ClusterLightGridBuffer {
+    uvec2 clusterLightGrid[];
+};
+layout(std430, binding = 2) readonly buffer ClusterLightIndexBuffer {
+    uint clusterLightIndices[];
+};
+
+#ifdef SHADOWS_ATLAS
+// Shadow Atlas Tile (Matches GPUShadowTileStruct in shadowAtlas.cpp)
+struct ShadowTile {
+    // Light Projection View Matrix
+    mat4 lightPV;
+
+    // Tile Offset (xy) and Scale (zw) in Atlas Texture Coordinates
+    vec4 atlasRect;
+
+    // World Space Texel Size at A Distance of 1 From The Light (x)
+    vec4 texelSize;
+};
+
+// Shadow Atlas and Its Tiles (Spotlights Use One Tile, Point Lights Six Cube Face Tiles)
+uniform sampler2DShadow shadowAtlas;
+layout(std430, binding = 3) readonly buffer ShadowTileBuffer {
+    ShadowTile shadowTiles[];
+};
+
+// Calculate How Much of A Clustered Light Reaches A Fragment (0 = Fully Shadowed, 1 = Fully Lit)
+float calculateAtlasShadow(ClusteredLight light, vec3 normalizedNormalVector, vec3 fragPos, vec3 lightDir, float distance) {
+    // Lights Without A Shadow Tile Are Unshadowed
+    int shadowIndex = int(light.specularIntensity.w);
+    if(shadowIndex < 0) return 1.0f;
+
+    // Point Lights Use The Cube Face Tile Facing The Fragment
+    if(light.directionType.w < 0.5f) {
+        vec3 faceDir = -lightDir;
+        vec3 absFaceDir = abs(faceDir);
+        if(absFaceDir.x >= absFaceDir.y && absFaceDir.x >= absFaceDir.z) shadowIndex += faceDir.x > 0.0f ? 0 : 1;
+        else if(absFaceDir.y >= absFaceDir.z) shadowIndex += faceDir.y > 0.0f ? 2 : 3;
+        else shadowIndex += faceDir.z > 0.0f ? 4 : 5;
+    }
+    ShadowTile shadowTile = shadowTiles[shadowIndex];
+
+    // Offset The Lookup Along The Normal by About A Texel (Texels Grow With Distance From The Light) to Avoid Shadow Acne
+    float normalOffset = 1.5f * shadowTile.texelSize.x * distance * (1.0f - max(dot(normalizedNormalVector, lightDir), 0.0f));
+    vec4 lightSpacePos = shadowTile.lightPV * vec4(fragPos + normalizedNormalVector * normalOffset, 1.0f);
+    vec3 shadowCoords = lightSpacePos.xyz / lightSpacePos.w * 0.5f + 0.5f;
+
+    // Clamp Lookups Half A Texel Inside The Tile so Filtering Never Reads Neighbouring Tiles
+    vec2 halfTexel = 0.5f / vec2(textureSize(shadowAtlas, 0));
+    vec2 atlasCoords = clamp(shadowTile.atlasRect.xy + shadowCoords.xy * shadowTile.atlasRect.zw, shadowTile.atlasRect.xy + halfTexel, shadowTile.atlasRect.xy + shadowTile.atlasRect.zw - halfTexel);
+    return texture(shadowAtlas, vec3(atlasCoords, clamp(shadowCoords.z, 0.0f, 1.0f)));
+}
+#endif
+
+// Cluster Grid Properties
+uniform ivec3 clusterGridSize;
+uniform vec2 clusterScreenSize;
+uniform float clusterZNear, clusterZFar;
+uniform mat4 clusterViewMatrix;
+
+// Find The Cluster A Fragment Belongs to
+uint calculateClusterIndex(vec3 fragPos) {
+    // Exponential Depth Slice From View Space Depth
+    float viewDepth = -(clusterViewMatrix * vec4(fragPos, 1.0f)).z;
+    int slice = int(log(viewDepth / clusterZNear) / log(clusterZFar / clusterZNear) * float(clusterGridSize.z));
+
+    // Screen Space Tile
+    ivec2 tile = ivec2(gl_FragCoord.xy / clusterScreenSize * vec2(clusterGridSize.xy));
+    ivec3 cluster = clamp(ivec3(tile, slice), ivec3(0), clusterGridSize - 1);
+    return uint(cluster.x + clusterGridSize.x * (cluster.y + clusterGridSize.y * cluster.z));
+}
+
+// Calculate The Lighting of Every Light Assigned to A Surface's Cluster
+// Passing A Constant False For hasSpecular Lets The Compiler Drop The Specular Term Entirely
+vec3 calculateClusteredLightsForSurface(vec3 diffuseColor, vec3 specularColor, float shininess, bool hasSpecular, vec3 normalizedNormalVector, vec3 fragPos, vec3 viewPos) {
+    // View Direction (Shared by All Lights)
+    vec3 viewDir = normalize(viewPos - fragPos);
+
+    // Loop Over The Lights in The Fragment's Cluster
+    vec3 color = vec3(0.0f);
+    uvec2 lightList = clusterLightGrid[calculateClusterIndex(fragPos)];
+    for(uint i = 0; i < lightList.y; i++) {
+        ClusteredLight light = clusteredLights[clusterLightIndices[lightList.x + i]];
+
+        // Skip Fragments Outside The Light's Range
+        vec3 lightOffset = light.positionRange.xyz - fragPos;
+        float distance = length(lightOffset);
+        if(distance > light.positionRange.w) continue;
+        vec3 lightDir = lightOffset / distance;
+
+        // Calculate Light Attenuation Value
+        float attenuation = 1.0f / (light.attenuation.x + light.attenuation.y * distance + light.attenuation.z * (distance * distance));
+
+        // Calculate Spotlight Intensity Value (Point Lights Are Always Fully Lit)
+        float lightIntensity = 1.0f;
+        if(light.directionType.w > 0.5f) {
+            float theta = dot(lightDir, light.directionType.xyz);
+            float epsilon = light.ambientIntensityInnerCutOff.w - light.diffusionIntensityOuterCutOff.w;
+            lightIntensity = clamp((theta - light.diffusionIntensityOuterCutOff.w) / epsilon, 0.0f, 1.0f);
+        }
+
+        // Ambience
+        vec3 ambience = diffuseColor * light.ambientIntensityInnerCutOff.rgb;
+
+        // Diffusion
+        float diff = max(dot(normalizedNormalVector, lightDir), 0.0f);
+        vec3 diffusion = diffuseColor * diff * light.diffusionIntensityOuterCutOff.rgb;
+
+        // Specular
+        vec3 specular = vec3(0.0f);
+        if(hasSpecular) {
+            vec3 halfwayDir = normalize(lightDir + viewDir);
+            float spec = pow(max(dot(normalizedNormalVector, halfwayDir), 0.0f), shininess);
+            specular = specularColor * spec * light.specularIntensity.rgb;
+        }
+
+        // Apply Shadows (Skipped For Fragments The Light Doesn't Reach Anyway)
+#ifdef SHADOWS_ATLAS
+        if(diff > 0.0f && lightIntensity > 0.0f) lightIntensity *= calculateAtlasShadow(light, normalizedNormalVector, fragPos, lightDir, distance);
+#endif
+
+        // Apply Light Attenuation Value and Light Intensity Value (Not to Ambience so It's Not Completely Black)
+        color += (ambience + (diffusion + specular) * lightIntensity) * attenuation;
+    }
+
+    // Return Final Fragment Color
+    return color;
+}
+
+// Calculate The Lighting of Every Light Assigned to The Fragment's Cluster
+vec3 calculateClusteredLights(Material material, vec2 texCords, vec3 normalizedNormalVector, vec3 fragPos, vec3 viewPos) {
+    // Sample Material Once For All Lights
+    vec3 diffuseColor = vec3(texture(material.texture_diffuse1, texCords));
+#ifdef HAS_SPECULAR_MAP
+    return calculateClusteredLightsForSurface(diffuseColor, sampleSpecularMap(material, texCords), material.shininess, true, normalizedNormalVector, fragPos, viewPos);
+#else
+    return calculateClusteredLightsForSurface(diffuseColor, vec3(0.0f), material.shininess, false, normalizedNormalVector, fragPos, viewPos);
+#endif
+}
+#endif
@@ -0,0 +1,14 @@
+#version 460 core
+
+// Input
+in vec3 fragPos;
+
+// Uniform Variables
+uniform vec3 lightPos;
+uniform float farPlane;
+
+// Main
+void main(void) {
+    // Store Linear Distance to The Light (Mapped to [0, 1] by The Light's Range) so Lookups Can Compare Distances
+    gl_FragDepth = length(fragPos - lightPos) / farPlane;
+}
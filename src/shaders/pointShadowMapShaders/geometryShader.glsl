@@ -0,0 +1,35 @@
+#version 460 core
+
+// Input Primitive (One Geometry Shader Invocation Per Cube Face)
+layout(triangles, invocations = 6) in;
+
+// Output Primitive
+layout(triangle_strip, max_vertices = 3) out;
+
+// Uniform Variables
+// Light Projection View Matrix of Every Cube Face
+uniform mat4 faceLightPV[6];
+
+// Faces The Caster Touches (Bit i = Face i, Culled on The CPU) and First Layer of The Light's Cubemap
+uniform int faceMask;
+uniform int layerOffset;
+
+// Output to Fragment Shader
+out vec3 fragPos;
+
+// Main
+void main(void) {
+    // Skip Faces The Caster Doesn't Touch
+    if((faceMask & (1 << gl_InvocationID)) == 0) return;
+
+    // Emit The Triangle Into This Invocation's Cube Face
+    for(int i = 0; i != 3; i++) {
+        gl_Layer = layerOffset + gl_InvocationID;
+        fragPos = gl_in[i].gl_Position.xyz;
+        gl_Position = faceLightPV[gl_InvocationID] * gl_in[i].gl_Position;
+        EmitVertex();
+    }
+
+    // End Primitive
+    EndPrimitive();
+}
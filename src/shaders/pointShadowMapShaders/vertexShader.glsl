@@ -0,0 +1,13 @@
+#version 460 core
+
+// Vertex Attributes
+layout(location = 0) in vec3 vertexPos;
+
+// Uniform Variables
+uniform mat4 modelMatrix;
+
+// Main
+void main(void) {
+    // Output World Space Position (The Geometry Shader Projects it Onto Each Cube Face)
+    gl_Position = modelMatrix * vec4(vertexPos, 1.0f);
+}
@@ -1,5 +1,7 @@
 #version 460 core
 
+// Only Compiled Into Shader Variants With The USE_GS Keyword
+
 // Input Primitive
 layout(triangles) in;
 
@@ -1,8 +1,10 @@
 #version 460 core
 
+// Shader Variant Keywords: USE_GS
+
 // Vertex Attributes
 layout(location = 0) in vec3 vertexPos;
-layout(location = 1) in vec3 normalVec;
+layout(location = 1) in vec3 vertexNormalVec;
 layout(location = 2) in vec2 textureCords;
 
 // Uniform Variables
@@ -11,19 +13,35 @@ uniform mat4 modelMatrix;
 // Product of Projection, View and Model Matrix (In Respective Order)
 uniform mat4 pvm;
 
+// Depth Must Match The Depth Pre-Pass Exactly For GL_EQUAL Depth Testing
+invariant gl_Position;
+
+#ifdef USE_GS
 // Output to Geometry Shader
 out vertexShaderOUT {
     vec2 textureCoordinates;
     vec3 normalVector, fragmentPosition;
 } vertex_shader_out;
+#else
+// Output to Fragment Shader (Geometry Stage Dropped)
+out vec2 texCords;
+out vec3 normalVec, fragPos;
+#endif
 
 // Main
 void main(void) {
     // Calculate and Set Final Vertex Position
     gl_Position = pvm * vec4(vertexPos, 1.0f);
 
+#ifdef USE_GS
     // Send Texture Coordinates, Normal Vector and Fragment Position to Geometry Shader
     vertex_shader_out.textureCoordinates = textureCords;
-    vertex_shader_out.normalVector = normalVec;
+    vertex_shader_out.normalVector = vertexNormalVec;
     vertex_shader_out.fragmentPosition = vec3(modelMatrix * vec4(vertexPos, 1.0f));
+#else
+    // Send Texture Coordinates, Normal Vector and Fragment Position to Fragment Shader
+    texCords = textureCords;
+    normalVec = vertexNormalVec;
+    fragPos = vec3(modelMatrix * vec4(vertexPos, 1.0f));
+#endif
 }
@@ -0,0 +1,270 @@
+// Asset Baker - Converts Source Assets Into The Runtime Ready Files The Engine Loads Without Importing or Decoding
+// Usage: assetBaker <Source Directory> <Output Directory> [--force] [--workers N]
+// Models Are Imported Once, Their Meshes Optimized For Vertex Fetch and Quantized (See BakedAssets), Images Are Mipmapped and Block Compressed (See BlockCompression)
+// The Output Directory Mirrors The Source Directory ("models/cube.obj" is Baked as "models/cube.obj.bmodel") so BakedAssets::resolvePath Finds It
+// Images Referenced by A Model Are Baked Flipped Like Model Loading Decodes Them, Every Other Image Unflipped Like Texture::createCubemap Loads It
+// Every Asset's Inputs and Content Hash Are Kept in <Output Directory>/assetBaker.manifest, Only Assets Whose Inputs Changed Are Baked Again
+
+// Standard Headers
+#include<map>
+#include<set>
+#include<mutex>
+#include<atomic>
+#include<thread>
+#include<cctype>
+#include<string>
+#include<vector>
+#include<cstdint>
+#include<cstdlib>
+#include<fstream>
+#include<sstream>
+#include<iomanip>
+#include<iostream>
+#include<filesystem>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../src/Engine/Jobs/JobSystem.hpp"
+#include"../src/Engine/Model/Model.hpp"
+#include"../src/Engine/Texture/Texture.hpp"
+#include"../src/Engine/Assets/BakedAssets.hpp"
+#include"../src/Engine/Assets/BlockCompression.hpp"
+
+// Model File Extensions Baked (Everything Else Except Images is Ignored)
+const std::vector<std::string> modelExtensions{".obj", ".fbx", ".gltf", ".glb", ".dae", ".3ds"};
+
+// Import Flags Every Model is Baked With (The Union of What The Engine Loads Models With, Plus Post Transform Cache Ordering)
+const unsigned int modelProcessFlags{aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph};
+
+// Manifest Entry - An Asset's Inputs (Source Relative, The Asset Itself First) and The Hash of Their Contents When it Was Baked
+struct ManifestEntryStruct {
+    std::uint64_t hash{0};
+    std::vector<std::string> inputs;
+};
+
+// Baker State Shared by Every Job
+std::filesystem::path sourceDirectory, outputDirectory;
+std::mutex bakerMutex;
+std::map<std::string, ManifestEntryStruct> previousManifest, manifest;
+std::set<std::string> claimedImages;
+std::atomic<unsigned int> bakedCount{0}, upToDateCount{0}, failedCount{0};
+
+// Lowercase Extension of A Path
+static std::string getExtension(const std::filesystem::path &filePath) {
+    std::string extension{filePath.extension().string()};
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char character) { return (char)std::tolower(character); });
+    return extension;
+}
+
+// Hash The Baked Format Version and Every Input's Path and Contents (FNV-1a), Missing Inputs Hash as Empty
+static std::uint64_t hashInputs(const std::vector<std::string> &inputs) {
+    std::uint64_t hash{14695981039346656037ull};
+    const auto hashBytes = [&](const char *bytes, const std::size_t &count) {
+        for(std::size_t i = 0; i < count; i++) hash = (hash ^ (unsigned char)bytes[i]) * 1099511628211ull;
+    };
+    hashBytes((const char*)&bakedAssetVersion, sizeof(bakedAssetVersion));
+    std::vector<char> buffer(1 << 16);
+    for(const std::string &input : inputs) {
+        hashBytes(input.c_str(), input.size() + 1);
+        std::ifstream inputFile(sourceDirectory / input, std::ios::binary);
+        while(inputFile.read(buffer.data(), buffer.size()) || inputFile.gcount() > 0) hashBytes(buffer.data(), inputFile.gcount());
+    }
+    return hash;
+}
+
+// Read / Write The Manifest (One Asset Per Line - Hash Then Its Inputs, Tab Separated)
+static void readManifest(void) {
+    std::ifstream manifestFile(outputDirectory / "assetBaker.manifest");
+    std::string line;
+    while(std::getline(manifestFile, line)) {
+        std::stringstream lineStream(line);
+        std::string hash, input;
+        ManifestEntryStruct entry;
+        if(!std::getline(lineStream, hash, '\t')) continue;
+        entry.hash = std::strtoull(hash.c_str(), nullptr, 16);
+        while(std::getline(lineStream, input, '\t')) entry.inputs.push_back(input);
+        if(!entry.inputs.empty()) previousManifest[entry.inputs[0]] = entry;
+    }
+}
+static bool writeManifest(void) {
+    const std::filesystem::path manifestFilePath{outputDirectory / "assetBaker.manifest"}, temporaryFilePath{manifestFilePath.string() + ".tmp"};
+    {
+        std::ofstream manifestFile(temporaryFilePath);
+        for(const auto &[asset, entry] : manifest) {
+            manifestFile << std::hex << std::setw(16) << std::setfill('0') << entry.hash;
+            for(const std::string &input : entry.inputs) manifestFile << '\t' << input;
+            manifestFile << '\n';
+        }
+        if(!manifestFile) return false;
+    }
+    std::error_code error;
+    std::filesystem::rename(temporaryFilePath, manifestFilePath, error);
+    return !error;
+}
+
+// Check if An Asset's Baked File Exists and Its Inputs Are Unchanged Since it Was Baked (Carrying Its Entry Over if So)
+static bool isUpToDate(const std::string &asset) {
+    const auto previousEntry{previousManifest.find(asset)};
+    if(previousEntry == previousManifest.end() || !std::filesystem::exists(outputDirectory / BakedAssets::getBakedFilePath(asset))) return false;
+    if(hashInputs(previousEntry->second.inputs) != previousEntry->second.hash) return false;
+    std::lock_guard<std::mutex> lock(bakerMutex);
+    manifest[asset] = previousEntry->second;
+    return true;
+}
+
+// Record A Baked Asset's Inputs
+static void recordBaked(const std::vector<std::string> &inputs) {
+    ManifestEntryStruct entry{hashInputs(inputs), inputs};
+    std::lock_guard<std::mutex> lock(bakerMutex);
+    manifest[inputs[0]] = entry;
+}
+
+// Compress and Write A Decoded Image (Replacing it With its Compressed Blocks)
+static bool bakeImage(const std::string &asset, TextureImageStruct &image) {
+    TextureImageStruct compressedImage;
+    if(!BlockCompression::compress(image, compressedImage)) return false;
+    Texture::freeImage(image);
+    image = compressedImage;
+    const std::filesystem::path bakedFilePath{outputDirectory / BakedAssets::getBakedFilePath(asset)};
+    std::filesystem::create_directories(bakedFilePath.parent_path());
+    return BakedAssets::writeTexture(bakedFilePath.string(), image);
+}
+
+// Material Libraries An OBJ File Names (Their Contents Change The Baked Model Too)
+static void gatherMaterialLibraries(const std::string &asset, std::vector<std::string> &inputs) {
+    std::ifstream objFile(sourceDirectory / asset);
+    std::string line;
+    while(std::getline(objFile, line)) {
+        if(line.rfind("mtllib ", 0) != 0) continue;
+        std::string library{line.substr(7)};
+        while(!library.empty() && std::isspace((unsigned char)library.back())) library.pop_back();
+        inputs.push_back((std::filesystem::path(asset).parent_path() / library).lexically_normal().generic_string());
+    }
+}
+
+// Bake A Model and The Images it References
+static void bakeModel(const std::string &asset) {
+    if(isUpToDate(asset)) {
+        upToDateCount++;
+        return;
+    }
+
+    // Import, Optimize and Gather The Inputs
+    ModelDataStruct modelData;
+    if(!Model::importModel((sourceDirectory / asset).string(), modelProcessFlags, modelData)) {
+        std::cerr << "Failed to Bake Model: " << asset << "\n";
+        failedCount++;
+        return;
+    }
+    for(ModelMeshDataStruct &mesh : modelData.meshes) BakedAssets::optimizeVertexFetch(mesh);
+    std::vector<std::string> inputs{asset};
+    if(getExtension(asset) == ".obj") gatherMaterialLibraries(asset, inputs);
+
+    // Bake Every Texture Not Already Claimed by Another Model (Textures Must Stay Inside The Source Directory to Keep Their Relative Paths)
+    bool succeeded{true};
+    for(ModelTextureDataStruct &texture : modelData.textures) {
+        const std::string image{(std::filesystem::path(asset).parent_path() / texture.path).lexically_normal().generic_string()};
+        if(image.rfind("..", 0) == 0) {
+            std::cerr << "Texture Outside The Source Directory: " << image << " (Used by " << asset << ")\n";
+            succeeded = false;
+            continue;
+        }
+        inputs.push_back(image);
+        texture.path = BakedAssets::getBakedFilePath(texture.path);
+        bool claimed;
+        {
+            std::lock_guard<std::mutex> lock(bakerMutex);
+            claimed = claimedImages.insert(image).second;
+        }
+        if(claimed && (!texture.image.pixels || !bakeImage(image, texture.image))) {
+            std::cerr << "Failed to Bake Texture: " << image << " (Used by " << asset << ")\n";
+            succeeded = false;
+        }
+    }
+
+    // Write The Baked Model
+    const std::filesystem::path bakedFilePath{outputDirectory / BakedAssets::getBakedFilePath(asset)};
+    std::filesystem::create_directories(bakedFilePath.parent_path());
+    if(succeeded && BakedAssets::writeModel(bakedFilePath.string(), modelData)) {
+        recordBaked(inputs);
+        bakedCount++;
+    } else {
+        std::cerr << "Failed to Bake Model: " << asset << "\n";
+        failedCount++;
+    }
+    Model::freeModelData(modelData);
+}
+
+// Bake An Image No Model References
+static void bakeStandaloneImage(const std::string &asset) {
+    if(isUpToDate(asset)) {
+        upToDateCount++;
+        return;
+    }
+    TextureImageStruct image;
+    if(Texture::loadImage((sourceDirectory / asset).string(), false, image) && bakeImage(asset, image)) {
+        recordBaked({asset});
+        bakedCount++;
+    } else {
+        std::cerr << "Failed to Bake Image: " << asset << "\n";
+        failedCount++;
+    }
+    Texture::freeImage(image);
+}
+
+int main(int argc, char* argv[]) {
+    if(argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <Source Directory> <Output Directory> [--force] [--workers N]\n";
+        return 2;
+    }
+    sourceDirectory = argv[1];
+    outputDirectory = argv[2];
+    bool force{false};
+    unsigned int workerCount{std::max(std::thread::hardware_concurrency(), 2u) - 1};
+    for(int i = 3; i < argc; i++) {
+        const std::string argument{argv[i]};
+        if(argument == "--force") force = true;
+        else if(argument == "--workers" && i + 1 < argc) workerCount = std::max(std::atoi(argv[++i]), 1);
+    }
+    if(!std::filesystem::is_directory(sourceDirectory)) {
+        std::cerr << "Source Directory Not Found: " << sourceDirectory << "\n";
+        return 2;
+    }
+    std::filesystem::create_directories(outputDirectory);
+    if(!force) readManifest();
+
+    // Gather The Source Assets
+    std::vector<std::string> models, images;
+    for(const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(sourceDirectory)) {
+        if(!entry.is_regular_file()) continue;
+        const std::string asset{entry.path().lexically_normal().lexically_relative(sourceDirectory.lexically_normal()).generic_string()};
+        const std::string extension{getExtension(entry.path())};
+        if(std::find(modelExtensions.begin(), modelExtensions.end(), extension) != modelExtensions.end()) models.push_back(asset);
+        else if(BakedAssets::isImageFile(asset)) images.push_back(asset);
+    }
+
+    // Bake Every Model as Its Own Job (Imports, Mesh Conversion and Compression Split Further Across The Workers)
+    JobSystem::initialize(workerCount);
+    JobCounterStruct modelCounter;
+    for(const std::string &model : models) JobSystem::run([&model](void) { bakeModel(model); }, &modelCounter, "Bake Model");
+    JobSystem::wait(modelCounter);
+
+    // Images Used by Up to Date Models Are Still Theirs, Bake The Rest Unflipped
+    for(const auto &[asset, entry] : manifest) claimedImages.insert(entry.inputs.begin() + 1, entry.inputs.end());
+    std::vector<std::string> standaloneImages;
+    for(const std::string &image : images) {
+        if(claimedImages.find(image) == claimedImages.end()) standaloneImages.push_back(image);
+    }
+    JobSystem::parallelFor(standaloneImages.size(), 1, [&](const std::size_t firstImage, const std::size_t lastImage) {
+        for(std::size_t i = firstImage; i < lastImage; i++) bakeStandaloneImage(standaloneImages[i]);
+    }, "Bake Image");
+    JobSystem::shutdown();
+
+    // Failed Assets Are Left Out of The Manifest so They're Retried
+    if(!writeManifest()) {
+        std::cerr << "Failed to Write The Manifest in " << outputDirectory << "\n";
+        return 1;
+    }
+    std::cout << "Baked " << bakedCount << ", Up to Date " << upToDateCount << ", Failed " << failedCount << " (" << models.size() << " Models, " << images.size() << " Images)\n";
+    return failedCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+// Asset Packer - Packs Directories Into One Asset Archive The Engine Maps Instead of Opening Every Loose File
+// Usage: assetPacker <Archive> <Root Directory> <Directory>... [--store] [--workers N]
+// Entries Are Named by Their Path Relative to The Root Directory ("assets/models/cube.obj"), Mounting The Archive at The Root's Path From The Game Makes Them Replace The Loose Files
+// Entries Are LZ4 Compressed Unless That Saves Too Little (Already Compressed Images and Block Compressed Textures Are Stored so They Load Without A Copy), --store Stores Everything
+
+// Standard Headers
+#include<string>
+#include<vector>
+#include<thread>
+#include<cstdlib>
+#include<iostream>
+#include<filesystem>
+#include<algorithm>
+
+// Custom Engine Headers
+#include"../src/Engine/Jobs/JobSystem.hpp"
+#include"../src/Engine/Assets/AssetArchive.hpp"
+
+// Files Never Packed (Bake Bookkeeping and Half Written Files)
+static bool isSkippedFile(const std::filesystem::path &filePath) {
+    return filePath.filename() == "assetBaker.manifest" || filePath.extension() == ".tmp";
+}
+
+int main(int argc, char* argv[]) {
+    if(argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " <Archive> <Root Directory> <Directory>... [--store] [--workers N]\n";
+        return 2;
+    }
+    const std::filesystem::path archiveFilePath{argv[1]}, rootDirectory{argv[2]};
+    bool compressionEnabled{true};
+    unsigned int workerCount{std::max(std::thread::hardware_concurrency(), 2u) - 1};
+    std::vector<std::filesystem::path> directories;
+    for(int i = 3; i < argc; i++) {
+        const std::string argument{argv[i]};
+        if(argument == "--store") compressionEnabled = false;
+        else if(argument == "--workers" && i + 1 < argc) workerCount = std::max(std::atoi(argv[++i]), 1);
+        else directories.push_back(rootDirectory / argument);
+    }
+
+    // Gather Every File (Missing Directories Are Skipped, e.g. When Nothing Was Baked)
+    std::vector<AssetArchiveInputStruct> inputs;
+    for(const std::filesystem::path &directory : directories) {
+        if(!std::filesystem::is_directory(directory)) {
+            std::cerr << "Skipping Missing Directory: " << directory << "\n";
+            continue;
+        }
+        for(const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(directory)) {
+            if(!entry.is_regular_file() || isSkippedFile(entry.path())) continue;
+            inputs.push_back(AssetArchiveInputStruct{entry.path().lexically_normal().lexically_relative(rootDirectory.lexically_normal()).generic_string(), entry.path().string()});
+        }
+    }
+    std::sort(inputs.begin(), inputs.end(), [](const AssetArchiveInputStruct &first, const AssetArchiveInputStruct &second) {
+        return first.name < second.name;
+    });
+
+    // Pack Them
+    JobSystem::initialize(workerCount);
+    const bool written{AssetArchive::write(archiveFilePath.string(), inputs, compressionEnabled)};
+    JobSystem::shutdown();
+    if(!written) return 1;
+
+    // Summarize What Was Packed
+    AssetArchive archive;
+    if(!archive.open(archiveFilePath.string())) return 1;
+    std::uint64_t bytes{0}, storedBytes{0};
+    unsigned int compressedCount{0};
+    for(std::uint32_t i = 0; i < archive.getEntryCount(); i++) {
+        const AssetArchiveEntryStruct &entry = archive.getEntry(i);
+        bytes += entry.bytes;
+        storedBytes += entry.storedBytes;
+        if(entry.compression == ASSET_ARCHIVE_FAST_COMPRESSED) compressedCount++;
+    }
+    const double bytesPerMB{1024.0 * 1024.0};
+    std::cout << "Packed " << archive.getEntryCount() << " Files (" << compressedCount << " Compressed) Into " << archiveFilePath.string() << ": " << bytes / bytesPerMB << "MB -> " << std::filesystem::file_size(archiveFilePath) / bytesPerMB << "MB (" << storedBytes / bytesPerMB << "MB of Entry Data)\n";
+    return 0;
+}
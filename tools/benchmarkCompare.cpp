@@ -0,0 +1,184 @@
+// Benchmark Compare - Flags Regressions Between Two Benchmark Reports
+// Usage: benchmarkCompare <Baseline.json> <Current.json> [Threshold Percent (Default 5)]
+// Exits With 1 When Any Compared Metric is Worse Than The Baseline by More Than The Threshold
+
+// Standard Headers
+#include<map>
+#include<cmath>
+#include<string>
+#include<vector>
+#include<cctype>
+#include<cstdlib>
+#include<fstream>
+#include<sstream>
+#include<iomanip>
+#include<iostream>
+
+// Metrics Compared Between Reports (Lower is Better For All of Them) and Metrics Only Shown
+const std::vector<std::string> comparedMetrics{
+    "frameTimeMs.p50", "frameTimeMs.p95", "frameTimeMs.p99",
+    "cpuTimeMs.p50", "cpuTimeMs.p95", "cpuTimeMs.p99",
+    "gpuTimeMs.p50", "gpuTimeMs.p95", "gpuTimeMs.p99",
+    "drawCalls.average", "triangles.average",
+    "memoryBytes.peakResident",
+};
+const std::vector<std::string> shownMetrics{"frameTimeMs.average", "cpuTimeMs.average", "gpuTimeMs.average", "memoryBytes.resident"};
+
+// Differences Below These Are Noise Whatever The Percentage
+const double minTimeDifferenceMs{0.05}, minCountDifference{0.5}, minMemoryDifferenceBytes{1024.0 * 1024.0};
+
+// Flattened JSON Reader - Collects Every Number Under Its Dotted Path ("gpuTimeMs.p99") and Every String
+class ReportReader {
+    public:
+        std::map<std::string, double> numbers;
+        std::map<std::string, std::string> strings;
+
+        // Read A Report
+        bool read(const std::string &filePath) {
+            std::ifstream reportFile(filePath);
+            if(!reportFile) {
+                std::cerr << "Failed to Open Benchmark Report: " << filePath << "\n";
+                return false;
+            }
+            std::stringstream reportStream;
+            reportStream << reportFile.rdbuf();
+            this->text = reportStream.str();
+            this->position = 0;
+            if(!this->readValue("") || (this->skipWhitespace(), this->position != this->text.size())) {
+                std::cerr << "Invalid Benchmark Report: " << filePath << "\n";
+                return false;
+            }
+            return true;
+        }
+    private:
+        std::string text;
+        std::size_t position{0};
+
+        void skipWhitespace(void) {
+            while(this->position < this->text.size() && std::isspace((unsigned char)this->text[this->position])) this->position++;
+        }
+        bool consume(const char &character) {
+            this->skipWhitespace();
+            if(this->position >= this->text.size() || this->text[this->position] != character) return false;
+            this->position++;
+            return true;
+        }
+        bool readString(std::string &value) {
+            if(!this->consume('"')) return false;
+            value.clear();
+            while(this->position < this->text.size() && this->text[this->position] != '"') {
+                if(this->text[this->position] != '\\' || this->position + 1 >= this->text.size()) {
+                    value += this->text[this->position++];
+                    continue;
+                }
+
+                // Escapes - Control Characters Come as \n, \t or \u00XX (Other Code Points Are Kept as Written)
+                const char escape{this->text[++this->position]};
+                if(escape == 'u' && this->position + 4 < this->text.size()) {
+                    const std::string code{this->text.substr(this->position + 1, 4)};
+                    const unsigned long codePoint{std::strtoul(code.c_str(), nullptr, 16)};
+                    value += codePoint < 0x80 ? std::string(1, (char)codePoint) : "\\u" + code;
+                    this->position += 5;
+                    continue;
+                }
+                value += escape == 'n' ? '\n' : escape == 't' ? '\t' : escape == 'r' ? '\r' : escape;
+                this->position++;
+            }
+            return this->consume('"');
+        }
+        bool readValue(const std::string &path) {
+            this->skipWhitespace();
+            if(this->position >= this->text.size()) return false;
+            const char next{this->text[this->position]};
+
+            // Object - Members Extend The Path
+            if(next == '{') {
+                this->position++;
+                if(this->consume('}')) return true;
+                do {
+                    std::string key;
+                    if(!this->readString(key) || !this->consume(':') || !this->readValue(path.empty() ? key : path + "." + key)) return false;
+                } while(this->consume(','));
+                return this->consume('}');
+            }
+
+            // Array - Elements Are Indexed
+            if(next == '[') {
+                this->position++;
+                if(this->consume(']')) return true;
+                unsigned int index{0};
+                do {
+                    if(!this->readValue(path + "." + std::to_string(index++))) return false;
+                } while(this->consume(','));
+                return this->consume(']');
+            }
+
+            // String
+            if(next == '"') {
+                std::string value;
+                if(!this->readString(value)) return false;
+                this->strings[path] = value;
+                return true;
+            }
+
+            // Literals
+            for(const std::string literal : {"true", "false", "null"}) {
+                if(this->text.compare(this->position, literal.size(), literal) == 0) {
+                    this->position += literal.size();
+                    return true;
+                }
+            }
+
+            // Number
+            const char* start = this->text.c_str() + this->position;
+            char* end = nullptr;
+            const double value{std::strtod(start, &end)};
+            if(end == start) return false;
+            this->position += end - start;
+            this->numbers[path] = value;
+            return true;
+        }
+};
+
+// Main
+int main(int argc, char* argv[]) {
+    if(argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <Baseline.json> <Current.json> [Threshold Percent]\n";
+        return 2;
+    }
+    const double thresholdPercent{argc > 3 ? std::strtod(argv[3], nullptr) : 5.0};
+
+    // Read Both Reports
+    ReportReader baseline, current;
+    if(!baseline.read(argv[1]) || !current.read(argv[2])) return 2;
+
+    // Runs on Different Renderers or Resolutions Aren't Comparable
+    for(const std::string key : {"renderer", "scene"}) {
+        if(baseline.strings[key] != current.strings[key]) std::cout << "Warning: " << key << " Differs (\"" << baseline.strings[key] << "\" vs \"" << current.strings[key] << "\")\n";
+    }
+    for(const std::string key : {"width", "height", "measuredFrames"}) {
+        if(baseline.numbers[key] != current.numbers[key]) std::cout << "Warning: " << key << " Differs (" << baseline.numbers[key] << " vs " << current.numbers[key] << ")\n";
+    }
+
+    // Compare Every Metric
+    unsigned int regressionCount{0};
+    std::cout << std::fixed << std::setprecision(3) << std::left << std::setw(26) << "Metric" << std::right << std::setw(16) << "Baseline" << std::setw(16) << "Current" << std::setw(12) << "Change" << "\n";
+    const auto compare = [&](const std::string &metric, const bool &flagRegressions) {
+        if(baseline.numbers.find(metric) == baseline.numbers.end() || current.numbers.find(metric) == current.numbers.end()) return;
+        const double baselineValue{baseline.numbers[metric]}, currentValue{current.numbers[metric]};
+        const double changePercent{baselineValue != 0.0 ? (currentValue - baselineValue) / std::fabs(baselineValue) * 100.0 : 0.0};
+
+        // Regressions Must Exceed Both The Threshold and The Metric's Noise Floor (A Zero Baseline Has No Percentage so Only The Noise Floor Applies)
+        const double minDifference{metric.rfind("memoryBytes", 0) == 0 ? minMemoryDifferenceBytes : metric.find("Ms.") != std::string::npos ? minTimeDifferenceMs : minCountDifference};
+        const bool regressed{flagRegressions && (baselineValue == 0.0 || changePercent > thresholdPercent) && currentValue - baselineValue > minDifference};
+        if(regressed) regressionCount++;
+        std::cout << std::left << std::setw(26) << metric << std::right << std::setw(16) << baselineValue << std::setw(16) << currentValue << std::setw(11) << std::showpos << changePercent << std::noshowpos << "%"
+                  << (regressed ? "  REGRESSION" : "") << "\n";
+    };
+    for(const std::string &metric : comparedMetrics) compare(metric, true);
+    for(const std::string &metric : shownMetrics) compare(metric, false);
+
+    // Exit Code Reports The Result
+    std::cout << regressionCount << " Regression(s) Beyond " << thresholdPercent << "%\n";
+    return regressionCount > 0 ? 1 : 0;
+}